@@ -0,0 +1,111 @@
+#include "BackBuffer.h"
+#include <algorithm>           // std::min, std::max
+
+// Capacities are rounded up to this many pixels
+constexpr int kSlackGranularity = 64;
+
+static int RoundUp(int value) {
+    return (value + kSlackGranularity - 1) / kSlackGranularity * kSlackGranularity;
+}
+
+BackBuffer::~BackBuffer() {
+    Release();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Function : Resize
+// Purpose  : Shrinking only moves the visible edge. Growing past the
+//            capacity adds half again per dimension, so a drag from 800
+//            to 2000 pixels wide reallocates twice after the first
+///////////////////////////////////////////////////////////////////////////////
+bool BackBuffer::Resize(int newWidth, int newHeight) {
+    newWidth = (std::max)(newWidth, 1);
+    newHeight = (std::max)(newHeight, 1);
+    width = newWidth;
+    height = newHeight;
+
+    if (dc && newWidth <= capacityWidth && newHeight <= capacityHeight)
+        return false;
+
+    const int grownWidth = newWidth <= capacityWidth ? capacityWidth
+        : RoundUp((std::max)(newWidth + newWidth / 4, capacityWidth + capacityWidth / 2));
+    const int grownHeight = newHeight <= capacityHeight ? capacityHeight
+        : RoundUp((std::max)(newHeight + newHeight / 4, capacityHeight + capacityHeight / 2));
+    return Reallocate(grownWidth, grownHeight);
+}
+
+bool BackBuffer::Trim() {
+    const int64_t visible = static_cast<int64_t>(width) * height;
+    const int64_t capacity = static_cast<int64_t>(capacityWidth) * capacityHeight;
+    if (!dc || capacity <= 2 * visible)
+        return false;
+
+    return Reallocate(RoundUp(width), RoundUp(height));
+}
+
+void BackBuffer::Release() {
+    if (dc) {
+        SelectObject(dc, oldBitmap);
+        DeleteDC(dc);
+        dc = nullptr;
+    }
+    if (bitmap) {
+        DeleteObject(bitmap);
+        bitmap = nullptr;
+    }
+    pixels = nullptr;
+    capacityWidth = capacityHeight = 0;
+}
+
+void BackBuffer::RecordFrame(int64_t microseconds) {
+    ++stats.frames;
+    stats.frameMicroseconds += microseconds;
+    stats.maxFrameMicroseconds = (std::max)(stats.maxFrameMicroseconds, microseconds);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Function : Reallocate
+// Purpose  : New DIB section, the old visible pixels copied across. On
+//            failure the current bitmap stays (painting clips to it)
+///////////////////////////////////////////////////////////////////////////////
+bool BackBuffer::Reallocate(int newCapacityWidth, int newCapacityHeight) {
+    HDC screen = ::GetDC(nullptr);
+    if (!dc)
+        dc = CreateCompatibleDC(screen);
+
+    BITMAPINFO info = {};
+    info.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    info.bmiHeader.biWidth = newCapacityWidth;
+    info.bmiHeader.biHeight = -newCapacityHeight;   // Top-down
+    info.bmiHeader.biPlanes = 1;
+    info.bmiHeader.biBitCount = 32;
+    info.bmiHeader.biCompression = BI_RGB;
+
+    void* bits = nullptr;
+    HBITMAP newBitmap = dc ? CreateDIBSection(screen, &info, DIB_RGB_COLORS, &bits, nullptr, 0) : nullptr;
+    ReleaseDC(nullptr, screen);
+    if (!newBitmap)
+        return false;
+
+    ++stats.allocations;
+
+    if (bitmap) {
+        HDC source = CreateCompatibleDC(dc);
+        HBITMAP previous = (HBITMAP)SelectObject(dc, newBitmap);
+        HBITMAP sourceOld = (HBITMAP)SelectObject(source, previous);
+        BitBlt(dc, 0, 0, (std::min)(capacityWidth, newCapacityWidth), (std::min)(capacityHeight, newCapacityHeight),
+            source, 0, 0, SRCCOPY);
+        SelectObject(source, sourceOld);
+        DeleteDC(source);
+        DeleteObject(previous);
+    }
+    else {
+        oldBitmap = (HBITMAP)SelectObject(dc, newBitmap);
+    }
+
+    bitmap = newBitmap;
+    pixels = static_cast<uint32_t*>(bits);
+    capacityWidth = newCapacityWidth;
+    capacityHeight = newCapacityHeight;
+    return true;
+}
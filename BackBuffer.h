@@ -0,0 +1,69 @@
+#pragma once
+
+#include <windows.h>
+#include <cstdint>             // Pixels, counters
+
+///////////////////////////////////////////////////////////////////////////////
+// Struct: BackBufferStats
+// Purpose: Resize-storm instrumentation: what a live drag of the window
+//          edge cost in allocations and paint time
+///////////////////////////////////////////////////////////////////////////////
+struct BackBufferStats {
+    uint32_t allocations = 0;          // DIB sections created
+    uint32_t frames = 0;               // Paints recorded
+    int64_t frameMicroseconds = 0;     // Sum over those paints
+    int64_t maxFrameMicroseconds = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Class: BackBuffer
+// Purpose: The window's off-screen frame: a 32-bit top-down DIB section
+//          kept selected into one memory DC for the window's lifetime.
+//          The bitmap is allocated with slack and grows geometrically, so
+//          dragging a window edge reallocates a handful of times instead of
+//          on every mouse step; Trim gives the slack back once the drag is
+//          over. Reallocating keeps the visible pixels.
+//          The pixels are exposed (0x00RRGGBB, GetStride() per row) for
+//          software compositing; call GdiFlush before touching them after
+//          GDI drawing.
+///////////////////////////////////////////////////////////////////////////////
+class BackBuffer
+{
+public:
+    BackBuffer() = default;
+    ~BackBuffer();
+
+    BackBuffer(const BackBuffer&) = delete;
+    BackBuffer& operator=(const BackBuffer&) = delete;
+
+    // Sets the visible size; true if the bitmap had to be replaced
+    bool Resize(int width, int height);
+
+    // Drops slack larger than the visible area itself; true if replaced
+    bool Trim();
+
+    void Release();
+
+    HDC GetDC() const { return dc; }
+    uint32_t* GetPixels() const { return pixels; }
+    int GetStride() const { return capacityWidth; }
+    int GetWidth() const { return width; }
+    int GetHeight() const { return height; }
+
+    void RecordFrame(int64_t microseconds);
+    const BackBufferStats& GetStats() const { return stats; }
+    void ResetStats() { stats = {}; }
+
+private:
+    HDC dc = nullptr;
+    HBITMAP bitmap = nullptr;
+    HBITMAP oldBitmap = nullptr;
+    uint32_t* pixels = nullptr;
+    int width = 0;
+    int height = 0;
+    int capacityWidth = 0;
+    int capacityHeight = 0;
+    BackBufferStats stats;
+
+    bool Reallocate(int newCapacityWidth, int newCapacityHeight);
+};
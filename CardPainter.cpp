@@ -0,0 +1,99 @@
+#include "CardPainter.h"
+#include <algorithm>           // std::min, std::max
+
+// Grid label box inside a tool card
+constexpr int LABEL_TOP = 85;
+constexpr int LABEL_INSET = 10;
+constexpr int LABEL_BOTTOM_INSET = 15;
+constexpr int CARD_RADIUS = 8;
+constexpr int ICON_SIZE = 64;
+constexpr int ICON_TOP = 15;
+
+constexpr RenderColor LABEL_COLOR = MakeRenderColor(255, 102, 102, 153);
+
+//////////////////////////////////////////////////////////////////////
+// PaintBackground: Shadow first, then fill and border in the state's
+//                  colors
+//////////////////////////////////////////////////////////////////////
+void CardPainter::PaintBackground(RenderBackend& backend, int x, int y, int size, CardState state) {
+    RenderColor fill = MakeRenderColor(255, 255, 255, 255);
+    RenderColor border = MakeRenderColor(255, 225, 223, 221);
+    if (state == CardState::Hover) {
+        fill = MakeRenderColor(246, 246, 246, 255);
+        border = MakeRenderColor(255, 25, 102, 255);
+    }
+    else if (state == CardState::Pressed) {
+        fill = MakeRenderColor(255, 235, 235, 235);
+        border = MakeRenderColor(255, 0, 84, 204);
+    }
+
+    backend.FillRoundedRect(x + 2, y + 2, size, size, CARD_RADIUS, MakeRenderColor(20, 0, 0, 0));
+    backend.FillRoundedRect(x, y, size, size, CARD_RADIUS, fill);
+    backend.StrokeRoundedRect(x, y, size - 1, size - 1, CARD_RADIUS, 2.0f, border);
+}
+
+void CardPainter::PaintIcon(RenderBackend& backend, int x, int y, int size, const RenderImage* icon) {
+    const int iconX = x + (size - ICON_SIZE) / 2;
+    const int iconY = y + ICON_TOP;
+
+    if (icon && (icon->pixels || icon->native)) {
+        backend.DrawImage(iconX, iconY, ICON_SIZE, ICON_SIZE, *icon);
+        return;
+    }
+
+    // Red box placeholder with label
+    backend.FillRect(iconX, iconY, ICON_SIZE, ICON_SIZE, MakeRenderColor(255, 255, 0, 0));
+
+    static const wchar_t text[] = L"NO ICON";
+    constexpr size_t length = sizeof(text) / sizeof(text[0]) - 1;
+    int extents[length];
+    backend.MeasureText(RenderFont::Detail, text, length, extents);
+    const int lineHeight = backend.GetLineHeight(RenderFont::Detail);
+    backend.DrawString(RenderFont::Detail, iconX + (ICON_SIZE - extents[length - 1]) / 2,
+        iconY + (ICON_SIZE - lineHeight) / 2, text, length, MakeRenderColor(255, 255, 255, 255));
+}
+
+//////////////////////////////////////////////////////////////////////
+// MeasureLabel: One MeasureText call, then LabelLayout wraps from the
+//               extents
+//////////////////////////////////////////////////////////////////////
+void CardPainter::MeasureLabel(RenderBackend& backend, const wchar_t* text, size_t length, int size,
+    std::vector<int>& extents, LabelMetrics& label) {
+    int ellipsis[3];
+    backend.MeasureText(RenderFont::Label, L"...", 3, ellipsis);
+
+    // Line records index the text with 16 bits; names are far shorter
+    length = (std::min)(length, size_t(UINT16_MAX));
+    extents.resize(length);
+    if (length > 0)
+        backend.MeasureText(RenderFont::Label, text, length, extents.data());
+
+    const int boxWidth = size - 2 * LABEL_INSET;
+    const int boxHeight = size + 40 - LABEL_TOP - LABEL_BOTTOM_INSET;
+    const int lineHeight = (std::max)(1, backend.GetLineHeight(RenderFont::Label));
+
+    LabelLayout::Wrap(text, length, extents.data(), boxWidth, boxHeight / lineHeight, ellipsis[2], label);
+    label.lineHeight = lineHeight;
+}
+
+void CardPainter::PaintLabel(RenderBackend& backend, int x, int y, int size,
+    const wchar_t* text, const LabelMetrics& label) {
+    const int boxWidth = size - 2 * LABEL_INSET;
+    int ellipsisWidth = 0;
+
+    int lineY = y + LABEL_TOP;
+    for (const LabelLine& line : label.lines) {
+        const int lineX = x + LABEL_INSET + (boxWidth - line.width) / 2;
+        backend.DrawString(RenderFont::Label, lineX, lineY, text + line.start, line.length, LABEL_COLOR);
+
+        if (line.ellipsis) {
+            if (ellipsisWidth == 0) {
+                int ellipsis[3];
+                backend.MeasureText(RenderFont::Label, L"...", 3, ellipsis);
+                ellipsisWidth = ellipsis[2];
+            }
+            backend.DrawString(RenderFont::Label, lineX + line.width - ellipsisWidth, lineY, L"...", 3, LABEL_COLOR);
+        }
+        lineY += label.lineHeight;
+    }
+}
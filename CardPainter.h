@@ -0,0 +1,38 @@
+#pragma once
+
+#include "RenderBackend.h"
+#include "LabelLayout.h"       // Measured label lines
+#include <vector>              // Extents scratch
+
+// Visual state of a grid card (each has its own pre-rendered background)
+enum class CardState : uint8_t {
+    Normal,
+    Hover,
+    Pressed
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: CardPainter
+// Purpose: Draws a grid card through a RenderBackend, so the GDI window
+//          and the software rasterizer produce the same card.
+//          A card is `size` x `size` with a 2px shadow; its label wraps
+//          below the icon and may run 40px past the card's bottom.
+//          The parts are separate because the window caches them
+//          separately (background sprite per state, composed card).
+////////////////////////////////////////////////////////////////////////
+class CardPainter {
+public:
+    // Shadow, fill and border for the state
+    static void PaintBackground(RenderBackend& backend, int x, int y, int size, CardState state);
+
+    // The 64x64 icon, or a red placeholder when there is none
+    static void PaintIcon(RenderBackend& backend, int x, int y, int size, const RenderImage* icon);
+
+    // Wraps the label for the card's label box (epoch is left alone)
+    static void MeasureLabel(RenderBackend& backend, const wchar_t* text, size_t length, int size,
+        std::vector<int>& extents, LabelMetrics& label);
+
+    // Draws the lines MeasureLabel produced, centered in the label box
+    static void PaintLabel(RenderBackend& backend, int x, int y, int size,
+        const wchar_t* text, const LabelMetrics& label);
+};
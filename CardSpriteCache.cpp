@@ -0,0 +1,111 @@
+#include "CardSpriteCache.h"
+
+CardSpriteCache::~CardSpriteCache() {
+    Clear();
+}
+
+void CardSpriteCache::SetSpriteSize(int width, int height) {
+    if (width == spriteWidth && height == spriteHeight)
+        return;
+
+    Clear();
+    spriteWidth = width;
+    spriteHeight = height;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Find: Ticket = slot index (high half) + generation (low half);
+//       generations are unique per cache and never 0, so ticket 0
+//       (a tool never drawn) never matches
+//////////////////////////////////////////////////////////////////////
+bool CardSpriteCache::Find(uint64_t ticket, const CardSpriteKey& key, CardSprite& sprite) {
+    const size_t index = static_cast<size_t>(ticket >> 32);
+    const uint32_t generation = static_cast<uint32_t>(ticket);
+    if (generation == 0 || index >= slots.size())
+        return false;
+
+    Slot& slot = slots[index];
+    if (slot.generation != generation || !(slot.key == key))
+        return false;
+
+    slot.lastUse = ++useCounter;
+    sprite = GetSlotSprite(index);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Allocate: A new page while under the cap, otherwise the least
+//           recently used slot (a scan, but only on misses)
+//////////////////////////////////////////////////////////////////////
+uint64_t CardSpriteCache::Allocate(const CardSpriteKey& key, CardSprite& sprite) {
+    if (spriteWidth <= 0 || spriteHeight <= 0)
+        return 0;
+
+    size_t index = slots.size();
+    for (size_t i = 0; i < slots.size(); ++i) {
+        if (slots[i].lastUse == 0) {
+            index = i;
+            break;
+        }
+    }
+
+    if (index == slots.size() && !(pages.size() < kMaxPages && AddPage())) {
+        if (slots.empty())
+            return 0;
+
+        index = 0;
+        for (size_t i = 1; i < slots.size(); ++i) {
+            if (slots[i].lastUse < slots[index].lastUse)
+                index = i;
+        }
+    }
+
+    Slot& slot = slots[index];
+    slot.key = key;
+    slot.lastUse = ++useCounter;
+    if (++generationCounter == 0)
+        ++generationCounter;
+    slot.generation = generationCounter;
+
+    sprite = GetSlotSprite(index);
+    return (static_cast<uint64_t>(index) << 32) | slot.generation;
+}
+
+void CardSpriteCache::Clear() {
+    for (const auto& page : pages) {
+        SelectObject(page.dc, page.oldBitmap);
+        DeleteObject(page.bitmap);
+        DeleteDC(page.dc);
+    }
+    pages.clear();
+
+    // The generation counter survives, so no old ticket can match a
+    // slot allocated after this
+    slots.clear();
+}
+
+CardSprite CardSpriteCache::GetSlotSprite(size_t index) const {
+    CardSprite sprite;
+    sprite.dc = pages[index / kSlotsPerPage].dc;
+    sprite.x = 0;
+    sprite.y = static_cast<int>(index % kSlotsPerPage) * spriteHeight;
+    return sprite;
+}
+
+bool CardSpriteCache::AddPage() {
+    HDC screen = GetDC(nullptr);
+    HBITMAP bitmap = CreateCompatibleBitmap(screen, spriteWidth, spriteHeight * kSlotsPerPage);
+    HDC dc = bitmap ? CreateCompatibleDC(screen) : nullptr;
+    ReleaseDC(nullptr, screen);
+
+    if (!dc) {
+        if (bitmap)
+            DeleteObject(bitmap);
+        return false;
+    }
+
+    HBITMAP oldBitmap = (HBITMAP)SelectObject(dc, bitmap);
+    pages.push_back({ dc, bitmap, oldBitmap });
+    slots.resize(slots.size() + kSlotsPerPage);
+    return true;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <windows.h>
+#include "ToolIconManager.h"   // IconSlot
+#include <cstdint>             // Tickets, use counters
+#include <vector>              // Pages and slots
+
+////////////////////////////////////////////////////////////////////////
+// Struct: CardSpriteKey
+// Purpose: Everything a composed card depends on besides the tool's
+//          text (a rename drops the tool's ticket instead)
+////////////////////////////////////////////////////////////////////////
+struct CardSpriteKey {
+    IconSlot icon;
+    uint32_t labelEpoch;
+    uint8_t state;
+
+    bool operator==(const CardSpriteKey& other) const {
+        return icon == other.icon && labelEpoch == other.labelEpoch && state == other.state;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////
+// Struct: CardSprite
+// Purpose: Where a sprite lives: blit from `dc` at (x, y)
+////////////////////////////////////////////////////////////////////////
+struct CardSprite {
+    HDC dc = nullptr;
+    int x = 0;
+    int y = 0;
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: CardSpriteCache
+// Purpose: Fixed-size sprite slots in screen-compatible bitmaps, each
+//          page of slots permanently selected into its own memory DC,
+//          so drawing a cached sprite is a single BitBlt.
+//          A tool holds a ticket (slot + generation). Reusing a slot
+//          gives it a new generation, which silently invalidates the
+//          old owner's ticket. When every slot is taken the least recently
+//          used one is recycled.
+////////////////////////////////////////////////////////////////////////
+class CardSpriteCache {
+public:
+    CardSpriteCache() = default;
+    ~CardSpriteCache();
+
+    CardSpriteCache(const CardSpriteCache&) = delete;
+    CardSpriteCache& operator=(const CardSpriteCache&) = delete;
+
+    // Slot size; a change drops every sprite
+    void SetSpriteSize(int width, int height);
+
+    // True if `ticket` still names a slot holding `key`
+    bool Find(uint64_t ticket, const CardSpriteKey& key, CardSprite& sprite);
+
+    // Claims a slot for `key` and returns its ticket (0 if out of GDI
+    // memory). The caller draws the sprite into `sprite` before use.
+    uint64_t Allocate(const CardSpriteKey& key, CardSprite& sprite);
+
+    // Frees every page (theme/DPI change, shutdown)
+    void Clear();
+
+private:
+    struct Slot {
+        CardSpriteKey key = {};
+        uint32_t generation = 0;
+        uint64_t lastUse = 0;
+    };
+
+    struct Page {
+        HDC dc;
+        HBITMAP bitmap;
+        HBITMAP oldBitmap;
+    };
+
+    static constexpr int kSlotsPerPage = 32;   // Stacked vertically
+    static constexpr int kMaxPages = 8;        // 256 cards: a 4K screen full
+
+    int spriteWidth = 0;
+    int spriteHeight = 0;
+    std::vector<Page> pages;
+    std::vector<Slot> slots;
+    uint64_t useCounter = 0;
+    uint32_t generationCounter = 0;
+
+    CardSprite GetSlotSprite(size_t slot) const;
+    bool AddPage();
+};
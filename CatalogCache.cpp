@@ -0,0 +1,316 @@
+#include "CatalogCache.h"
+#include <algorithm>
+#include <filesystem>
+#include <atomic>
+#include <fstream>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+//////////////////////////////////////////////////////////////////////
+// IsSeparator / ParentFolder: Path helpers for both separator styles
+//////////////////////////////////////////////////////////////////////
+static bool IsSeparator(wchar_t ch) {
+    return ch == L'\\' || ch == L'/';
+}
+
+static std::wstring ParentFolder(const std::wstring& file) {
+    size_t slash = file.find_last_of(L"\\/");
+    return slash == std::wstring::npos ? std::wstring() : file.substr(0, slash);
+}
+
+//////////////////////////////////////////////////////////////////////
+// AppendUtf16: wchar_t is UTF-16 on Windows and UTF-32 elsewhere
+//////////////////////////////////////////////////////////////////////
+static void AppendUtf16(std::vector<uint16_t>& out, const std::wstring& text) {
+    for (wchar_t ch : text) {
+        uint32_t code = static_cast<uint32_t>(ch);
+        if (code > 0xFFFF) {
+            code -= 0x10000;
+            out.push_back(static_cast<uint16_t>(0xD800 + (code >> 10)));
+            out.push_back(static_cast<uint16_t>(0xDC00 + (code & 0x3FF)));
+        }
+        else {
+            out.push_back(static_cast<uint16_t>(code));
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////
+CatalogCache::CatalogCache() {}
+
+CatalogCache::~CatalogCache() {
+    Close();
+}
+
+//////////////////////////////////////////////////////////////////////
+// Open: Maps the whole file read-only and checks every section bound
+//       once, so ReadRecord only has to check string references
+//////////////////////////////////////////////////////////////////////
+bool CatalogCache::Open(const std::wstring& file) {
+    Close();
+
+#ifdef _WIN32
+    HANDLE handle = CreateFileW(file.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE)
+        return false;
+    fileHandle = handle;
+
+    LARGE_INTEGER length;
+    if (!GetFileSizeEx(handle, &length) || length.QuadPart < static_cast<LONGLONG>(sizeof(Header))) {
+        Close();
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        Close();
+        return false;
+    }
+    mapHandle = mapping;
+
+    data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    dataSize = static_cast<size_t>(length.QuadPart);
+#else
+    int fd = open(fs::path(file).string().c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    fileHandle = reinterpret_cast<void*>(static_cast<intptr_t>(fd) + 1);   // +1 keeps fd 0 non-null
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(Header))) {
+        Close();
+        return false;
+    }
+
+    void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    data = view == MAP_FAILED ? nullptr : static_cast<const uint8_t*>(view);
+    dataSize = static_cast<size_t>(info.st_size);
+#endif
+
+    if (!data) {
+        Close();
+        return false;
+    }
+
+    // The file may come from a shared folder: every bound is checked by
+    // subtraction from dataSize, so no sum of header fields can wrap
+    const Header* header = GetHeader();
+    bool valid = header->magic == kMagic &&
+        header->version == kVersion &&
+        header->entrySize == sizeof(Entry) &&
+        header->fileSize == dataSize &&
+        header->entriesOffset % alignof(Entry) == 0 &&
+        header->poolOffset % sizeof(uint16_t) == 0 &&
+        header->entriesOffset >= sizeof(Header) && header->entriesOffset <= dataSize &&
+        header->entryCount <= (dataSize - header->entriesOffset) / sizeof(Entry) &&
+        header->poolOffset <= dataSize &&
+        header->poolLength <= (dataSize - header->poolOffset) / sizeof(uint16_t) &&
+        header->poolOffset >= header->entriesOffset + uint64_t(header->entryCount) * sizeof(Entry);
+
+    if (!valid) {
+        Close();
+        return false;
+    }
+
+    baseFolder = ParentFolder(file);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Close: Releases the view and handles; safe to call repeatedly
+//////////////////////////////////////////////////////////////////////
+void CatalogCache::Close() {
+#ifdef _WIN32
+    if (data)
+        UnmapViewOfFile(data);
+    if (mapHandle)
+        CloseHandle(mapHandle);
+    if (fileHandle)
+        CloseHandle(fileHandle);
+#else
+    if (data)
+        munmap(const_cast<uint8_t*>(data), dataSize);
+    if (fileHandle)
+        close(static_cast<int>(reinterpret_cast<intptr_t>(fileHandle) - 1));
+#endif
+
+    data = nullptr;
+    dataSize = 0;
+    fileHandle = nullptr;
+    mapHandle = nullptr;
+    baseFolder.clear();
+}
+
+const CatalogCache::Header* CatalogCache::GetHeader() const {
+    return reinterpret_cast<const Header*>(data);
+}
+
+size_t CatalogCache::GetEntryCount() const {
+    return data ? GetHeader()->entryCount : 0;
+}
+
+//////////////////////////////////////////////////////////////////////
+// ReadString: Copies one pool string out of the mapping
+//////////////////////////////////////////////////////////////////////
+std::wstring CatalogCache::ReadString(const StringRef& ref) const {
+    const Header* header = GetHeader();
+    if (ref.offset > header->poolLength || ref.length > header->poolLength - ref.offset)
+        return std::wstring();
+
+    const uint16_t* units = reinterpret_cast<const uint16_t*>(data + header->poolOffset) + ref.offset;
+
+#ifdef _WIN32
+    return std::wstring(reinterpret_cast<const wchar_t*>(units), ref.length);
+#else
+    std::wstring text;
+    text.reserve(ref.length);
+    for (uint32_t i = 0; i < ref.length; ++i) {
+        uint32_t code = units[i];
+        if (code >= 0xD800 && code < 0xDC00 && i + 1 < ref.length &&
+            units[i + 1] >= 0xDC00 && units[i + 1] < 0xE000) {
+            code = 0x10000 + ((code - 0xD800) << 10) + (units[i + 1] - 0xDC00);
+            ++i;
+        }
+        text.push_back(static_cast<wchar_t>(code));
+    }
+    return text;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////
+// ReadRecord: Decodes one fixed-size entry
+//////////////////////////////////////////////////////////////////////
+bool CatalogCache::ReadRecord(size_t index, CatalogRecord& record) const {
+    if (index >= GetEntryCount())
+        return false;
+
+    const Header* header = GetHeader();
+    const Entry& entry = reinterpret_cast<const Entry*>(data + header->entriesOffset)[index];
+
+    record.folder = ReadString(entry.folder);
+    if (entry.flags & kFolderRelative) {
+        if (record.folder.empty())
+            record.folder = baseFolder;
+        else
+            record.folder = baseFolder + static_cast<wchar_t>(fs::path::preferred_separator) + record.folder;
+    }
+
+    record.fileName = ReadString(entry.fileName);
+    record.extension = ReadString(entry.extension);
+    record.searchKey = ReadString(entry.searchKey);
+    record.size = entry.size;
+    record.mtime = entry.mtime;
+    record.lastLaunched = entry.lastLaunched;
+    record.category = entry.category;
+    return !record.fileName.empty();
+}
+
+//////////////////////////////////////////////////////////////////////
+// Write: Interns every string, lays out header/entries/pool and
+//        replaces the target atomically (readers never see half a file)
+//////////////////////////////////////////////////////////////////////
+bool CatalogCache::Write(const std::wstring& file, const std::vector<CatalogRecord>& records) {
+    const std::wstring base = ParentFolder(file);
+
+    std::vector<uint16_t> pool;
+    std::unordered_map<std::wstring, StringRef> interned;
+
+    auto intern = [&](const std::wstring& text) {
+        auto found = interned.find(text);
+        if (found != interned.end())
+            return found->second;
+
+        StringRef ref;
+        ref.offset = static_cast<uint32_t>(pool.size());
+        AppendUtf16(pool, text);
+        ref.length = static_cast<uint32_t>(pool.size() - ref.offset);
+        interned.emplace(text, ref);
+        return ref;
+    };
+
+    std::vector<Entry> entries;
+    entries.reserve(records.size());
+
+    for (const auto& record : records) {
+        Entry entry = {};
+
+        // Folders under the cache's own folder travel with it
+        const std::wstring& folder = record.folder;
+        if (!base.empty() && folder.compare(0, base.size(), base) == 0 &&
+            (folder.size() == base.size() || IsSeparator(folder[base.size()]))) {
+            size_t start = (std::min)(folder.size(), base.size() + 1);
+            entry.folder = intern(folder.substr(start));
+            entry.flags |= kFolderRelative;
+        }
+        else {
+            entry.folder = intern(folder);
+        }
+
+        entry.fileName = intern(record.fileName);
+        entry.extension = intern(record.extension);
+        entry.searchKey = intern(record.searchKey);
+        entry.size = record.size;
+        entry.mtime = record.mtime;
+        entry.lastLaunched = record.lastLaunched;
+        entry.category = record.category;
+        entries.push_back(entry);
+    }
+
+    Header header = {};
+    header.magic = kMagic;
+    header.version = kVersion;
+    header.entryCount = static_cast<uint32_t>(entries.size());
+    header.entrySize = sizeof(Entry);
+    header.entriesOffset = sizeof(Header);
+    header.poolOffset = header.entriesOffset + entries.size() * sizeof(Entry);
+    header.poolLength = pool.size();
+    header.fileSize = header.poolOffset + pool.size() * sizeof(uint16_t);
+
+    // <file>.<process id>.<write number>.tmp
+#ifdef _WIN32
+    const unsigned long processId = GetCurrentProcessId();
+#else
+    const unsigned long processId = static_cast<unsigned long>(getpid());
+#endif
+    static std::atomic<unsigned> writeNumber{ 0 };
+
+    const fs::path target(file);
+    fs::path temp = target;
+    temp += L"." + std::to_wstring(processId) + L"." + std::to_wstring(writeNumber++) + L".tmp";
+
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return false;
+
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(Entry));
+        out.write(reinterpret_cast<const char*>(pool.data()), pool.size() * sizeof(uint16_t));
+    }
+
+    std::error_code ec;
+    if (fs::file_size(temp, ec) != header.fileSize || ec) {
+        fs::remove(temp, ec);
+        return false;
+    }
+
+    fs::rename(temp, target, ec);
+    if (ec) {
+        fs::remove(temp, ec);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>             // Fixed-width on-disk fields
+#include <string>              // std::wstring / std::u16string
+#include <vector>              // Record lists
+
+////////////////////////////////////////////////////////////////////////
+// Struct: CatalogRecord
+// Purpose: One tool as stored in / loaded from the cache file.
+//          Plain data only, so the cache builds and runs on Linux too.
+////////////////////////////////////////////////////////////////////////
+struct CatalogRecord {
+    std::wstring folder;      // Absolute folder of the tool
+    std::wstring fileName;    // File name as on disk, extension included
+    std::wstring extension;   // Lowercase extension including the dot
+    std::wstring searchKey;   // Precomputed search key for the name
+    uint64_t size = 0;        // File size at the time of caching
+    int64_t mtime = 0;        // Last write time at the time of caching
+    int64_t lastLaunched = 0; // When the launcher last started it (0 = never);
+                              // only set in per-user launch history files
+    uint8_t category = 0;     // ToolCategory value
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: CatalogCache
+// Purpose: Compact, versioned binary snapshot of the tool catalog.
+//
+// Layout (little-endian, all offsets from the start of the file):
+//   Header        magic "TLCC", version, counts, section offsets
+//   Entry[count]  fixed 64-byte records; strings are (offset, length)
+//                 references into the pool
+//   String pool   interned UTF-16 code units - each distinct folder,
+//                 extension, name and key is stored exactly once
+//
+// Folders below the cache file's own directory are stored relative to
+// it, so a cache shipped next to a tool folder is valid on any machine.
+// The file is memory-mapped for reading: Open validates the header only
+// and each record is decoded when ReadRecord asks for it.
+////////////////////////////////////////////////////////////////////////
+class CatalogCache {
+public:
+    static constexpr uint32_t kMagic = 0x43434C54;   // "TLCC"
+    static constexpr uint32_t kVersion = 3;   // 2: locale-independent search keys, 3: last launch time
+
+    CatalogCache();
+    ~CatalogCache();
+
+    CatalogCache(const CatalogCache&) = delete;
+    CatalogCache& operator=(const CatalogCache&) = delete;
+
+    // Maps the file and validates the header; false if missing or stale
+    bool Open(const std::wstring& file);
+
+    // Unmaps the file (also done by the destructor)
+    void Close();
+
+    // Number of entries in the mapped file
+    size_t GetEntryCount() const;
+
+    // Decodes entry i (strings are copied out of the mapping)
+    bool ReadRecord(size_t index, CatalogRecord& record) const;
+
+    // Writes records to a temp file and renames it over the target. The
+    // temp name is unique per process, so launchers sharing the file
+    // never write into each other's temp file.
+    static bool Write(const std::wstring& file, const std::vector<CatalogRecord>& records);
+
+private:
+    struct StringRef {
+        uint32_t offset;   // In UTF-16 code units from the pool start
+        uint32_t length;   // In UTF-16 code units
+    };
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t entryCount;
+        uint32_t entrySize;
+        uint64_t entriesOffset;
+        uint64_t poolOffset;
+        uint64_t poolLength;      // In UTF-16 code units
+        uint64_t fileSize;
+    };
+
+    struct Entry {
+        StringRef folder;
+        StringRef fileName;
+        StringRef extension;
+        StringRef searchKey;
+        uint64_t size;
+        int64_t mtime;
+        uint8_t category;
+        uint8_t flags;            // kFolderRelative
+        uint8_t reserved[6];
+        int64_t lastLaunched;
+    };
+
+    static_assert(sizeof(Header) == 48 && sizeof(Entry) == 64, "On-disk layout changed - bump kVersion");
+
+    static constexpr uint8_t kFolderRelative = 0x01;
+
+    std::wstring baseFolder;      // Folder of the opened cache file
+    const uint8_t* data = nullptr;
+    size_t dataSize = 0;
+    void* fileHandle = nullptr;   // Platform handles for the mapping
+    void* mapHandle = nullptr;
+
+    const Header* GetHeader() const;
+    std::wstring ReadString(const StringRef& ref) const;
+};
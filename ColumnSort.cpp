@@ -0,0 +1,144 @@
+#include "ColumnSort.h"
+#include <algorithm>
+#include <thread>
+
+//////////////////////////////////////////////////////////////////////
+// PackText: Four 16-bit units, first one most significant; shorter
+//           text is padded with 0 so a prefix sorts first
+//////////////////////////////////////////////////////////////////////
+uint64_t ColumnSort::PackText(const std::wstring& text) {
+    uint64_t key = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        uint16_t unit = i < text.size() ? static_cast<uint16_t>(text[i]) : 0;
+        key = (key << 16) | unit;
+    }
+    return key;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Sort: Each thread sorts one contiguous chunk, then neighbouring
+//       chunks are merged pairwise (also in parallel) between two
+//       buffers until one run is left
+//////////////////////////////////////////////////////////////////////
+void ColumnSort::Sort(std::vector<SortKey>& keys, const TieCompare& tie, unsigned threads) {
+    auto less = [&tie](const SortKey& a, const SortKey& b) {
+        if (a.key != b.key)
+            return a.key < b.key;
+        if (tie) {
+            int result = tie(a.id, b.id);
+            if (result != 0)
+                return result < 0;
+        }
+        return a.id < b.id;
+    };
+
+    if (threads == 0)
+        threads = (std::max)(1u, std::thread::hardware_concurrency());
+
+    const size_t count = keys.size();
+    const size_t chunks = (std::min)(static_cast<size_t>(threads), count / kParallelMinimum);
+    if (chunks < 2) {
+        std::sort(keys.begin(), keys.end(), less);
+        return;
+    }
+
+    // Run boundaries: run i is [bounds[i], bounds[i + 1])
+    std::vector<size_t> bounds;
+    for (size_t i = 0; i <= chunks; ++i)
+        bounds.push_back(count * i / chunks);
+
+    {
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < chunks; ++i) {
+            workers.emplace_back([&, i]() {
+                std::sort(keys.begin() + bounds[i], keys.begin() + bounds[i + 1], less);
+            });
+        }
+        std::sort(keys.begin(), keys.begin() + bounds[1], less);
+        for (auto& worker : workers)
+            worker.join();
+    }
+
+    std::vector<SortKey> buffer(count);
+    std::vector<SortKey>* source = &keys;
+    std::vector<SortKey>* target = &buffer;
+
+    while (bounds.size() > 2) {
+        std::vector<size_t> merged;
+        std::vector<std::thread> workers;
+
+        for (size_t i = 0; i + 1 < bounds.size(); i += 2) {
+            merged.push_back(bounds[i]);
+            const size_t begin = bounds[i];
+            const size_t middle = bounds[i + 1];
+            const size_t end = i + 2 < bounds.size() ? bounds[i + 2] : middle;   // Odd run out: copied
+
+            workers.emplace_back([=, &less]() {
+                std::merge(source->begin() + begin, source->begin() + middle,
+                    source->begin() + middle, source->begin() + end,
+                    target->begin() + begin, less);
+            });
+        }
+        merged.push_back(count);
+
+        for (auto& worker : workers)
+            worker.join();
+
+        bounds.swap(merged);
+        std::swap(source, target);
+    }
+
+    if (source != &keys)
+        keys.swap(*source);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Build: Descending is the ascending order reversed
+//////////////////////////////////////////////////////////////////////
+void ColumnSort::Build(std::vector<SortKey>&& keys, bool descending, const TieCompare& tie) {
+    Sort(keys, tie);
+
+    const size_t count = keys.size();
+    order.resize(count);
+    rank.resize(count);
+    for (size_t i = 0; i < count; ++i)
+        order[descending ? count - 1 - i : i] = keys[i].id;
+    for (size_t i = 0; i < count; ++i)
+        rank[order[i]] = static_cast<uint32_t>(i);
+
+    marks.assign(count, 0);
+    built = true;
+}
+
+void ColumnSort::Clear() {
+    order.clear();
+    rank.clear();
+    marks.clear();
+    built = false;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Arrange: Small subsets sort by rank (integer compares); large ones
+//          are picked out of the full order in one linear pass
+//////////////////////////////////////////////////////////////////////
+void ColumnSort::Arrange(std::vector<uint32_t>& ids) const {
+    if (ids.size() < 2)
+        return;
+
+    if (ids.size() * 16 < order.size()) {
+        std::sort(ids.begin(), ids.end(),
+            [this](uint32_t a, uint32_t b) { return rank[a] < rank[b]; });
+        return;
+    }
+
+    for (uint32_t id : ids)
+        marks[id] = 1;
+
+    ids.clear();
+    for (uint32_t id : order) {
+        if (marks[id]) {
+            marks[id] = 0;
+            ids.push_back(id);
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>             // size_t
+#include <cstdint>             // Packed keys, ids
+#include <functional>          // Tie comparer
+#include <string>              // Text keys
+#include <vector>              // Key, order and rank arrays
+
+////////////////////////////////////////////////////////////////////////
+// Struct: SortKey
+// Purpose: One row of a sort: the column value packed into 64 bits
+//          (numbers exactly, text by its first four UTF-16 units) and
+//          the row id. Rows are compared as integers; only equal keys
+//          of a text column fall back to comparing the strings.
+////////////////////////////////////////////////////////////////////////
+struct SortKey {
+    uint64_t key;
+    uint32_t id;
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: ColumnSort
+// Purpose: Sorted order of one catalog column.
+//          Build sorts the packed keys once (split across threads for
+//          large catalogs, then merged) and keeps order[] and its
+//          inverse rank[]. Any subset of rows - a search result, a
+//          refined search result - is put in column order by Arrange,
+//          which only looks at ranks and never compares values again.
+////////////////////////////////////////////////////////////////////////
+class ColumnSort {
+public:
+    // Full comparison of rows whose keys are equal (<0, 0, >0);
+    // may be empty. Called from several threads at once.
+    using TieCompare = std::function<int(uint32_t a, uint32_t b)>;
+
+    // Text is expected normalized (e.g. lowercase) by the caller
+    static uint64_t PackText(const std::wstring& text);
+    static uint64_t PackSigned(int64_t value) { return static_cast<uint64_t>(value) ^ (1ull << 63); }
+
+    // Ascending by key, then tie comparer, then id. `threads` 0 = all cores.
+    static void Sort(std::vector<SortKey>& keys, const TieCompare& tie, unsigned threads = 0);
+
+    // keys[i].id must be a permutation of 0..keys.size()-1
+    void Build(std::vector<SortKey>&& keys, bool descending, const TieCompare& tie);
+    void Clear();
+    bool IsBuilt() const { return built; }
+
+    const std::vector<uint32_t>& GetOrder() const { return order; }
+
+    // Reorders ids (a subset of the built rows) into column order
+    void Arrange(std::vector<uint32_t>& ids) const;
+
+private:
+    std::vector<uint32_t> order;   // order[position] = id
+    std::vector<uint32_t> rank;    // rank[id] = position
+    bool built = false;
+    mutable std::vector<uint8_t> marks;   // Arrange scratch, all zero between calls
+
+    static constexpr size_t kParallelMinimum = 1u << 15;   // Rows per sorting thread
+};
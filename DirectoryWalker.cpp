@@ -0,0 +1,316 @@
+#include "DirectoryWalker.h"
+#include <algorithm>
+#include <filesystem>
+#include <iterator>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+//////////////////////////////////////////////////////////////////////
+// FillPathFields: Splits a path into the WalkedFile name fields
+//////////////////////////////////////////////////////////////////////
+static void FillPathFields(const fs::path& path, WalkedFile& file) {
+    file.path = path.wstring();
+    file.folder = path.parent_path().wstring();
+    file.name = path.stem().wstring();
+}
+
+//////////////////////////////////////////////////////////////////////
+// Constructor: Copies options and resolves the worker count
+//////////////////////////////////////////////////////////////////////
+DirectoryWalker::DirectoryWalker(const WalkOptions& opts) : options(opts) {
+    if (options.threadCount == 0) {
+        options.threadCount = std::max(2u, std::thread::hardware_concurrency());
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// Destructor
+//////////////////////////////////////////////////////////////////////
+DirectoryWalker::~DirectoryWalker() {}
+
+//////////////////////////////////////////////////////////////////////
+// Walk: Runs the workers and merges their results
+//////////////////////////////////////////////////////////////////////
+std::vector<WalkedFile> DirectoryWalker::Walk() {
+    batchCallback = nullptr;
+    Run();
+
+    // Merge per-worker lists
+    size_t total = 0;
+    for (const auto& list : results)
+        total += list.size();
+
+    std::vector<WalkedFile> merged;
+    merged.reserve(total);
+    for (auto& list : results) {
+        std::move(list.begin(), list.end(), std::back_inserter(merged));
+    }
+    results.clear();
+
+    // Work stealing makes discovery order random; sort for a stable grid
+    std::sort(merged.begin(), merged.end(),
+        [](const WalkedFile& a, const WalkedFile& b) { return a.path < b.path; });
+
+    return merged;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Walk (streaming): Same traversal, results leave through the callback
+//////////////////////////////////////////////////////////////////////
+void DirectoryWalker::Walk(const BatchCallback& onBatch, size_t batchSize) {
+    batchCallback = &onBatch;
+    streamBatchSize = std::max<size_t>(1, batchSize);
+    Run();
+    batchCallback = nullptr;
+    results.clear();
+}
+
+//////////////////////////////////////////////////////////////////////
+// Run: Seeds the roots and runs one thread per worker queue
+//////////////////////////////////////////////////////////////////////
+void DirectoryWalker::Run() {
+    const size_t workerCount = options.threadCount;
+
+    queues.clear();
+    results.clear();
+    results.resize(workerCount);
+    hasFlushed.assign(workerCount, 0);
+    for (size_t i = 0; i < workerCount; ++i)
+        queues.push_back(std::make_unique<WorkerQueue>());
+
+    pendingItems = 0;
+    queuedItems = 0;
+    sleepingWorkers = 0;
+    directoryCount = 0;
+
+    // Spread roots round-robin so several roots start in parallel
+    size_t nextWorker = 0;
+    for (const auto& root : options.roots) {
+        std::error_code ec;
+        if (root.empty() || !fs::is_directory(root, ec))
+            continue;
+
+        Push(nextWorker, { root, 0 });
+        nextWorker = (nextWorker + 1) % workerCount;
+    }
+
+    if (pendingItems > 0) {
+        std::vector<std::thread> workers;
+        workers.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; ++i)
+            workers.emplace_back(&DirectoryWalker::WorkerLoop, this, i);
+
+        for (auto& worker : workers)
+            worker.join();
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// FlushResults: Moves a worker's files out to the streaming callback
+//////////////////////////////////////////////////////////////////////
+void DirectoryWalker::FlushResults(size_t workerIndex) {
+    std::vector<WalkedFile>& found = results[workerIndex];
+    if (found.empty() || cancelled)
+        return;
+
+    hasFlushed[workerIndex] = 1;
+    std::vector<WalkedFile> batch;
+    batch.swap(found);
+    (*batchCallback)(std::move(batch));
+}
+
+//////////////////////////////////////////////////////////////////////
+// Cancel: Workers drop remaining work at their next check; sticky,
+//         so a cancel that arrives before Walk() still applies
+//////////////////////////////////////////////////////////////////////
+void DirectoryWalker::Cancel() {
+    cancelled = true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// WorkerLoop: Pop local work, otherwise steal, otherwise sleep until
+// something is queued or nothing is pending
+//////////////////////////////////////////////////////////////////////
+void DirectoryWalker::WorkerLoop(size_t workerIndex) {
+    WorkItem item;
+
+    while (pendingItems.load() > 0) {
+        if (PopLocal(workerIndex, item) || Steal(workerIndex, item)) {
+            if (!cancelled)
+                ScanDirectory(workerIndex, item);
+
+            // Subfolders were counted before this decrement, so the
+            // counter only reaches zero once the whole tree is done
+            if (pendingItems.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> guard(idleLock);
+                workAvailable.notify_all();
+            }
+            continue;
+        }
+
+        // Announced before the check, so Push either sees a sleeper or
+        // this worker sees the item (see Push)
+        std::unique_lock<std::mutex> guard(idleLock);
+        sleepingWorkers.fetch_add(1);
+        workAvailable.wait(guard, [this] { return queuedItems.load() > 0 || pendingItems.load() == 0; });
+        sleepingWorkers.fetch_sub(1);
+    }
+
+    if (batchCallback)
+        FlushResults(workerIndex);
+}
+
+//////////////////////////////////////////////////////////////////////
+// PopLocal: LIFO pop keeps each worker inside its own subtree
+//////////////////////////////////////////////////////////////////////
+bool DirectoryWalker::PopLocal(size_t workerIndex, WorkItem& item) {
+    WorkerQueue& queue = *queues[workerIndex];
+    std::lock_guard<std::mutex> guard(queue.lock);
+
+    if (queue.items.empty())
+        return false;
+
+    item = std::move(queue.items.back());
+    queue.items.pop_back();
+    queuedItems.fetch_sub(1);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Steal: FIFO steal takes the shallowest (largest) pending subtree
+//////////////////////////////////////////////////////////////////////
+bool DirectoryWalker::Steal(size_t workerIndex, WorkItem& item) {
+    const size_t workerCount = queues.size();
+
+    for (size_t offset = 1; offset < workerCount; ++offset) {
+        WorkerQueue& victim = *queues[(workerIndex + offset) % workerCount];
+        std::unique_lock<std::mutex> guard(victim.lock, std::try_to_lock);
+
+        if (!guard.owns_lock() || victim.items.empty())
+            continue;
+
+        item = std::move(victim.items.front());
+        victim.items.pop_front();
+        queuedItems.fetch_sub(1);
+        return true;
+    }
+    return false;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Push: Counts the item as pending before it becomes visible, then
+// wakes one sleeping worker. Taking idleLock orders the notify after
+// a sleeper's check, so the wakeup cannot be lost
+//////////////////////////////////////////////////////////////////////
+void DirectoryWalker::Push(size_t workerIndex, WorkItem item) {
+    pendingItems.fetch_add(1);
+
+    {
+        WorkerQueue& queue = *queues[workerIndex];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        queue.items.push_back(std::move(item));
+    }
+    queuedItems.fetch_add(1);
+
+    if (sleepingWorkers.load() > 0) {
+        std::lock_guard<std::mutex> guard(idleLock);
+        workAvailable.notify_one();
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// ScanDirectory: Lists one folder without following symlinks/junctions
+//////////////////////////////////////////////////////////////////////
+void DirectoryWalker::ScanDirectory(size_t workerIndex, const WorkItem& item) {
+    std::error_code ec;
+    fs::directory_iterator it(item.directory, fs::directory_options::skip_permission_denied, ec);
+    if (ec)
+        return;
+
+    directoryCount.fetch_add(1);
+    std::vector<WalkedFile>& found = results[workerIndex];
+
+    for (; it != fs::directory_iterator(); it.increment(ec)) {
+        if (ec || cancelled)
+            break;
+
+        const fs::directory_entry& entry = *it;
+
+        // Links can form cycles; tools are never reached through them
+        if (entry.is_symlink(ec))
+            continue;
+
+        if (entry.is_directory(ec)) {
+            if (item.depth < options.maxDepth)
+                Push(workerIndex, { entry.path().wstring(), item.depth + 1 });
+            continue;
+        }
+
+        if (!entry.is_regular_file(ec))
+            continue;
+
+        const fs::path& path = entry.path();
+        std::wstring ext = NormalizeExtension(path.extension().wstring());
+        if (!IsSupportedExtension(ext))
+            continue;
+
+        WalkedFile file;
+        FillPathFields(path, file);
+        file.extension = std::move(ext);
+
+        // On Windows these come from the directory listing itself
+        file.size = entry.file_size(ec);
+        if (ec) file.size = 0;
+        auto writeTime = entry.last_write_time(ec);
+        file.mtime = ec ? 0 : static_cast<int64_t>(writeTime.time_since_epoch().count());
+
+        found.push_back(std::move(file));
+    }
+
+    if (batchCallback && (!hasFlushed[workerIndex] || found.size() >= streamBatchSize))
+        FlushResults(workerIndex);
+}
+
+//////////////////////////////////////////////////////////////////////
+// StatFile: Single-file version of what ScanDirectory records
+//////////////////////////////////////////////////////////////////////
+bool DirectoryWalker::StatFile(const std::wstring& pathText, WalkedFile& file) {
+    std::error_code ec;
+    fs::path path(pathText);
+
+    if (fs::is_symlink(path, ec) || !fs::is_regular_file(path, ec))
+        return false;
+
+    FillPathFields(path, file);
+    file.extension = NormalizeExtension(path.extension().wstring());
+
+    file.size = fs::file_size(path, ec);
+    if (ec) file.size = 0;
+    auto writeTime = fs::last_write_time(path, ec);
+    file.mtime = ec ? 0 : static_cast<int64_t>(writeTime.time_since_epoch().count());
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// IsSupportedExtension: Small list, linear search beats hashing here
+//////////////////////////////////////////////////////////////////////
+bool DirectoryWalker::IsSupportedExtension(const std::wstring& extension) const {
+    if (extension.empty())
+        return false;
+
+    return std::find(options.extensions.begin(), options.extensions.end(), extension)
+        != options.extensions.end();
+}
+
+//////////////////////////////////////////////////////////////////////
+// NormalizeExtension: ASCII-only lowercase, independent of locale
+//////////////////////////////////////////////////////////////////////
+std::wstring DirectoryWalker::NormalizeExtension(const std::wstring& extension) {
+    std::wstring result = extension;
+    for (auto& ch : result) {
+        if (ch >= L'A' && ch <= L'Z')
+            ch = static_cast<wchar_t>(ch - L'A' + L'a');
+    }
+    return result;
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>              // Pending-work counter and cancel flag shared by workers
+#include <condition_variable>  // Parks idle workers
+#include <cstdint>             // Fixed-width size / timestamp fields
+#include <deque>               // Per-worker double-ended work queues
+#include <functional>          // Streaming batch callback
+#include <memory>              // unique_ptr for non-movable queue objects
+#include <mutex>               // Guards each worker queue
+#include <string>              // std::wstring paths
+#include <vector>              // Result lists
+
+////////////////////////////////////////////////////////////////////////
+// Struct: WalkOptions
+// Purpose: Describes what DirectoryWalker should traverse.
+//          Kept free of Windows types so the walker builds on Linux.
+////////////////////////////////////////////////////////////////////////
+struct WalkOptions {
+    std::vector<std::wstring> roots;       // Folders to scan (missing roots are skipped)
+    std::vector<std::wstring> extensions;  // Lowercase extensions to keep, e.g. L".bat"
+    int maxDepth = 8;                      // 0 = root folder only, 1 = one level of subfolders...
+    unsigned threadCount = 0;              // 0 = one worker per hardware thread
+};
+
+////////////////////////////////////////////////////////////////////////
+// Struct: WalkedFile
+// Purpose: One matching file found during a walk
+////////////////////////////////////////////////////////////////////////
+struct WalkedFile {
+    std::wstring path;       // Full path of the file
+    std::wstring folder;     // Parent folder of the file
+    std::wstring name;       // File name without extension
+    std::wstring extension;  // Lowercase extension including the dot
+    uint64_t size = 0;       // File size in bytes
+    int64_t mtime = 0;       // Last write time (file_time_type ticks)
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: DirectoryWalker
+// Purpose: Recursively walks several root folders in parallel.
+//          Each worker owns a deque of pending directories: it pushes
+//          and pops subfolders at the back (depth-first, cache friendly)
+//          and steals from the front of other workers when it runs dry,
+//          so wide and deep trees both keep every core busy. Workers with
+//          nothing to steal sleep until a directory is queued, so one slow
+//          folder (a network share) does not keep the other cores spinning.
+////////////////////////////////////////////////////////////////////////
+class DirectoryWalker {
+public:
+    // Called from worker threads with unsorted batches - must be thread safe
+    using BatchCallback = std::function<void(std::vector<WalkedFile>&& batch)>;
+
+    explicit DirectoryWalker(const WalkOptions& options);
+    ~DirectoryWalker();
+
+    // Walks all roots and returns every matching file, sorted by path
+    std::vector<WalkedFile> Walk();
+
+    // Walks all roots and streams files as they are found. Each worker
+    // hands over its first directory immediately (fast first results),
+    // then batches of at least batchSize files.
+    void Walk(const BatchCallback& onBatch, size_t batchSize = 128);
+
+    // Requests running workers to stop early (safe from any thread)
+    void Cancel();
+
+    // Returns the number of directories visited by the last walk
+    size_t GetDirectoryCount() const { return directoryCount.load(); }
+
+    // Fills a WalkedFile for a single path; false if it is not a regular file
+    static bool StatFile(const std::wstring& path, WalkedFile& file);
+
+    // Lowercases the ASCII letters of an extension (".BAT" -> ".bat")
+    static std::wstring NormalizeExtension(const std::wstring& extension);
+
+private:
+    struct WorkItem {
+        std::wstring directory;
+        int depth = 0;
+    };
+
+    struct WorkerQueue {
+        std::mutex lock;
+        std::deque<WorkItem> items;
+    };
+
+    WalkOptions options;
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::vector<WalkedFile>> results;   // One result list per worker, merged at the end
+    std::vector<char> hasFlushed;                   // Streaming: worker already sent a batch
+    const BatchCallback* batchCallback = nullptr;   // Streaming mode when set
+    size_t streamBatchSize = 0;
+    std::atomic<size_t> pendingItems{ 0 };          // Queued + in-progress directories
+    std::atomic<size_t> queuedItems{ 0 };           // Queued only: what an idle worker could steal
+    std::atomic<size_t> sleepingWorkers{ 0 };
+    std::mutex idleLock;                            // Pairs with workAvailable
+    std::condition_variable workAvailable;          // New item queued, or the walk is done
+    std::atomic<size_t> directoryCount{ 0 };
+    std::atomic<bool> cancelled{ false };
+
+    // Seeds the roots and runs the workers to completion
+    void Run();
+
+    // Streaming mode: hands a worker's collected files to the callback
+    void FlushResults(size_t workerIndex);
+
+    // Main loop of one worker thread
+    void WorkerLoop(size_t workerIndex);
+
+    // Takes the newest item from the worker's own queue
+    bool PopLocal(size_t workerIndex, WorkItem& item);
+
+    // Takes the oldest item from another worker's queue
+    bool Steal(size_t workerIndex, WorkItem& item);
+
+    // Queues a directory on the given worker
+    void Push(size_t workerIndex, WorkItem item);
+
+    // Lists one directory: files go to results, subfolders to the queue
+    void ScanDirectory(size_t workerIndex, const WorkItem& item);
+
+    // Checks a normalized extension against options.extensions
+    bool IsSupportedExtension(const std::wstring& extension) const;
+};
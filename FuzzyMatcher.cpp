@@ -0,0 +1,187 @@
+#include "FuzzyMatcher.h"
+#include <algorithm>
+
+namespace {
+    // Score weights, tuned so a contiguous word-start match always beats
+    // a scattered one and a prefix match beats the same match mid-name
+    const int kMatch = 16;          // Every matched character
+    const int kWordStart = 10;      // Match right after a separator
+    const int kNamePrefix = 12;     // Match on the first character of the name
+    const int kConsecutive = 6;     // Per character continuing a run
+    const int kMaxGapPenalty = 8;   // Cap for one gap between matches
+    const int kMaxLeadPenalty = 6;  // Cap for unmatched characters before the match
+
+    //////////////////////////////////////////////////////////////////////
+    // CharBit: a-z, 0-9 and ' ' get their own bit, the rest share 27
+    //////////////////////////////////////////////////////////////////////
+    inline uint64_t CharBit(wchar_t ch) {
+        if (ch >= L'a' && ch <= L'z')
+            return 1ull << (ch - L'a');
+        if (ch >= L'0' && ch <= L'9')
+            return 1ull << (26 + ch - L'0');
+        if (ch == L' ')
+            return 1ull << 36;
+        return 1ull << (37 + static_cast<uint32_t>(ch) % 27);
+    }
+
+    inline bool IsSeparator(wchar_t ch) {
+        return ch == L' ' || ch == L'-' || ch == L'.' || ch == L'(' || ch == L'[';
+    }
+
+    inline bool IsCancelled(const std::atomic<bool>* cancelled) {
+        return cancelled && cancelled->load(std::memory_order_relaxed);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// Constructor: Query mask is computed once per query
+//////////////////////////////////////////////////////////////////////
+FuzzyMatcher::FuzzyMatcher(const std::wstring& text)
+    : query(text), queryMask(CharMask(text.data(), text.size())) {}
+
+//////////////////////////////////////////////////////////////////////
+// CharMask
+//////////////////////////////////////////////////////////////////////
+uint64_t FuzzyMatcher::CharMask(const wchar_t* key, size_t length) {
+    uint64_t mask = 0;
+    for (size_t i = 0; i < length; ++i)
+        mask |= CharBit(key[i]);
+    return mask;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Score: Forward pass finds where the first complete match ends, a
+//        backward pass from there finds the tightest start, and the
+//        window in between is scored. No allocation, O(key length).
+//////////////////////////////////////////////////////////////////////
+int FuzzyMatcher::Score(const wchar_t* key, size_t length) const {
+    const size_t queryLength = query.size();
+    if (queryLength == 0)
+        return 0;
+    if (queryLength > length)
+        return kNoMatch;
+
+    // Forward: end of the earliest complete subsequence
+    size_t qi = 0;
+    size_t end = length;
+    for (size_t i = 0; i < length; ++i) {
+        if (key[i] == query[qi] && ++qi == queryLength) {
+            end = i;
+            break;
+        }
+    }
+    if (end == length)
+        return kNoMatch;
+
+    // Backward: latest start that still completes the match by `end`
+    size_t start = end;
+    qi = queryLength;
+    for (size_t i = end + 1; i-- > 0;) {
+        if (key[i] == query[qi - 1] && --qi == 0) {
+            start = i;
+            break;
+        }
+    }
+
+    // Score the greedy alignment inside [start, end]
+    int score = -(std::min)(static_cast<int>(start), kMaxLeadPenalty);
+    int run = 0;
+    size_t previous = start;
+    qi = 0;
+
+    for (size_t i = start; i <= end && qi < queryLength; ++i) {
+        if (key[i] != query[qi])
+            continue;
+
+        score += kMatch;
+        if (i == 0)
+            score += kNamePrefix + kWordStart;
+        else if (IsSeparator(key[i - 1]))
+            score += kWordStart;
+
+        if (qi > 0 && i == previous + 1) {
+            ++run;
+            score += kConsecutive * run;
+        }
+        else {
+            if (qi > 0)
+                score -= (std::min)(static_cast<int>(i - previous - 1), kMaxGapPenalty);
+            run = 0;
+        }
+
+        previous = i;
+        ++qi;
+    }
+
+    return score;
+}
+
+//////////////////////////////////////////////////////////////////////
+// ScoreBatch: Tight loop over candidate ids
+//////////////////////////////////////////////////////////////////////
+void FuzzyMatcher::ScoreBatch(const FuzzyKeyTable& table, const uint32_t* ids, size_t count,
+    std::vector<FuzzyHit>& hits, const std::atomic<bool>* cancelled) const {
+    for (size_t i = 0; i < count; ++i) {
+        if (i % kCancelStride == 0 && IsCancelled(cancelled))
+            return;
+
+        const uint32_t id = ids[i];
+        if ((table.masks[id] & queryMask) != queryMask)
+            continue;
+
+        const uint32_t begin = table.offsets[id];
+        int score = Score(table.text + begin, table.offsets[id + 1] - begin);
+        if (score != kNoMatch)
+            hits.push_back({ id, score });
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// ScoreAll: Walks the table once, stepping over excluded ids
+//////////////////////////////////////////////////////////////////////
+void FuzzyMatcher::ScoreAll(const FuzzyKeyTable& table, const std::vector<uint32_t>& exclude,
+    std::vector<FuzzyHit>& hits, const std::atomic<bool>* cancelled) const {
+    size_t skip = 0;
+
+    for (uint32_t id = 0; id < table.count; ++id) {
+        if (id % kCancelStride == 0 && IsCancelled(cancelled))
+            return;
+
+        if ((table.masks[id] & queryMask) != queryMask)
+            continue;
+
+        while (skip < exclude.size() && exclude[skip] < id)
+            ++skip;
+        if (skip < exclude.size() && exclude[skip] == id)
+            continue;
+
+        const uint32_t begin = table.offsets[id];
+        int score = Score(table.text + begin, table.offsets[id + 1] - begin);
+        if (score != kNoMatch)
+            hits.push_back({ id, score });
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// Rank: Sorts packed 64-bit keys (score, length, id) instead of calling
+//       a three-way comparator that chases key offsets
+//////////////////////////////////////////////////////////////////////
+void FuzzyMatcher::Rank(const FuzzyKeyTable& table, std::vector<FuzzyHit>& hits,
+    std::vector<uint64_t>& keys) {
+    keys.clear();
+
+    for (const auto& hit : hits) {
+        // Higher score must sort first: store its distance from the maximum
+        int clamped = (std::max)(-0x8000, (std::min)(hit.score, 0x7FFF));
+        uint64_t scoreBits = static_cast<uint64_t>(0x7FFF - clamped);
+        uint64_t length = (std::min<uint32_t>)(table.offsets[hit.id + 1] - table.offsets[hit.id], 0xFFFF);
+        keys.push_back((scoreBits << 48) | (length << 32) | hit.id);
+    }
+
+    std::sort(keys.begin(), keys.end());
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        int score = 0x7FFF - static_cast<int>(keys[i] >> 48);
+        hits[i] = { static_cast<uint32_t>(keys[i]), score };
+    }
+}
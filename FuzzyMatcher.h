@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>              // Cancellation flag
+#include <cstddef>             // size_t
+#include <cstdint>             // 64-bit character masks
+#include <string>              // std::wstring query
+#include <vector>              // Hit lists
+
+////////////////////////////////////////////////////////////////////////
+// Struct: FuzzyHit
+// Purpose: One scored candidate (higher score = better match)
+////////////////////////////////////////////////////////////////////////
+struct FuzzyHit {
+    uint32_t id;
+    int score;
+};
+
+////////////////////////////////////////////////////////////////////////
+// Struct: FuzzyKeyTable
+// Purpose: Read-only view of the keys to score, as stored by SearchIndex:
+//          key i is text[offsets[i], offsets[i+1]), masks[i] its CharMask
+////////////////////////////////////////////////////////////////////////
+struct FuzzyKeyTable {
+    const wchar_t* text = nullptr;
+    const uint32_t* offsets = nullptr;
+    const uint64_t* masks = nullptr;
+    size_t count = 0;
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: FuzzyMatcher
+// Purpose: Subsequence matching with ranking. "cpyusr" matches
+//          "copy usermade" - every query character must appear in
+//          order. Scores reward word starts (' ' in keys is the '_' of
+//          the file name), a match at the very start of the name and runs
+//          of consecutive characters, and penalize gaps.
+//          Keys and query must already be normalized (MakeSearchKey).
+////////////////////////////////////////////////////////////////////////
+class FuzzyMatcher {
+public:
+    static constexpr int kNoMatch = -1;
+
+    explicit FuzzyMatcher(const std::wstring& query);
+
+    // One bit per character class present in the key (a-z, 0-9, ' ', other)
+    static uint64_t CharMask(const wchar_t* key, size_t length);
+
+    // Scores one key; kNoMatch if the query is not a subsequence of it
+    int Score(const wchar_t* key, size_t length) const;
+
+    // Scores the given ids; entries failing the mask test cost one AND.
+    // Both loops stop early (with partial hits) once `cancelled` is set.
+    void ScoreBatch(const FuzzyKeyTable& table, const uint32_t* ids, size_t count,
+        std::vector<FuzzyHit>& hits, const std::atomic<bool>* cancelled = nullptr) const;
+
+    // Scores every id of the table except the ascending ids in `exclude`
+    void ScoreAll(const FuzzyKeyTable& table, const std::vector<uint32_t>& exclude,
+        std::vector<FuzzyHit>& hits, const std::atomic<bool>* cancelled = nullptr) const;
+
+    // Loops poll the cancellation flag once per this many ids
+    static constexpr uint32_t kCancelStride = 1024;
+
+    // Best score first; ties go to the shorter key, then the lower id.
+    // sortKeys is a reusable work buffer.
+    static void Rank(const FuzzyKeyTable& table, std::vector<FuzzyHit>& hits,
+        std::vector<uint64_t>& sortKeys);
+
+private:
+    std::wstring query;
+    uint64_t queryMask = 0;
+};
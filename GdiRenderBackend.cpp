@@ -0,0 +1,124 @@
+#include "GdiRenderBackend.h"
+
+static COLORREF ToColorRef(RenderColor color) {
+    return RGB((color >> 16) & 0xFF, (color >> 8) & 0xFF, color & 0xFF);
+}
+
+GdiRenderBackend::GdiRenderBackend(HDC hdc, RenderResources& resources, Graphics* graphics)
+    : hdc(hdc), resources(resources), graphics(graphics) {}
+
+Graphics* GdiRenderBackend::GetGraphics() {
+    if (!graphics) {
+        ownGraphics = std::make_unique<Graphics>(hdc);
+        ownGraphics->SetSmoothingMode(SmoothingModeAntiAlias);
+        graphics = ownGraphics.get();
+    }
+    return graphics;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : GetFont
+// Purpose  : The fonts ToolRenderer and the window chrome already use
+//////////////////////////////////////////////////////////////////////
+HFONT GdiRenderBackend::GetFont(RenderResources& resources, RenderFont font) {
+    switch (font) {
+    case RenderFont::Title:    return resources.GetFont(32, FW_SEMIBOLD, L"Segoe UI Variable");
+    case RenderFont::Subtitle: return resources.GetFont(14, FW_NORMAL, L"Segoe UI Variable Text");
+    case RenderFont::Label:    return resources.GetFont(20, FW_BOLD, L"Segoe UI");
+    case RenderFont::Row:      return resources.GetFont(18, FW_SEMIBOLD, L"Segoe UI");
+    default:                   return resources.GetFont(15, FW_NORMAL, L"Segoe UI");
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : FillRect
+// Purpose  : Opaque fills stay in GDI; translucent ones need GDI+
+//////////////////////////////////////////////////////////////////////
+void GdiRenderBackend::FillRect(int x, int y, int width, int height, RenderColor color) {
+    if ((color >> 24) == 0xFF) {
+        RECT rect = { x, y, x + width, y + height };
+        ::FillRect(hdc, &rect, resources.GetBrush(ToColorRef(color)));
+        return;
+    }
+    GetGraphics()->FillRectangle(resources.GetSolidBrush(Color(color)), x, y, width, height);
+}
+
+void GdiRenderBackend::FillVerticalGradient(int x, int y, int width, int height,
+    RenderColor top, RenderColor bottom) {
+    // The cached brush runs from y = 0; move the origin instead of the brush
+    Graphics* target = GetGraphics();
+    target->TranslateTransform(static_cast<REAL>(x), static_cast<REAL>(y));
+    target->FillRectangle(resources.GetVerticalGradient(height, Color(top), Color(bottom)), 0, 0, width, height);
+    target->ResetTransform();
+}
+
+void GdiRenderBackend::FillRoundedRect(int x, int y, int width, int height, int radius, RenderColor color) {
+    Graphics* target = GetGraphics();
+    target->TranslateTransform(static_cast<REAL>(x), static_cast<REAL>(y));
+    target->FillPath(resources.GetSolidBrush(Color(color)), resources.GetRoundedRect(width, height, radius));
+    target->ResetTransform();
+}
+
+void GdiRenderBackend::StrokeRoundedRect(int x, int y, int width, int height, int radius,
+    float penWidth, RenderColor color) {
+    Graphics* target = GetGraphics();
+    target->TranslateTransform(static_cast<REAL>(x), static_cast<REAL>(y));
+    target->DrawPath(resources.GetSolidPen(Color(color), penWidth), resources.GetRoundedRect(width, height, radius));
+    target->ResetTransform();
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : DrawImage
+// Purpose  : HBITMAPs are blitted (HALFTONE when scaled); pixel images
+//            go through StretchDIBits (opaque: alpha is ignored)
+//////////////////////////////////////////////////////////////////////
+void GdiRenderBackend::DrawImage(int x, int y, int width, int height, const RenderImage& image) {
+    if (image.native) {
+        HDC memDC = resources.GetMemoryDC();
+        HBITMAP oldBitmap = (HBITMAP)SelectObject(memDC, (HBITMAP)image.native);
+        if (width == image.width && height == image.height) {
+            BitBlt(hdc, x, y, width, height, memDC, image.left, image.top, SRCCOPY);
+        }
+        else {
+            int oldMode = SetStretchBltMode(hdc, HALFTONE);
+            StretchBlt(hdc, x, y, width, height, memDC, image.left, image.top, image.width, image.height, SRCCOPY);
+            SetStretchBltMode(hdc, oldMode);
+        }
+        SelectObject(memDC, oldBitmap);
+    }
+    else if (image.pixels) {
+        BITMAPINFO info = {};
+        info.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+        info.bmiHeader.biWidth = image.width;
+        info.bmiHeader.biHeight = -image.height;   // Top-down
+        info.bmiHeader.biPlanes = 1;
+        info.bmiHeader.biBitCount = 32;
+        info.bmiHeader.biCompression = BI_RGB;
+        StretchDIBits(hdc, x, y, width, height, 0, 0, image.width, image.height,
+            image.pixels, &info, DIB_RGB_COLORS, SRCCOPY);
+    }
+}
+
+int GdiRenderBackend::GetLineHeight(RenderFont font) {
+    HFONT oldFont = (HFONT)SelectObject(hdc, GetFont(resources, font));
+    TEXTMETRIC tm = {};
+    GetTextMetrics(hdc, &tm);
+    SelectObject(hdc, oldFont);
+    return tm.tmHeight;
+}
+
+void GdiRenderBackend::MeasureText(RenderFont font, const wchar_t* text, size_t length, int* extents) {
+    HFONT oldFont = (HFONT)SelectObject(hdc, GetFont(resources, font));
+    SIZE extent = {};
+    GetTextExtentExPoint(hdc, text, static_cast<int>(length), 0, nullptr, extents, &extent);
+    SelectObject(hdc, oldFont);
+}
+
+void GdiRenderBackend::DrawString(RenderFont font, int x, int y, const wchar_t* text, size_t length,
+    RenderColor color) {
+    HFONT oldFont = (HFONT)SelectObject(hdc, GetFont(resources, font));
+    SetBkMode(hdc, TRANSPARENT);
+    SetTextColor(hdc, ToColorRef(color));
+    TextOut(hdc, x, y, text, static_cast<int>(length));
+    SelectObject(hdc, oldFont);
+}
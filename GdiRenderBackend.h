@@ -0,0 +1,46 @@
+#pragma once
+
+#include <windows.h>
+#include <gdiplus.h>           // Anti-aliased shapes
+#include <memory>              // Owned Graphics
+#include "RenderBackend.h"
+#include "RenderResources.h"
+using namespace Gdiplus;
+
+///////////////////////////////////////////////////////////////////////////////
+// Class: GdiRenderBackend
+// Purpose: RenderBackend over a device context: GDI+ for anti-aliased
+//          shapes and gradients, GDI for bitmaps and text. Every object
+//          comes from the shared RenderResources, so a backend is cheap to
+//          make per call. Without a `graphics` it creates its own on first
+//          use (sprite DCs must not take over the back buffer's one).
+///////////////////////////////////////////////////////////////////////////////
+class GdiRenderBackend : public RenderBackend
+{
+public:
+    GdiRenderBackend(HDC hdc, RenderResources& resources, Graphics* graphics = nullptr);
+
+    void FillRect(int x, int y, int width, int height, RenderColor color) override;
+    void FillVerticalGradient(int x, int y, int width, int height,
+        RenderColor top, RenderColor bottom) override;
+    void FillRoundedRect(int x, int y, int width, int height, int radius, RenderColor color) override;
+    void StrokeRoundedRect(int x, int y, int width, int height, int radius,
+        float penWidth, RenderColor color) override;
+    void DrawImage(int x, int y, int width, int height, const RenderImage& image) override;
+
+    int GetLineHeight(RenderFont font) override;
+    void MeasureText(RenderFont font, const wchar_t* text, size_t length, int* extents) override;
+    void DrawString(RenderFont font, int x, int y, const wchar_t* text, size_t length,
+        RenderColor color) override;
+
+    // The window's font for a logical font
+    static HFONT GetFont(RenderResources& resources, RenderFont font);
+
+private:
+    HDC hdc;
+    RenderResources& resources;
+    Graphics* graphics;
+    std::unique_ptr<Graphics> ownGraphics;
+
+    Graphics* GetGraphics();
+};
@@ -0,0 +1,563 @@
+#include "GlyphAtlas.h"
+
+// DejaVu Sans 14px (Bitstream Vera / DejaVu license), ASCII 32-126,
+// rasterized once with FreeType grayscale and quantized to 4 bits.
+
+const GlyphAtlas::Glyph GlyphAtlas::kGlyphs[GlyphAtlas::kGlyphCount] = {
+    {     0,  4,  0,  4 },   // ' '
+    {    34,  6,  0,  6 },   // '!'
+    {    85,  6,  0,  6 },   // '"'
+    {   136, 12,  0, 12 },   // '#'
+    {   238,  9,  0,  9 },   // '$'
+    {   323, 13,  0, 13 },   // '%'
+    {   442, 11,  0, 11 },   // '&'
+    {   544,  4,  0,  4 },   // "'"
+    {   578,  5,  0,  5 },   // '('
+    {   629,  5,  0,  5 },   // ')'
+    {   680,  7,  0,  7 },   // '*'
+    {   748, 12,  0, 12 },   // '+'
+    {   850,  4,  0,  4 },   // ','
+    {   884,  5,  0,  5 },   // '-'
+    {   935,  4,  0,  4 },   // '.'
+    {   969,  5,  0,  5 },   // '/'
+    {  1020,  9,  0,  9 },   // '0'
+    {  1105,  9,  0,  9 },   // '1'
+    {  1190,  9,  0,  9 },   // '2'
+    {  1275,  9,  0,  9 },   // '3'
+    {  1360,  9,  0,  9 },   // '4'
+    {  1445,  9,  0,  9 },   // '5'
+    {  1530,  9,  0,  9 },   // '6'
+    {  1615,  9,  0,  9 },   // '7'
+    {  1700,  9,  0,  9 },   // '8'
+    {  1785,  9,  0,  9 },   // '9'
+    {  1870,  5,  0,  5 },   // ':'
+    {  1921,  5,  0,  5 },   // ';'
+    {  1972, 12,  0, 12 },   // '<'
+    {  2074, 12,  0, 12 },   // '='
+    {  2176, 12,  0, 12 },   // '>'
+    {  2278,  7,  0,  7 },   // '?'
+    {  2346, 14,  0, 14 },   // '@'
+    {  2465, 10,  0, 10 },   // 'A'
+    {  2550, 10,  0, 10 },   // 'B'
+    {  2635, 10,  0, 10 },   // 'C'
+    {  2720, 11,  0, 11 },   // 'D'
+    {  2822,  9,  0,  9 },   // 'E'
+    {  2907,  8,  0,  8 },   // 'F'
+    {  2975, 11,  0, 11 },   // 'G'
+    {  3077, 11,  0, 11 },   // 'H'
+    {  3179,  4,  0,  4 },   // 'I'
+    {  3213,  5, -1,  4 },   // 'J'
+    {  3264, 10,  0,  9 },   // 'K'
+    {  3349,  8,  0,  8 },   // 'L'
+    {  3417, 12,  0, 12 },   // 'M'
+    {  3519, 10,  0, 10 },   // 'N'
+    {  3604, 11,  0, 11 },   // 'O'
+    {  3706,  8,  0,  8 },   // 'P'
+    {  3774, 11,  0, 11 },   // 'Q'
+    {  3876, 10,  0, 10 },   // 'R'
+    {  3961,  9,  0,  9 },   // 'S'
+    {  4046, 10, -1,  9 },   // 'T'
+    {  4131, 10,  0, 10 },   // 'U'
+    {  4216, 10,  0, 10 },   // 'V'
+    {  4301, 14,  0, 14 },   // 'W'
+    {  4420, 10,  0, 10 },   // 'X'
+    {  4505, 10, -1,  9 },   // 'Y'
+    {  4590, 10,  0, 10 },   // 'Z'
+    {  4675,  5,  0,  5 },   // '['
+    {  4726,  5,  0,  5 },   // '\\'
+    {  4777,  5,  0,  5 },   // ']'
+    {  4828, 12,  0, 12 },   // '^'
+    {  4930,  9, -1,  7 },   // '_'
+    {  5015,  7,  0,  7 },   // '`'
+    {  5083,  9,  0,  9 },   // 'a'
+    {  5168,  9,  0,  9 },   // 'b'
+    {  5253,  8,  0,  8 },   // 'c'
+    {  5321,  9,  0,  9 },   // 'd'
+    {  5406,  9,  0,  9 },   // 'e'
+    {  5491,  6,  0,  5 },   // 'f'
+    {  5542,  9,  0,  9 },   // 'g'
+    {  5627,  9,  0,  9 },   // 'h'
+    {  5712,  4,  0,  4 },   // 'i'
+    {  5746,  5, -1,  4 },   // 'j'
+    {  5797,  9,  0,  8 },   // 'k'
+    {  5882,  4,  0,  4 },   // 'l'
+    {  5916, 14,  0, 14 },   // 'm'
+    {  6035,  9,  0,  9 },   // 'n'
+    {  6120,  9,  0,  9 },   // 'o'
+    {  6205,  9,  0,  9 },   // 'p'
+    {  6290,  9,  0,  9 },   // 'q'
+    {  6375,  6,  0,  6 },   // 'r'
+    {  6426,  7,  0,  7 },   // 's'
+    {  6494,  6,  0,  5 },   // 't'
+    {  6545,  9,  0,  9 },   // 'u'
+    {  6630,  8,  0,  8 },   // 'v'
+    {  6698, 11,  0, 11 },   // 'w'
+    {  6800,  8,  0,  8 },   // 'x'
+    {  6868,  8,  0,  8 },   // 'y'
+    {  6936,  7,  0,  7 },   // 'z'
+    {  7004,  9,  0,  9 },   // '{'
+    {  7089,  5,  0,  5 },   // '|'
+    {  7140,  9,  0,  9 },   // '}'
+    {  7225, 12,  0, 12 },   // '~'
+};
+
+const uint8_t GlyphAtlas::kCoverage[7327] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x00, 0x00, 0xD8,
+    0x00, 0x00, 0xD8, 0x00, 0x00, 0xD7, 0x00, 0x00, 0xD7, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD8, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x81,
+    0xF1, 0x0A, 0x81, 0xF1, 0x0A, 0x81, 0xF1, 0x0A, 0x81, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xE2, 0x00,
+    0x00, 0x00, 0x5C, 0x03, 0xD0, 0x00, 0x00, 0x00, 0x88, 0x07, 0xA0, 0x00, 0x02, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xA0, 0x00, 0x01, 0xF1, 0x0E, 0x20, 0x00, 0x00, 0x06, 0xB0, 0x4D, 0x00, 0x00, 0x0E, 0xFF,
+    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0D, 0x30, 0xC5, 0x00, 0x00, 0x00, 0x2E, 0x01, 0xF1, 0x00, 0x00,
+    0x00, 0x5B, 0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xA0,
+    0x00, 0x00, 0x01, 0x9D, 0xFC, 0x60, 0x00, 0x09, 0xC2, 0xA3, 0x92, 0x00, 0x0C, 0x70, 0xA0, 0x00,
+    0x00, 0x09, 0xD3, 0xA0, 0x00, 0x00, 0x01, 0x8D, 0xFB, 0x60, 0x00, 0x00, 0x00, 0xB5, 0xE7, 0x00,
+    0x00, 0x00, 0xA0, 0x9B, 0x00, 0x0A, 0x51, 0xA3, 0xD7, 0x00, 0x03, 0xAE, 0xFD, 0x80, 0x00, 0x00,
+    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xDE, 0x70, 0x00, 0x1D, 0x20, 0x00, 0x0E,
+    0x52, 0xE3, 0x00, 0xA6, 0x00, 0x00, 0x3E, 0x00, 0xA6, 0x05, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0xA6,
+    0x1D, 0x30, 0x00, 0x00, 0x0E, 0x52, 0xE3, 0x98, 0x3D, 0xE7, 0x00, 0x04, 0xDE, 0x73, 0xD1, 0xD5,
+    0x2E, 0x30, 0x00, 0x00, 0x0C, 0x42, 0xE0, 0x09, 0x70, 0x00, 0x00, 0x79, 0x02, 0xE0, 0x09, 0x70,
+    0x00, 0x02, 0xD1, 0x00, 0xD5, 0x2E, 0x30, 0x00, 0x0C, 0x50, 0x00, 0x4D, 0xE8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xED, 0x60,
+    0x00, 0x00, 0x00, 0xBB, 0x12, 0x91, 0x00, 0x00, 0x00, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x09, 0xC3, 0xDA, 0x00, 0x6E, 0x00,
+    0x1F, 0x40, 0x1C, 0xB1, 0xA9, 0x00, 0x1F, 0x50, 0x01, 0xBD, 0xE1, 0x00, 0x0A, 0xD4, 0x12, 0x8F,
+    0xD2, 0x00, 0x00, 0x7D, 0xFE, 0x92, 0xAD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x0A, 0x80, 0x0A, 0x80, 0x0A, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x20, 0x00, 0x98, 0x00, 0x01, 0xF2,
+    0x00, 0x06, 0xD0, 0x00, 0x0A, 0xA0, 0x00, 0x0B, 0x90, 0x00, 0x0B, 0x90, 0x00, 0x0A, 0xA0, 0x00,
+    0x06, 0xD0, 0x00, 0x01, 0xF2, 0x00, 0x00, 0x99, 0x00, 0x00, 0x1E, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x80, 0x00, 0x02, 0xE2,
+    0x00, 0x00, 0xB8, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x2F, 0x30, 0x00, 0x2F, 0x30,
+    0x00, 0x3F, 0x20, 0x00, 0x6D, 0x00, 0x00, 0xB8, 0x00, 0x02, 0xE2, 0x00, 0x09, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x59, 0x1C, 0x19, 0x50, 0x04, 0xBE, 0xB4, 0x00,
+    0x04, 0xBE, 0xB4, 0x00, 0x59, 0x1C, 0x19, 0x50, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x70, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x40, 0x00, 0x00, 0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF1, 0x07, 0xC0, 0x0C, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xE0, 0x08,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0x90, 0x00, 0x0D, 0x40, 0x00, 0x3E, 0x00, 0x00, 0x7A, 0x00, 0x00, 0xC6,
+    0x00, 0x01, 0xF1, 0x00, 0x06, 0xC0, 0x00, 0x0A, 0x70, 0x00, 0x0E, 0x30, 0x00, 0x4D, 0x00, 0x00,
+    0x89, 0x00, 0x00, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xFC, 0x50, 0x00,
+    0x04, 0xF6, 0x17, 0xF3, 0x00, 0x0B, 0xA0, 0x00, 0xCA, 0x00, 0x0E, 0x60, 0x00, 0x8D, 0x00, 0x1F,
+    0x50, 0x00, 0x7E, 0x00, 0x1F, 0x50, 0x00, 0x7E, 0x00, 0x0E, 0x60, 0x00, 0x8D, 0x00, 0x0B, 0xA0,
+    0x00, 0xCA, 0x00, 0x04, 0xF6, 0x17, 0xF3, 0x00, 0x00, 0x6D, 0xFC, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x6C, 0xF5, 0x00, 0x00, 0x06, 0x93, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAE, 0xEB, 0x30, 0x00, 0x0B, 0x51, 0x19, 0xE2, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0x00, 0x00, 0x00, 0x01, 0xF5, 0x00, 0x00, 0x00, 0x0A, 0xD1, 0x00, 0x00, 0x00,
+    0x8E, 0x30, 0x00, 0x00, 0x08, 0xE4, 0x00, 0x00, 0x00, 0x7E, 0x40, 0x00, 0x00, 0x07, 0xE4, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xEC, 0x50, 0x00, 0x08,
+    0x62, 0x16, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x16, 0xE3, 0x00, 0x00, 0x3F,
+    0xFF, 0x50, 0x00, 0x00, 0x00, 0x16, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x00,
+    0xBB, 0x00, 0x0A, 0x41, 0x17, 0xF5, 0x00, 0x04, 0xBE, 0xEB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6F, 0xA0, 0x00, 0x00, 0x03, 0xDC, 0xA0, 0x00, 0x00, 0x1D, 0x4B, 0xA0, 0x00, 0x00, 0x99,
+    0x0B, 0xA0, 0x00, 0x05, 0xD1, 0x0B, 0xA0, 0x00, 0x2E, 0x30, 0x0B, 0xA0, 0x00, 0x5F, 0xFF, 0xFF,
+    0xFF, 0x20, 0x00, 0x00, 0x0B, 0xA0, 0x00, 0x00, 0x00, 0x0B, 0xA0, 0x00, 0x00, 0x00, 0x0B, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xC0,
+    0x00, 0x00, 0x00, 0x07, 0xFE, 0xEB, 0x30, 0x00, 0x06, 0x51, 0x2A, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0xD8, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0xD8, 0x00, 0x0A, 0x41, 0x2A, 0xE2,
+    0x00, 0x03, 0xBE, 0xEA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEE, 0x91, 0x00, 0x01, 0xDA,
+    0x21, 0x65, 0x00, 0x08, 0xE1, 0x00, 0x00, 0x00, 0x0D, 0x90, 0x00, 0x00, 0x00, 0x0F, 0x8B, 0xFD,
+    0x81, 0x00, 0x0F, 0xF5, 0x13, 0xD9, 0x00, 0x0D, 0xA0, 0x00, 0x7E, 0x00, 0x0A, 0xA0, 0x00, 0x7E,
+    0x00, 0x03, 0xF5, 0x13, 0xD9, 0x00, 0x00, 0x4C, 0xFD, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+    0xFF, 0xFA, 0x00, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x0E,
+    0x80, 0x00, 0x00, 0x00, 0x5F, 0x30, 0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x01, 0xF6, 0x00,
+    0x00, 0x00, 0x07, 0xE1, 0x00, 0x00, 0x00, 0x0D, 0x90, 0x00, 0x00, 0x00, 0x4F, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x8D, 0xFD, 0x80, 0x00, 0x09, 0xD3, 0x04, 0xE7, 0x00, 0x0B, 0x90, 0x00,
+    0xBA, 0x00, 0x06, 0xD3, 0x04, 0xE5, 0x00, 0x00, 0x8F, 0xFF, 0x70, 0x00, 0x08, 0xD3, 0x14, 0xE6,
+    0x00, 0x0E, 0x70, 0x00, 0x8D, 0x00, 0x0E, 0x60, 0x00, 0x8D, 0x00, 0x0A, 0xD3, 0x14, 0xE8, 0x00,
+    0x01, 0x8D, 0xFD, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xFC, 0x30, 0x00, 0x0A, 0xD3, 0x16,
+    0xE2, 0x00, 0x1F, 0x50, 0x00, 0xC8, 0x00, 0x1F, 0x50, 0x00, 0xCC, 0x00, 0x0B, 0xC3, 0x16, 0xFD,
+    0x00, 0x01, 0x9E, 0xEA, 0x9D, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x01, 0xE7, 0x00,
+    0x06, 0x51, 0x2B, 0xC0, 0x00, 0x01, 0x9E, 0xE9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xF1, 0x00, 0x05, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xF1, 0x00, 0x05, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0xF1, 0x00, 0x05, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0xF1, 0x00, 0x07, 0xC0, 0x00, 0x0C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x40, 0x00, 0x00, 0x02, 0x8E, 0xE9, 0x10, 0x00, 0x16,
+    0xCF, 0xB6, 0x10, 0x00, 0x05, 0xED, 0x82, 0x00, 0x00, 0x00, 0x05, 0xED, 0x82, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0xCF, 0xB5, 0x10, 0x00, 0x00, 0x00, 0x02, 0x8E, 0xE9, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x5B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x93,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xC7, 0x10, 0x00, 0x00, 0x00, 0x02, 0x7D, 0xFA, 0x40, 0x00,
+    0x00, 0x00, 0x00, 0x39, 0xED, 0x20, 0x00, 0x00, 0x00, 0x39, 0xED, 0x20, 0x00, 0x02, 0x7D, 0xFA,
+    0x40, 0x00, 0x03, 0xBF, 0xD7, 0x10, 0x00, 0x00, 0x07, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xCE, 0xD7, 0x00, 0x0B, 0x30, 0x5F, 0x40, 0x00, 0x00, 0x0F, 0x50, 0x00, 0x00,
+    0x9D, 0x10, 0x00, 0x0A, 0xD2, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0x10, 0x00, 0x00, 0x5F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x6B, 0xEE, 0xD8, 0x10, 0x00, 0x00, 0x2C, 0xB4, 0x10, 0x38, 0xE4, 0x00, 0x01, 0xD6, 0x00,
+    0x00, 0x00, 0x3E, 0x20, 0x08, 0x90, 0x19, 0xED, 0x6E, 0x06, 0xA0, 0x0D, 0x20, 0x8B, 0x22, 0xBE,
+    0x01, 0xE0, 0x0E, 0x00, 0xC4, 0x00, 0x4E, 0x00, 0xF0, 0x0E, 0x00, 0xC4, 0x00, 0x4E, 0x03, 0xC0,
+    0x0D, 0x20, 0x8B, 0x21, 0xBE, 0x3D, 0x40, 0x08, 0x90, 0x19, 0xED, 0x7E, 0xB3, 0x00, 0x01, 0xD6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xA4, 0x11, 0x39, 0xA0, 0x00, 0x00, 0x01, 0x7C, 0xEE,
+    0xC9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x09, 0xCF, 0x20, 0x00, 0x00, 0x1E, 0x4B, 0x80, 0x00, 0x00,
+    0x5D, 0x05, 0xE0, 0x00, 0x00, 0xB7, 0x00, 0xE5, 0x00, 0x02, 0xF2, 0x00, 0x8B, 0x00, 0x08, 0xFF,
+    0xFF, 0xFF, 0x20, 0x0E, 0x50, 0x00, 0x0B, 0x70, 0x5F, 0x10, 0x00, 0x07, 0xD0, 0xAB, 0x00, 0x00,
+    0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFE, 0xB3, 0x00, 0x09, 0xB0, 0x01, 0xAE, 0x00, 0x09,
+    0xB0, 0x00, 0x4F, 0x20, 0x09, 0xB0, 0x01, 0xAD, 0x00, 0x09, 0xFF, 0xFF, 0xE3, 0x00, 0x09, 0xB0,
+    0x01, 0x7E, 0x20, 0x09, 0xB0, 0x00, 0x0E, 0x80, 0x09, 0xB0, 0x00, 0x0E, 0x80, 0x09, 0xB0, 0x01,
+    0x7F, 0x30, 0x09, 0xFF, 0xFE, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xDB, 0x40, 0x02,
+    0xDB, 0x30, 0x14, 0xB0, 0x0A, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x70, 0x00, 0x00, 0x00, 0x3F, 0x50,
+    0x00, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x00, 0x00, 0x1F, 0x70, 0x00, 0x00, 0x00, 0x0A, 0xD0, 0x00,
+    0x00, 0x00, 0x02, 0xDB, 0x30, 0x14, 0xB0, 0x00, 0x18, 0xDF, 0xDB, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xFF, 0xFE, 0xB6, 0x00, 0x00, 0x09, 0xB0, 0x01, 0x5D, 0xB0, 0x00, 0x09, 0xB0,
+    0x00, 0x02, 0xF7, 0x00, 0x09, 0xB0, 0x00, 0x00, 0xAC, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x8E, 0x00,
+    0x09, 0xB0, 0x00, 0x00, 0x8E, 0x00, 0x09, 0xB0, 0x00, 0x00, 0xAC, 0x00, 0x09, 0xB0, 0x00, 0x02,
+    0xF7, 0x00, 0x09, 0xB0, 0x01, 0x5D, 0xC1, 0x00, 0x09, 0xFF, 0xFE, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFC, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x00, 0x09,
+    0xB0, 0x00, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xF9, 0x00, 0x09, 0xB0,
+    0x00, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x00, 0x09, 0xB0, 0x00,
+    0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xF4, 0x09, 0xB0, 0x00, 0x00, 0x09,
+    0xB0, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xC0, 0x09, 0xB0, 0x00, 0x00, 0x09,
+    0xB0, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0xDF, 0xEC, 0x61, 0x00, 0x02, 0xDB, 0x41, 0x13, 0x96, 0x00, 0x0A, 0xD0, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0x50, 0x00, 0xEF, 0xFB, 0x00, 0x1F, 0x70, 0x00, 0x00, 0xAB, 0x00, 0x0A, 0xD0, 0x00, 0x00, 0xAB,
+    0x00, 0x02, 0xDC, 0x41, 0x13, 0xCB, 0x00, 0x00, 0x18, 0xDF, 0xEC, 0x81, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x04, 0xF2, 0x00, 0x09, 0xB0, 0x00,
+    0x04, 0xF2, 0x00, 0x09, 0xB0, 0x00, 0x04, 0xF2, 0x00, 0x09, 0xB0, 0x00, 0x04, 0xF2, 0x00, 0x09,
+    0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x09, 0xB0, 0x00, 0x04, 0xF2, 0x00, 0x09, 0xB0, 0x00, 0x04, 0xF2,
+    0x00, 0x09, 0xB0, 0x00, 0x04, 0xF2, 0x00, 0x09, 0xB0, 0x00, 0x04, 0xF2, 0x00, 0x09, 0xB0, 0x00,
+    0x04, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xB0, 0x09, 0xB0, 0x09, 0xB0, 0x09, 0xB0, 0x09, 0xB0, 0x09, 0xB0, 0x09, 0xB0, 0x09,
+    0xB0, 0x09, 0xB0, 0x09, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x9B, 0x00, 0x00,
+    0x9B, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x9B,
+    0x00, 0x00, 0x9B, 0x00, 0x00, 0xBA, 0x00, 0x03, 0xE6, 0x00, 0xBE, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xB0, 0x00, 0x4E, 0x80, 0x09, 0xB0, 0x05, 0xF7, 0x00, 0x09, 0xB0, 0x6F, 0x60, 0x00, 0x09, 0xB7,
+    0xF5, 0x00, 0x00, 0x09, 0xFF, 0x50, 0x00, 0x00, 0x09, 0xCD, 0xC1, 0x00, 0x00, 0x09, 0xB1, 0xCC,
+    0x10, 0x00, 0x09, 0xB0, 0x1C, 0xD1, 0x00, 0x09, 0xB0, 0x01, 0xCD, 0x10, 0x09, 0xB0, 0x00, 0x1C,
+    0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0xB0, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x09, 0xB0, 0x00,
+    0x00, 0x09, 0xB0, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x09, 0xB0, 0x00,
+    0x00, 0x09, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x8F,
+    0xB0, 0x09, 0xDE, 0x10, 0x00, 0xED, 0xB0, 0x09, 0xBC, 0x60, 0x05, 0xDA, 0xB0, 0x09, 0xB6, 0xC0,
+    0x0B, 0x7A, 0xB0, 0x09, 0xB1, 0xE3, 0x2F, 0x1A, 0xB0, 0x09, 0xB0, 0x98, 0x7A, 0x0A, 0xB0, 0x09,
+    0xB0, 0x4E, 0xD5, 0x0A, 0xB0, 0x09, 0xB0, 0x0D, 0xE0, 0x0A, 0xB0, 0x09, 0xB0, 0x00, 0x00, 0x0A,
+    0xB0, 0x09, 0xB0, 0x00, 0x00, 0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF8,
+    0x00, 0x04, 0xF1, 0x09, 0xFE, 0x10, 0x04, 0xF1, 0x09, 0xBC, 0x90, 0x04, 0xF1, 0x09, 0xB4, 0xF2,
+    0x04, 0xF1, 0x09, 0xB0, 0xBA, 0x04, 0xF1, 0x09, 0xB0, 0x3F, 0x34, 0xF1, 0x09, 0xB0, 0x0A, 0xB4,
+    0xF1, 0x09, 0xB0, 0x02, 0xF8, 0xF1, 0x09, 0xB0, 0x00, 0x9F, 0xF1, 0x09, 0xB0, 0x00, 0x1E, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDF, 0xD9, 0x20, 0x00, 0x02, 0xEB, 0x30, 0x2B,
+    0xE2, 0x00, 0x0A, 0xD0, 0x00, 0x00, 0xDA, 0x00, 0x1F, 0x70, 0x00, 0x00, 0x7F, 0x10, 0x3F, 0x50,
+    0x00, 0x00, 0x4F, 0x30, 0x3F, 0x50, 0x00, 0x00, 0x4F, 0x30, 0x1F, 0x70, 0x00, 0x00, 0x7F, 0x10,
+    0x0A, 0xD0, 0x00, 0x00, 0xDA, 0x00, 0x02, 0xEB, 0x30, 0x2A, 0xE2, 0x00, 0x00, 0x29, 0xDF, 0xE9,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFD, 0x81, 0x09, 0xB0, 0x04, 0xE9, 0x09, 0xB0,
+    0x00, 0x9D, 0x09, 0xB0, 0x00, 0x9D, 0x09, 0xB0, 0x04, 0xE9, 0x09, 0xFF, 0xFD, 0x81, 0x09, 0xB0,
+    0x00, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x09, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x29, 0xDF, 0xD9, 0x20, 0x00, 0x02, 0xEB, 0x30, 0x2B, 0xE2, 0x00, 0x0A, 0xD0, 0x00, 0x00,
+    0xDA, 0x00, 0x1F, 0x70, 0x00, 0x00, 0x7F, 0x10, 0x3F, 0x50, 0x00, 0x00, 0x4F, 0x30, 0x3F, 0x50,
+    0x00, 0x00, 0x4F, 0x30, 0x1F, 0x70, 0x00, 0x00, 0x7F, 0x10, 0x0A, 0xD0, 0x00, 0x00, 0xDA, 0x00,
+    0x02, 0xEB, 0x30, 0x2A, 0xE2, 0x00, 0x00, 0x29, 0xDF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x8E,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x09, 0xFF, 0xFD, 0x81, 0x00, 0x09, 0xB0, 0x04, 0xE9, 0x00, 0x09, 0xB0, 0x00,
+    0x8D, 0x00, 0x09, 0xB0, 0x00, 0x8E, 0x00, 0x09, 0xB0, 0x03, 0xE8, 0x00, 0x09, 0xFF, 0xFF, 0xA0,
+    0x00, 0x09, 0xB0, 0x05, 0xF5, 0x00, 0x09, 0xB0, 0x00, 0x8E, 0x10, 0x09, 0xB0, 0x00, 0x1E, 0x80,
+    0x09, 0xB0, 0x00, 0x06, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xEC, 0x71, 0x00, 0x0A, 0xC3, 0x12,
+    0x77, 0x00, 0x0F, 0x60, 0x00, 0x00, 0x00, 0x0E, 0x90, 0x00, 0x00, 0x00, 0x05, 0xEE, 0xA7, 0x20,
+    0x00, 0x00, 0x15, 0x9D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x10,
+    0x0B, 0x52, 0x13, 0xDB, 0x00, 0x04, 0xAD, 0xED, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xF9, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0x90, 0x00, 0x05, 0xF0, 0x0C, 0x90, 0x00, 0x05, 0xF0, 0x0C, 0x90, 0x00, 0x05,
+    0xF0, 0x0C, 0x90, 0x00, 0x05, 0xF0, 0x0C, 0x90, 0x00, 0x05, 0xF0, 0x0C, 0x90, 0x00, 0x05, 0xF0,
+    0x0B, 0xA0, 0x00, 0x06, 0xF0, 0x09, 0xD0, 0x00, 0x09, 0xC0, 0x02, 0xF8, 0x11, 0x5E, 0x60, 0x00,
+    0x3B, 0xEE, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x02, 0xF4, 0x5F, 0x20, 0x00, 0x08,
+    0xD0, 0x0E, 0x80, 0x00, 0x0E, 0x70, 0x08, 0xD0, 0x00, 0x5F, 0x20, 0x02, 0xF4, 0x00, 0xBB, 0x00,
+    0x00, 0xBA, 0x02, 0xF5, 0x00, 0x00, 0x5F, 0x17, 0xE0, 0x00, 0x00, 0x1E, 0x6D, 0x80, 0x00, 0x00,
+    0x09, 0xEF, 0x20, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x6E, 0x00, 0x00, 0xEC, 0x00, 0x02, 0xF4, 0x2F, 0x40, 0x04, 0xEF, 0x10, 0x06, 0xF0,
+    0x0D, 0x70, 0x07, 0xAC, 0x50, 0x0A, 0xB0, 0x0A, 0xB0, 0x0B, 0x68, 0x90, 0x0E, 0x70, 0x06, 0xF0,
+    0x0F, 0x24, 0xD0, 0x2F, 0x40, 0x02, 0xF4, 0x4D, 0x01, 0xF1, 0x6E, 0x00, 0x00, 0xD8, 0x8A, 0x00,
+    0xC5, 0xAB, 0x00, 0x00, 0x9B, 0xB6, 0x00, 0x89, 0xE7, 0x00, 0x00, 0x6F, 0xF2, 0x00, 0x4E, 0xF3,
+    0x00, 0x00, 0x2F, 0xD0, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0C, 0xA0, 0x00, 0x1D, 0x90, 0x02, 0xE6, 0x00, 0x9D, 0x10, 0x00, 0x6E, 0x25,
+    0xF3, 0x00, 0x00, 0x0B, 0xBE, 0x70, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x20,
+    0x00, 0x00, 0x2E, 0x6B, 0xC0, 0x00, 0x00, 0xCA, 0x01, 0xE7, 0x00, 0x08, 0xD1, 0x00, 0x5F, 0x20,
+    0x4F, 0x40, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x04, 0xF4, 0x01, 0xE7, 0x00,
+    0x1D, 0x80, 0x00, 0x5F, 0x30, 0x9C, 0x00, 0x00, 0x09, 0xC5, 0xF3, 0x00, 0x00, 0x01, 0xDF, 0x70,
+    0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00,
+    0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, 0x03, 0xEA, 0x00, 0x00, 0x00, 0x1D, 0xC0,
+    0x00, 0x00, 0x00, 0xBE, 0x20, 0x00, 0x00, 0x09, 0xF3, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00,
+    0x03, 0xF9, 0x00, 0x00, 0x00, 0x2E, 0xB0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x20, 0x0C, 0x70, 0x00, 0x0C,
+    0x70, 0x00, 0x0C, 0x70, 0x00, 0x0C, 0x70, 0x00, 0x0C, 0x70, 0x00, 0x0C, 0x70, 0x00, 0x0C, 0x70,
+    0x00, 0x0C, 0x70, 0x00, 0x0C, 0x70, 0x00, 0x0C, 0x70, 0x00, 0x0C, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5,
+    0x00, 0x00, 0x89, 0x00, 0x00, 0x4D, 0x00, 0x00, 0x0E, 0x30, 0x00, 0x0A, 0x70, 0x00, 0x06, 0xC0,
+    0x00, 0x01, 0xF1, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0D, 0x40,
+    0x00, 0x09, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xFF, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F,
+    0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40, 0x00, 0x0F, 0x40,
+    0x0A, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xD2, 0x00, 0x00, 0x00, 0x03, 0xE8, 0xBD, 0x10, 0x00, 0x00, 0x3E, 0x70, 0x0A, 0xC1, 0x00,
+    0x02, 0xE6, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
+    0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xC0, 0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, 0x1D, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xEB, 0x20, 0x00, 0x00, 0x00, 0x19, 0xD0, 0x00, 0x00, 0x00,
+    0x00, 0xF3, 0x00, 0x03, 0xAE, 0xFF, 0xF4, 0x00, 0x0D, 0x92, 0x00, 0xF5, 0x00, 0x2F, 0x20, 0x03,
+    0xF5, 0x00, 0x0E, 0x81, 0x3C, 0xF5, 0x00, 0x04, 0xDF, 0xD7, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0B,
+    0x80, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x9A, 0xEE, 0x80, 0x00, 0x0B, 0xF7,
+    0x14, 0xE7, 0x00, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x0B, 0x90, 0x00, 0x4F, 0x10, 0x0B, 0x90, 0x00,
+    0x4F, 0x10, 0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x0B, 0xF7, 0x14, 0xE7, 0x00, 0x0B, 0x9A, 0xEE, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFC, 0x40, 0x08, 0xE5, 0x13,
+    0x90, 0x1E, 0x60, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x1E, 0x60, 0x00,
+    0x00, 0x08, 0xE5, 0x13, 0x90, 0x00, 0x7D, 0xFC, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00,
+    0xA9, 0x00, 0x00, 0x9E, 0xD9, 0xA9, 0x00, 0x08, 0xD3, 0x18, 0xF9, 0x00, 0x1F, 0x50, 0x00, 0xD9,
+    0x00, 0x3F, 0x20, 0x00, 0xB9, 0x00, 0x3F, 0x20, 0x00, 0xB9, 0x00, 0x1F, 0x50, 0x00, 0xD9, 0x00,
+    0x08, 0xD3, 0x18, 0xF9, 0x00, 0x01, 0x9E, 0xE9, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFD, 0x60, 0x00, 0x07, 0xD3, 0x14, 0xE5,
+    0x00, 0x0E, 0x40, 0x00, 0x7B, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x00,
+    0x1E, 0x70, 0x00, 0x00, 0x00, 0x08, 0xE5, 0x12, 0x67, 0x00, 0x00, 0x6D, 0xFD, 0x91, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xF3, 0x05, 0xE2, 0x00, 0x07,
+    0xC0, 0x00, 0xAF, 0xFF, 0xD0, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0,
+    0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x9E, 0xD9, 0xA9, 0x00, 0x09, 0xD3, 0x18, 0xF9, 0x00, 0x1F, 0x50, 0x00, 0xD9, 0x00, 0x3F, 0x20,
+    0x00, 0xA9, 0x00, 0x3F, 0x20, 0x00, 0xB9, 0x00, 0x1F, 0x50, 0x00, 0xD9, 0x00, 0x09, 0xD3, 0x18,
+    0xF9, 0x00, 0x01, 0x9E, 0xE9, 0xB9, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x04, 0x61, 0x18, 0xE2,
+    0x00, 0x01, 0x9D, 0xEB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0B,
+    0x80, 0x00, 0x00, 0x00, 0x0B, 0x9A, 0xEE, 0x90, 0x00, 0x0B, 0xF6, 0x13, 0xE6, 0x00, 0x0B, 0xA0,
+    0x00, 0xA9, 0x00, 0x0B, 0x80, 0x00, 0x9A, 0x00, 0x0B, 0x80, 0x00, 0x9A, 0x00, 0x0B, 0x80, 0x00,
+    0x9A, 0x00, 0x0B, 0x80, 0x00, 0x9A, 0x00, 0x0B, 0x80, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x0A, 0x90, 0x00, 0x00, 0x0A, 0x90, 0x0A, 0x90, 0x0A, 0x90,
+    0x0A, 0x90, 0x0A, 0x90, 0x0A, 0x90, 0x0A, 0x90, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA9, 0x00, 0x00, 0xA9, 0x00, 0x00, 0xA9, 0x00, 0x00, 0xA9, 0x00, 0x00, 0xA9, 0x00,
+    0x00, 0xA9, 0x00, 0x00, 0xA9, 0x00, 0x00, 0xA9, 0x00, 0x00, 0xB8, 0x00, 0x01, 0xD6, 0x00, 0x4E,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0x80, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x80,
+    0x04, 0xE5, 0x00, 0x0B, 0x80, 0x5E, 0x40, 0x00, 0x0B, 0x87, 0xE4, 0x00, 0x00, 0x0B, 0xDF, 0x30,
+    0x00, 0x00, 0x0B, 0xAE, 0x90, 0x00, 0x00, 0x0B, 0x82, 0xE8, 0x00, 0x00, 0x0B, 0x80, 0x2E, 0x80,
+    0x00, 0x0B, 0x80, 0x02, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x90,
+    0x0A, 0x90, 0x0A, 0x90, 0x0A, 0x90, 0x0A, 0x90, 0x0A, 0x90, 0x0A, 0x90, 0x0A, 0x90, 0x0A, 0x90,
+    0x0A, 0x90, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xAA, 0xEE, 0x82, 0xAE, 0xD6, 0x00, 0x0B, 0xF5, 0x14, 0xFE, 0x51, 0x5F, 0x20, 0x0B, 0xA0, 0x00,
+    0xCA, 0x00, 0x0D, 0x60, 0x0B, 0x80, 0x00, 0xC8, 0x00, 0x0C, 0x70, 0x0B, 0x80, 0x00, 0xC8, 0x00,
+    0x0C, 0x70, 0x0B, 0x80, 0x00, 0xC8, 0x00, 0x0C, 0x70, 0x0B, 0x80, 0x00, 0xC8, 0x00, 0x0C, 0x70,
+    0x0B, 0x80, 0x00, 0xC8, 0x00, 0x0C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x9A, 0xEE, 0x90,
+    0x00, 0x0B, 0xF6, 0x13, 0xE6, 0x00, 0x0B, 0xA0, 0x00, 0xA9, 0x00, 0x0B, 0x80, 0x00, 0x9A, 0x00,
+    0x0B, 0x80, 0x00, 0x9A, 0x00, 0x0B, 0x80, 0x00, 0x9A, 0x00, 0x0B, 0x80, 0x00, 0x9A, 0x00, 0x0B,
+    0x80, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8E, 0xFC, 0x40, 0x00, 0x08, 0xD3, 0x18, 0xF2, 0x00, 0x0F, 0x50, 0x00, 0xC8, 0x00,
+    0x2F, 0x20, 0x00, 0x9B, 0x00, 0x3F, 0x20, 0x00, 0x9B, 0x00, 0x0F, 0x50, 0x00, 0xC8, 0x00, 0x08,
+    0xD3, 0x17, 0xF2, 0x00, 0x00, 0x8E, 0xFC, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x9A, 0xEE, 0x80, 0x00, 0x0B, 0xF7, 0x14, 0xE7, 0x00,
+    0x0B, 0xC0, 0x00, 0x7D, 0x00, 0x0B, 0x90, 0x00, 0x4F, 0x10, 0x0B, 0x90, 0x00, 0x4F, 0x10, 0x0B,
+    0xC0, 0x00, 0x7D, 0x00, 0x0B, 0xF7, 0x14, 0xE7, 0x00, 0x0B, 0x9A, 0xEE, 0x80, 0x00, 0x0B, 0x80,
+    0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xD9, 0xA9, 0x00,
+    0x08, 0xD3, 0x18, 0xF9, 0x00, 0x1F, 0x50, 0x00, 0xD9, 0x00, 0x3F, 0x20, 0x00, 0xB9, 0x00, 0x3F,
+    0x20, 0x00, 0xB9, 0x00, 0x1F, 0x50, 0x00, 0xD9, 0x00, 0x08, 0xD3, 0x18, 0xF9, 0x00, 0x01, 0x9E,
+    0xE9, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00,
+    0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x9A, 0xEB, 0x0B, 0xF6, 0x10, 0x0B, 0xB0, 0x00, 0x0B,
+    0x80, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xCE,
+    0xD7, 0x00, 0x1E, 0x61, 0x28, 0x30, 0x2F, 0x20, 0x00, 0x00, 0x0B, 0xD8, 0x41, 0x00, 0x00, 0x48,
+    0xCD, 0x20, 0x00, 0x00, 0x0C, 0x80, 0x39, 0x30, 0x3E, 0x60, 0x06, 0xCE, 0xD8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x9F, 0xFF, 0xF2,
+    0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x0A, 0x90, 0x00, 0x08,
+    0xB1, 0x00, 0x02, 0xCE, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x70, 0x00, 0xA9, 0x00, 0x0C,
+    0x70, 0x00, 0xA9, 0x00, 0x0C, 0x70, 0x00, 0xA9, 0x00, 0x0C, 0x70, 0x00, 0xA9, 0x00, 0x0C, 0x70,
+    0x00, 0xA9, 0x00, 0x0B, 0x80, 0x00, 0xC9, 0x00, 0x08, 0xD2, 0x17, 0xF9, 0x00, 0x01, 0xAE, 0xD9,
+    0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0xAA, 0x1F, 0x40,
+    0x01, 0xE5, 0x0A, 0xA0, 0x05, 0xE0, 0x05, 0xE1, 0x0B, 0x90, 0x00, 0xE5, 0x1F, 0x40, 0x00, 0x9B,
+    0x6D, 0x00, 0x00, 0x4F, 0xD8, 0x00, 0x00, 0x0D, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x00, 0x2F, 0x90, 0x08, 0xB0, 0x1F, 0x30,
+    0x6E, 0xD0, 0x0C, 0x70, 0x0C, 0x70, 0xA7, 0xF1, 0x1F, 0x30, 0x08, 0xB0, 0xD3, 0xB5, 0x4E, 0x00,
+    0x04, 0xE2, 0xE0, 0x89, 0x8B, 0x00, 0x01, 0xF9, 0xB0, 0x4D, 0xC7, 0x00, 0x00, 0xCF, 0x70, 0x0F,
+    0xF3, 0x00, 0x00, 0x8F, 0x30, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1E, 0x70, 0x03, 0xF5, 0x04, 0xF3, 0x1D, 0x90, 0x00, 0x8D, 0x9D, 0x10,
+    0x00, 0x0D, 0xF3, 0x00, 0x00, 0x2E, 0xF5, 0x00, 0x00, 0xCA, 0x7E, 0x20, 0x08, 0xD1, 0x0B, 0xB0,
+    0x4F, 0x40, 0x01, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x00, 0xAA, 0x1E, 0x50, 0x01, 0xF4,
+    0x09, 0xB0, 0x06, 0xE0, 0x03, 0xF1, 0x0C, 0x80, 0x00, 0xC7, 0x3F, 0x20, 0x00, 0x6D, 0x9B, 0x00,
+    0x00, 0x1F, 0xF6, 0x00, 0x00, 0x0A, 0xE1, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x4F, 0x30, 0x00,
+    0x0D, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xB0,
+    0x00, 0x00, 0x2E, 0x70, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x0A, 0xC1, 0x00, 0x00, 0x8E, 0x20, 0x00,
+    0x05, 0xF4, 0x00, 0x00, 0x3E, 0x60, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xF2, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x00,
+    0x00, 0x02, 0xF2, 0x00, 0x00, 0x00, 0x02, 0xF2, 0x00, 0x00, 0x00, 0x02, 0xF2, 0x00, 0x00, 0x00,
+    0x18, 0xE0, 0x00, 0x00, 0x04, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x18, 0xE0, 0x00, 0x00, 0x00, 0x03,
+    0xF2, 0x00, 0x00, 0x00, 0x02, 0xF2, 0x00, 0x00, 0x00, 0x02, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x6D, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00,
+    0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03,
+    0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFD,
+    0x60, 0x00, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x04, 0xF0,
+    0x00, 0x00, 0x00, 0x03, 0xF1, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF2,
+    0x00, 0x00, 0x01, 0xF7, 0x10, 0x00, 0x00, 0x03, 0xF1, 0x00, 0x00, 0x00, 0x04, 0xF0, 0x00, 0x00,
+    0x00, 0x04, 0xF0, 0x00, 0x00, 0x00, 0x08, 0xD0, 0x00, 0x00, 0x04, 0xFD, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9D, 0xEA, 0x51, 0x29, 0x40, 0x07,
+    0x61, 0x16, 0xCE, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
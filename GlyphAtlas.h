@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>             // Table entries
+
+////////////////////////////////////////////////////////////////////////
+// Struct: GlyphAtlas
+// Purpose: Bundled bitmap font for SoftwareRenderBackend, so text can
+//          be rendered without any platform font engine. One size, one
+//          weight, printable ASCII; anything else draws as '?'.
+//          Each glyph is kLineHeight rows of `width` pixels, 4-bit
+//          coverage, two pixels per byte (high nibble first), each row
+//          padded to a whole byte. Row 0 is the top of the ascender.
+////////////////////////////////////////////////////////////////////////
+struct GlyphAtlas {
+    struct Glyph {
+        uint16_t offset;       // First byte in kCoverage
+        uint8_t width;         // Pixels per row
+        int8_t left;           // Bitmap origin relative to the pen position
+        uint8_t advance;       // Pen movement
+    };
+
+    static constexpr int kFirst = 32;
+    static constexpr int kGlyphCount = 95;
+    static constexpr int kLineHeight = 17;
+    static constexpr int kAscent = 13;
+
+    static const Glyph kGlyphs[kGlyphCount];
+    static const uint8_t kCoverage[7327];
+
+    static const Glyph& Find(wchar_t ch) {
+        const int index = static_cast<int>(ch) - kFirst;
+        return kGlyphs[(index >= 0 && index < kGlyphCount) ? index : '?' - kFirst];
+    }
+};
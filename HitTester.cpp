@@ -0,0 +1,117 @@
+#include "HitTester.h"
+#include <algorithm>
+
+void HitTester::Clear() {
+    uniform = true;
+    layout = UniformLayout();
+    count = 0;
+    rects.clear();
+    offsets.clear();
+    ids.clear();
+    cellsX = cellsY = 0;
+}
+
+void HitTester::SetUniform(const UniformLayout& newLayout, size_t itemCount) {
+    Clear();
+    layout = newLayout;
+    layout.columns = (std::max)(layout.columns, 1);
+    count = itemCount;
+}
+
+//////////////////////////////////////////////////////////////////////
+// SetRects: Cell size follows the average item, so a cell holds a
+//           handful of ids; two passes fill the buckets in id order
+//////////////////////////////////////////////////////////////////////
+void HitTester::SetRects(const std::vector<HitRect>& newRects) {
+    Clear();
+    uniform = false;
+    rects = newRects;
+    count = rects.size();
+    if (rects.empty())
+        return;
+
+    int right = rects[0].right, bottom = rects[0].bottom;
+    boundsLeft = rects[0].left;
+    boundsTop = rects[0].top;
+    long long area = 0;
+    for (const auto& rect : rects) {
+        boundsLeft = (std::min)(boundsLeft, rect.left);
+        boundsTop = (std::min)(boundsTop, rect.top);
+        right = (std::max)(right, rect.right);
+        bottom = (std::max)(bottom, rect.bottom);
+        area += static_cast<long long>((std::max)(rect.right - rect.left, 1)) * (std::max)(rect.bottom - rect.top, 1);
+    }
+
+    const int width = (std::max)(right - boundsLeft, 1);
+    const int height = (std::max)(bottom - boundsTop, 1);
+    int side = 1;
+    while (static_cast<long long>(side) * side < area / static_cast<long long>(rects.size()))
+        side *= 2;
+    while ((width + side - 1) / side > kMaxCellsPerAxis || (height + side - 1) / side > kMaxCellsPerAxis)
+        side *= 2;
+
+    cellSize = side;
+    cellsX = (width + side - 1) / side;
+    cellsY = (height + side - 1) / side;
+
+    auto forEachCell = [&](const HitRect& rect, auto&& visit) {
+        if (rect.right <= rect.left || rect.bottom <= rect.top)
+            return;
+        const int x0 = (rect.left - boundsLeft) / side, x1 = (rect.right - 1 - boundsLeft) / side;
+        const int y0 = (rect.top - boundsTop) / side, y1 = (rect.bottom - 1 - boundsTop) / side;
+        for (int y = y0; y <= y1; ++y)
+            for (int x = x0; x <= x1; ++x)
+                visit(static_cast<size_t>(y) * cellsX + x);
+    };
+
+    // Pass 1: bucket sizes
+    offsets.assign(static_cast<size_t>(cellsX) * cellsY + 1, 0);
+    for (const auto& rect : rects)
+        forEachCell(rect, [&](size_t cell) { ++offsets[cell + 1]; });
+    for (size_t i = 1; i < offsets.size(); ++i)
+        offsets[i] += offsets[i - 1];
+
+    // Pass 2: ids ascend, so each bucket comes out sorted
+    ids.resize(offsets.back());
+    std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (size_t id = 0; id < rects.size(); ++id)
+        forEachCell(rects[id], [&](size_t cell) { ids[cursor[cell]++] = static_cast<uint32_t>(id); });
+}
+
+//////////////////////////////////////////////////////////////////////
+// HitTest
+//////////////////////////////////////////////////////////////////////
+int HitTester::HitTest(int x, int y) const {
+    if (count == 0)
+        return -1;
+
+    if (uniform) {
+        const int dx = x - layout.originX;
+        const int dy = y - layout.originY;
+        if (dx < 0 || dy < 0 || layout.pitchX <= 0 || layout.pitchY <= 0)
+            return -1;
+
+        const int column = dx / layout.pitchX;
+        const int row = dy / layout.pitchY;
+        if (column >= layout.columns ||
+            dx - column * layout.pitchX >= layout.itemWidth ||
+            dy - row * layout.pitchY >= layout.itemHeight)
+            return -1;   // Beyond the last column or in a gap
+
+        const size_t index = static_cast<size_t>(row) * layout.columns + column;
+        return index < count ? static_cast<int>(index) : -1;
+    }
+
+    const int cx = x - boundsLeft;
+    const int cy = y - boundsTop;
+    if (cx < 0 || cy < 0 || cx / cellSize >= cellsX || cy / cellSize >= cellsY)
+        return -1;
+
+    const size_t cell = static_cast<size_t>(cy / cellSize) * cellsX + cx / cellSize;
+    for (uint32_t i = offsets[cell]; i < offsets[cell + 1]; ++i) {
+        const HitRect& rect = rects[ids[i]];
+        if (x >= rect.left && x < rect.right && y >= rect.top && y < rect.bottom)
+            return static_cast<int>(ids[i]);
+    }
+    return -1;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>             // size_t
+#include <cstdint>             // Compact bucket ids
+#include <vector>              // Bucket arrays
+
+////////////////////////////////////////////////////////////////////////
+// Struct: UniformLayout
+// Purpose: Items of one size placed row by row: item i sits at
+//          origin + (i % columns, i / columns) * pitch. Grid and list
+//          views are both this shape (the list has one column).
+////////////////////////////////////////////////////////////////////////
+struct UniformLayout {
+    int originX = 0;
+    int originY = 0;
+    int pitchX = 0;        // Distance between column starts
+    int pitchY = 0;        // Distance between row starts
+    int itemWidth = 0;     // <= pitchX; the rest is the gap
+    int itemHeight = 0;    // <= pitchY
+    int columns = 1;
+    int padding = 0;       // Space kept after the last column/row (content size only)
+};
+
+////////////////////////////////////////////////////////////////////////
+// Struct: HitRect
+// Purpose: One item of a free-form layout (content coordinates,
+//          right/bottom exclusive like PtInRect)
+////////////////////////////////////////////////////////////////////////
+struct HitRect {
+    int left, top, right, bottom;
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: HitTester
+// Purpose: Maps a point in content coordinates to the item under it
+//          without looking at every item.
+//          - uniform layouts: row/column arithmetic, O(1)
+//          - free-form layouts: rectangles are bucketed into a coarse
+//            grid of cells (CSR arrays: bucket b holds
+//            ids[offsets[b], offsets[b+1]), ascending); a query only
+//            tests the few ids of one cell
+//          Scrolling does not invalidate it - callers add the scroll
+//          offset to the point instead.
+////////////////////////////////////////////////////////////////////////
+class HitTester {
+public:
+    void SetUniform(const UniformLayout& layout, size_t count);
+    void SetRects(const std::vector<HitRect>& rects);
+    void Clear();
+
+    // Index of the item containing (x, y), or -1. With overlapping
+    // rectangles the lowest index wins, as in a front-to-back scan.
+    int HitTest(int x, int y) const;
+
+private:
+    bool uniform = true;
+    UniformLayout layout;
+    size_t count = 0;
+
+    // Free-form layouts
+    std::vector<HitRect> rects;
+    int boundsLeft = 0;
+    int boundsTop = 0;
+    int cellSize = 1;
+    int cellsX = 0;
+    int cellsY = 0;
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> ids;
+
+    static constexpr int kMaxCellsPerAxis = 512;
+};
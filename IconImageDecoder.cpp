@@ -0,0 +1,532 @@
+#include "IconImageDecoder.h"
+#include <algorithm>           // std::max, std::min
+#include <cstring>             // memcmp, memset
+
+//////////////////////////////////////////////////////////////////////
+// Little/big-endian field readers (callers check the bounds)
+//////////////////////////////////////////////////////////////////////
+static uint16_t ReadLE16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+static uint32_t ReadLE32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+static uint32_t ReadBE32(const uint8_t* p) {
+    return (static_cast<uint32_t>(p[0]) << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+// v / 255 rounded
+static inline uint32_t Div255(uint32_t v) {
+    v += 128;
+    return (v + (v >> 8)) >> 8;
+}
+
+static uint32_t Premultiply(uint32_t a, uint32_t r, uint32_t g, uint32_t b) {
+    return (a << 24) | (Div255(r * a) << 16) | (Div255(g * a) << 8) | Div255(b * a);
+}
+
+namespace {
+
+//////////////////////////////////////////////////////////////////////
+// BitReader: DEFLATE bit order (LSB first). Reading past the end
+// yields zeros and sets `overrun`
+//////////////////////////////////////////////////////////////////////
+struct BitReader {
+    const uint8_t* data;
+    size_t length;
+    size_t position = 0;
+    uint32_t bitBuffer = 0;
+    int bitCount = 0;
+    bool overrun = false;
+
+    uint32_t Bits(int count) {
+        while (bitCount < count) {
+            uint32_t byte = 0;
+            if (position < length)
+                byte = data[position++];
+            else
+                overrun = true;
+            bitBuffer |= byte << bitCount;
+            bitCount += 8;
+        }
+        const uint32_t value = bitBuffer & ((1u << count) - 1);
+        bitBuffer >>= count;
+        bitCount -= count;
+        return value;
+    }
+
+    void AlignToByte() {
+        bitBuffer = 0;
+        bitCount = 0;
+    }
+};
+
+//////////////////////////////////////////////////////////////////////
+// Huffman: Canonical code as code counts per length plus the symbols
+// in code order (decoded one bit at a time, like zlib's puff)
+//////////////////////////////////////////////////////////////////////
+struct Huffman {
+    uint16_t counts[16];
+    uint16_t symbols[288];
+};
+
+bool BuildHuffman(Huffman& code, const uint8_t* lengths, int count) {
+    std::memset(code.counts, 0, sizeof(code.counts));
+    for (int i = 0; i < count; ++i)
+        ++code.counts[lengths[i]];
+    code.counts[0] = 0;
+
+    // More codes than the lengths allow: not a prefix code
+    int left = 1;
+    for (int length = 1; length < 16; ++length) {
+        left = (left << 1) - code.counts[length];
+        if (left < 0)
+            return false;
+    }
+
+    uint16_t offsets[16] = {};
+    for (int length = 1; length < 15; ++length)
+        offsets[length + 1] = offsets[length] + code.counts[length];
+    for (int i = 0; i < count; ++i) {
+        if (lengths[i])
+            code.symbols[offsets[lengths[i]]++] = static_cast<uint16_t>(i);
+    }
+    return true;
+}
+
+int DecodeSymbol(BitReader& in, const Huffman& code) {
+    int value = 0, first = 0, index = 0;
+    for (int length = 1; length < 16; ++length) {
+        value |= in.Bits(1);
+        const int count = code.counts[length];
+        if (value - first < count)
+            return code.symbols[index + value - first];
+        index += count;
+        first = (first + count) << 1;
+        value <<= 1;
+    }
+    return -1;
+}
+
+const uint16_t kLengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+const uint8_t kLengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+const uint16_t kDistanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+const uint8_t kDistanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+bool InflateCodes(BitReader& in, const Huffman& literals, const Huffman& distances,
+    std::vector<uint8_t>& out, size_t limit) {
+    for (;;) {
+        const int symbol = DecodeSymbol(in, literals);
+        if (symbol < 0 || in.overrun)
+            return false;
+        if (symbol < 256) {
+            if (out.size() >= limit)
+                return false;
+            out.push_back(static_cast<uint8_t>(symbol));
+            continue;
+        }
+        if (symbol == 256)
+            return true;
+
+        const int lengthIndex = symbol - 257;
+        if (lengthIndex >= 29)
+            return false;
+        const size_t length = kLengthBase[lengthIndex] + in.Bits(kLengthExtra[lengthIndex]);
+
+        const int distanceIndex = DecodeSymbol(in, distances);
+        if (distanceIndex < 0 || distanceIndex >= 30)
+            return false;
+        const size_t distance = kDistanceBase[distanceIndex] + in.Bits(kDistanceExtra[distanceIndex]);
+
+        if (distance > out.size() || out.size() + length > limit)
+            return false;
+        const size_t from = out.size() - distance;
+        for (size_t i = 0; i < length; ++i)
+            out.push_back(out[from + i]);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// Inflate: Raw DEFLATE stream into `out`, at most `limit` bytes
+//////////////////////////////////////////////////////////////////////
+bool Inflate(const uint8_t* data, size_t length, std::vector<uint8_t>& out, size_t limit) {
+    BitReader in = { data, length };
+    Huffman literals, distances;
+    uint8_t lengths[288 + 32];
+
+    bool last;
+    do {
+        last = in.Bits(1) != 0;
+        const uint32_t type = in.Bits(2);
+
+        if (type == 0) {
+            // Stored: LEN, NLEN, then LEN raw bytes
+            in.AlignToByte();
+            if (in.position + 4 > in.length)
+                return false;
+            const uint16_t storedLength = ReadLE16(in.data + in.position);
+            const uint16_t inverse = ReadLE16(in.data + in.position + 2);
+            in.position += 4;
+            if (storedLength != static_cast<uint16_t>(~inverse) ||
+                in.position + storedLength > in.length || out.size() + storedLength > limit)
+                return false;
+            out.insert(out.end(), in.data + in.position, in.data + in.position + storedLength);
+            in.position += storedLength;
+            continue;
+        }
+
+        if (type == 1) {
+            int i = 0;
+            for (; i < 144; ++i) lengths[i] = 8;
+            for (; i < 256; ++i) lengths[i] = 9;
+            for (; i < 280; ++i) lengths[i] = 7;
+            for (; i < 288; ++i) lengths[i] = 8;
+            BuildHuffman(literals, lengths, 288);
+            std::memset(lengths, 5, 30);
+            BuildHuffman(distances, lengths, 30);
+        }
+        else if (type == 2) {
+            const int literalCount = static_cast<int>(in.Bits(5)) + 257;
+            const int distanceCount = static_cast<int>(in.Bits(5)) + 1;
+            const int codeLengthCount = static_cast<int>(in.Bits(4)) + 4;
+            if (literalCount > 286 || distanceCount > 30)
+                return false;
+
+            static const uint8_t kOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+            uint8_t codeLengths[19] = {};
+            for (int i = 0; i < codeLengthCount; ++i)
+                codeLengths[kOrder[i]] = static_cast<uint8_t>(in.Bits(3));
+
+            Huffman lengthCode;
+            if (!BuildHuffman(lengthCode, codeLengths, 19))
+                return false;
+
+            const int total = literalCount + distanceCount;
+            for (int i = 0; i < total;) {
+                const int symbol = DecodeSymbol(in, lengthCode);
+                if (symbol < 0 || in.overrun)
+                    return false;
+                if (symbol < 16) {
+                    lengths[i++] = static_cast<uint8_t>(symbol);
+                    continue;
+                }
+
+                uint8_t value = 0;
+                int repeat;
+                if (symbol == 16) {
+                    if (i == 0)
+                        return false;
+                    value = lengths[i - 1];
+                    repeat = 3 + static_cast<int>(in.Bits(2));
+                }
+                else if (symbol == 17) {
+                    repeat = 3 + static_cast<int>(in.Bits(3));
+                }
+                else {
+                    repeat = 11 + static_cast<int>(in.Bits(7));
+                }
+                if (i + repeat > total)
+                    return false;
+                while (repeat--)
+                    lengths[i++] = value;
+            }
+
+            if (lengths[256] == 0 ||
+                !BuildHuffman(literals, lengths, literalCount) ||
+                !BuildHuffman(distances, lengths + literalCount, distanceCount))
+                return false;
+        }
+        else {
+            return false;
+        }
+
+        if (!InflateCodes(in, literals, distances, out, limit))
+            return false;
+    } while (!last);
+
+    return !in.overrun;
+}
+
+uint8_t Paeth(int a, int b, int c) {
+    const int p = a + b - c;
+    const int pa = p > a ? p - a : a - p;
+    const int pb = p > b ? p - b : b - p;
+    const int pc = p > c ? p - c : c - p;
+    if (pa <= pb && pa <= pc)
+        return static_cast<uint8_t>(a);
+    return static_cast<uint8_t>(pb <= pc ? b : c);
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////
+// Decode: PNG streams start with their signature; anything else is a DIB
+//////////////////////////////////////////////////////////////////////
+bool IconImageDecoder::Decode(const uint8_t* data, size_t length, DecodedIcon& icon) {
+    static const uint8_t kPngSignature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+
+    icon = DecodedIcon();
+    if (!data)
+        return false;
+    if (length >= 8 && std::memcmp(data, kPngSignature, 8) == 0)
+        return DecodePng(data, length, icon);
+    return DecodeDib(data, length, icon);
+}
+
+//////////////////////////////////////////////////////////////////////
+// DecodeDib: The header's height covers the XOR bitmap and the mask.
+// 32-bit images carry alpha; when every alpha is 0 (old icons), or
+// for fewer bits, the AND mask decides what is transparent
+//////////////////////////////////////////////////////////////////////
+bool IconImageDecoder::DecodeDib(const uint8_t* data, size_t length, DecodedIcon& icon) {
+    if (length < 40)
+        return false;
+
+    const uint32_t headerSize = ReadLE32(data);
+    const int32_t width = static_cast<int32_t>(ReadLE32(data + 4));
+    const int32_t fullHeight = static_cast<int32_t>(ReadLE32(data + 8));
+    const uint16_t bitCount = ReadLE16(data + 14);
+    const uint32_t compression = ReadLE32(data + 16);
+    const uint32_t colorsUsed = ReadLE32(data + 32);
+
+    // BI_RGB, or BI_BITFIELDS with the usual 32-bit masks
+    const bool bitFields = compression == 3 && bitCount == 32;
+    if (headerSize < 40 || headerSize > length || (compression != 0 && !bitFields))
+        return false;
+    if (bitCount != 1 && bitCount != 4 && bitCount != 8 && bitCount != 24 && bitCount != 32)
+        return false;
+
+    if (fullHeight == INT32_MIN)        // Cannot be negated
+        return false;
+    const int height = (fullHeight < 0 ? -fullHeight : fullHeight) / 2;
+    const bool bottomUp = fullHeight > 0;
+    if (width <= 0 || width > kMaxSize || height <= 0 || height > kMaxSize)
+        return false;
+
+    const uint64_t paletteCount = bitCount <= 8 ? (colorsUsed ? colorsUsed : (1u << bitCount)) : 0;
+    if (paletteCount > 256)
+        return false;
+
+    const uint64_t paletteOffset = headerSize + (bitFields && headerSize == 40 ? 12 : 0);
+    const uint64_t xorOffset = paletteOffset + paletteCount * 4;
+    const uint64_t xorStride = (uint64_t(width) * bitCount + 31) / 32 * 4;
+    const uint64_t andOffset = xorOffset + xorStride * height;
+    const uint64_t andStride = (uint64_t(width) + 31) / 32 * 4;
+    if (andOffset > length)
+        return false;
+    const bool hasMask = andOffset + andStride * height <= length;   // Some 32-bit icons omit it
+
+    const uint8_t* palette = data + paletteOffset;
+    bool anyAlpha = false;
+    if (bitCount == 32) {
+        for (int y = 0; y < height && !anyAlpha; ++y) {
+            const uint8_t* row = data + xorOffset + xorStride * y;
+            for (int x = 0; x < width; ++x) {
+                if (row[x * 4 + 3]) {
+                    anyAlpha = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    icon.width = width;
+    icon.height = height;
+    icon.pixels.resize(static_cast<size_t>(width) * height);
+
+    for (int y = 0; y < height; ++y) {
+        const int sourceRow = bottomUp ? height - 1 - y : y;
+        const uint8_t* row = data + xorOffset + xorStride * sourceRow;
+        const uint8_t* mask = hasMask ? data + andOffset + andStride * sourceRow : nullptr;
+        uint32_t* target = icon.pixels.data() + static_cast<size_t>(y) * width;
+
+        for (int x = 0; x < width; ++x) {
+            uint32_t r, g, b, a = 255;
+            if (bitCount >= 24) {
+                const uint8_t* p = row + x * (bitCount / 8);
+                b = p[0];
+                g = p[1];
+                r = p[2];
+                if (anyAlpha)
+                    a = p[3];
+            }
+            else {
+                const int bitOffset = x * bitCount;
+                const uint32_t index = (row[bitOffset >> 3] >> (8 - bitCount - (bitOffset & 7))) & ((1u << bitCount) - 1);
+                if (index < paletteCount) {
+                    b = palette[index * 4];
+                    g = palette[index * 4 + 1];
+                    r = palette[index * 4 + 2];
+                }
+                else {
+                    r = g = b = 0;
+                }
+            }
+
+            if (!anyAlpha && mask && ((mask[x >> 3] >> (7 - (x & 7))) & 1))
+                a = 0;
+            target[x] = Premultiply(a, r, g, b);
+        }
+    }
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// DecodePng: IHDR, PLTE/tRNS for palettes, the concatenated IDAT
+// zlib stream, then per-row filters
+//////////////////////////////////////////////////////////////////////
+bool IconImageDecoder::DecodePng(const uint8_t* data, size_t length, DecodedIcon& icon) {
+    uint32_t width = 0, height = 0;
+    uint8_t bitDepth = 0, colorType = 0, interlace = 0;
+    uint8_t palette[256][4] = {};
+    std::vector<uint8_t> compressed;
+    bool sawHeader = false;
+
+    size_t position = 8;
+    while (position + 12 <= length) {
+        const uint32_t chunkLength = ReadBE32(data + position);
+        const uint8_t* type = data + position + 4;
+        const uint8_t* body = data + position + 8;
+        if (chunkLength > length - position - 12)
+            return false;
+
+        if (std::memcmp(type, "IHDR", 4) == 0 && chunkLength >= 13) {
+            width = ReadBE32(body);
+            height = ReadBE32(body + 4);
+            bitDepth = body[8];
+            colorType = body[9];
+            interlace = body[12];
+            sawHeader = true;
+        }
+        else if (std::memcmp(type, "PLTE", 4) == 0) {
+            for (uint32_t i = 0; i < chunkLength / 3 && i < 256; ++i) {
+                palette[i][0] = body[i * 3];
+                palette[i][1] = body[i * 3 + 1];
+                palette[i][2] = body[i * 3 + 2];
+                palette[i][3] = 255;
+            }
+        }
+        else if (std::memcmp(type, "tRNS", 4) == 0 && colorType == 3) {
+            for (uint32_t i = 0; i < chunkLength && i < 256; ++i)
+                palette[i][3] = body[i];
+        }
+        else if (std::memcmp(type, "IDAT", 4) == 0) {
+            compressed.insert(compressed.end(), body, body + chunkLength);
+        }
+        else if (std::memcmp(type, "IEND", 4) == 0) {
+            break;
+        }
+        position += 12 + static_cast<size_t>(chunkLength);
+    }
+
+    int channels;
+    switch (colorType) {
+    case 0: channels = 1; break;   // Gray
+    case 2: channels = 3; break;   // RGB
+    case 3: channels = 1; break;   // Palette
+    case 4: channels = 2; break;   // Gray + alpha
+    case 6: channels = 4; break;   // RGBA
+    default: return false;
+    }
+    if (!sawHeader || bitDepth != 8 || interlace != 0 ||
+        width == 0 || width > kMaxSize || height == 0 || height > kMaxSize)
+        return false;
+
+    // zlib wrapper: deflate, no preset dictionary (the Adler-32 is not checked)
+    if (compressed.size() < 2 || (compressed[0] & 0x0F) != 8 ||
+        ((compressed[0] << 8) | compressed[1]) % 31 != 0 || (compressed[1] & 0x20))
+        return false;
+
+    const size_t stride = static_cast<size_t>(width) * channels;
+    const size_t rawSize = (stride + 1) * height;
+    std::vector<uint8_t> raw;
+    raw.reserve(rawSize);
+    if (!Inflate(compressed.data() + 2, compressed.size() - 2, raw, rawSize) || raw.size() != rawSize)
+        return false;
+
+    // Filters work on bytes; the left neighbour is one pixel back
+    std::vector<uint8_t> previous(stride, 0);
+    icon.width = static_cast<int>(width);
+    icon.height = static_cast<int>(height);
+    icon.pixels.resize(static_cast<size_t>(width) * height);
+
+    for (uint32_t y = 0; y < height; ++y) {
+        uint8_t* row = raw.data() + y * (stride + 1) + 1;
+        const uint8_t filter = row[-1];
+
+        for (size_t i = 0; i < stride; ++i) {
+            const int left = i >= static_cast<size_t>(channels) ? row[i - channels] : 0;
+            const int up = previous[i];
+            const int upLeft = i >= static_cast<size_t>(channels) ? previous[i - channels] : 0;
+            switch (filter) {
+            case 0: break;
+            case 1: row[i] = static_cast<uint8_t>(row[i] + left); break;
+            case 2: row[i] = static_cast<uint8_t>(row[i] + up); break;
+            case 3: row[i] = static_cast<uint8_t>(row[i] + ((left + up) >> 1)); break;
+            case 4: row[i] = static_cast<uint8_t>(row[i] + Paeth(left, up, upLeft)); break;
+            default: return false;
+            }
+        }
+
+        uint32_t* target = icon.pixels.data() + static_cast<size_t>(y) * width;
+        for (uint32_t x = 0; x < width; ++x) {
+            const uint8_t* p = row + x * channels;
+            switch (colorType) {
+            case 0: target[x] = Premultiply(255, p[0], p[0], p[0]); break;
+            case 2: target[x] = Premultiply(255, p[0], p[1], p[2]); break;
+            case 3: target[x] = Premultiply(palette[p[0]][3], palette[p[0]][0], palette[p[0]][1], palette[p[0]][2]); break;
+            case 4: target[x] = Premultiply(p[1], p[0], p[0], p[0]); break;
+            default: target[x] = Premultiply(p[3], p[0], p[1], p[2]); break;
+            }
+        }
+
+        std::copy(row, row + stride, previous.begin());
+    }
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Resize: Each target pixel averages the source pixels it covers (at
+// least one, so enlarging repeats pixels)
+//////////////////////////////////////////////////////////////////////
+void IconImageDecoder::Resize(const DecodedIcon& source, int width, int height, DecodedIcon& target) {
+    target.width = width;
+    target.height = height;
+    target.pixels.assign(static_cast<size_t>(width) * height, 0);
+    if (source.width <= 0 || source.height <= 0)
+        return;
+
+    for (int y = 0; y < height; ++y) {
+        const int top = y * source.height / height;
+        const int bottom = (std::max)(top + 1, (y + 1) * source.height / height);
+
+        for (int x = 0; x < width; ++x) {
+            const int left = x * source.width / width;
+            const int right = (std::max)(left + 1, (x + 1) * source.width / width);
+
+            uint32_t sum[4] = {};
+            for (int sy = top; sy < bottom; ++sy) {
+                const uint32_t* row = source.pixels.data() + static_cast<size_t>(sy) * source.width;
+                for (int sx = left; sx < right; ++sx) {
+                    const uint32_t p = row[sx];
+                    sum[0] += p >> 24;
+                    sum[1] += (p >> 16) & 0xFF;
+                    sum[2] += (p >> 8) & 0xFF;
+                    sum[3] += p & 0xFF;
+                }
+            }
+
+            const uint32_t count = static_cast<uint32_t>((bottom - top) * (right - left));
+            const uint32_t half = count / 2;
+            target.pixels[static_cast<size_t>(y) * width + x] =
+                (((sum[0] + half) / count) << 24) | (((sum[1] + half) / count) << 16) |
+                (((sum[2] + half) / count) << 8) | ((sum[3] + half) / count);
+        }
+    }
+}
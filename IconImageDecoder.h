@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>             // size_t
+#include <cstdint>             // Pixels, stream fields
+#include <vector>              // Pixel buffer
+
+////////////////////////////////////////////////////////////////////////
+// Struct: DecodedIcon
+// Purpose: One decoded icon image: premultiplied 0xAARRGGBB, top-down,
+//          rows packed
+////////////////////////////////////////////////////////////////////////
+struct DecodedIcon {
+    int width = 0;
+    int height = 0;
+    std::vector<uint32_t> pixels;
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: IconImageDecoder
+// Purpose: Decodes one image of an icon as stored in an .ico file or an
+//          RT_ICON resource, with no platform imaging API:
+//          - a DIB: BITMAPINFOHEADER, palette, XOR bitmap (1/4/8/24/32
+//            bits, bottom-up) and the 1-bit AND mask
+//          - a PNG stream (8-bit gray, RGB, palette, gray+alpha or RGBA,
+//            not interlaced), with its own inflate
+//          Every read is bounds-checked; a malformed image just fails.
+////////////////////////////////////////////////////////////////////////
+class IconImageDecoder {
+public:
+    static constexpr int kMaxSize = 1024;   // Larger images are rejected
+
+    static bool Decode(const uint8_t* data, size_t length, DecodedIcon& icon);
+
+    // Box-filtered resize (premultiplied, so edges do not darken)
+    static void Resize(const DecodedIcon& source, int width, int height, DecodedIcon& target);
+
+private:
+    static bool DecodeDib(const uint8_t* data, size_t length, DecodedIcon& icon);
+    static bool DecodePng(const uint8_t* data, size_t length, DecodedIcon& icon);
+};
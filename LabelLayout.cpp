@@ -0,0 +1,72 @@
+#include "LabelLayout.h"
+#include <algorithm>
+
+//////////////////////////////////////////////////////////////////////
+// Wrap: Greedy - each line takes as much as fits, then backs up to
+//       the last space if it stopped inside a word
+//////////////////////////////////////////////////////////////////////
+void LabelLayout::Wrap(const wchar_t* text, size_t length, const int* extents,
+    int maxWidth, int maxLines, int ellipsisWidth, LabelMetrics& metrics) {
+    metrics.lines.clear();
+    metrics.width = 0;
+    maxLines = (std::max)(maxLines, 1);
+
+    auto widthOf = [&](size_t begin, size_t end) {
+        return end > begin ? extents[end - 1] - (begin ? extents[begin - 1] : 0) : 0;
+    };
+    auto trimEnd = [&](size_t begin, size_t end) {
+        while (end > begin && text[end - 1] == L' ')
+            --end;
+        return end;
+    };
+    // Longest [begin, end) no wider than `width` (always at least one character)
+    auto fit = [&](size_t begin, int width) {
+        size_t end = begin + 1;
+        while (end < length && widthOf(begin, end + 1) <= width)
+            ++end;
+        return end;
+    };
+
+    size_t pos = 0;
+    while (pos < length && metrics.lines.size() < static_cast<size_t>(maxLines)) {
+        // Spaces at a break are swallowed, as DrawText does
+        while (pos < length && text[pos] == L' ')
+            ++pos;
+        if (pos == length)
+            break;
+
+        size_t end = fit(pos, maxWidth);
+        size_t next = end;
+        if (end < length && text[end] != L' ') {
+            for (size_t i = end; i > pos + 1; --i) {
+                if (text[i - 1] == L' ') {
+                    next = end = i;
+                    break;
+                }
+            }
+        }
+
+        end = trimEnd(pos, end);
+        metrics.lines.push_back({ static_cast<uint16_t>(pos), static_cast<uint16_t>(end - pos),
+            widthOf(pos, end), false });
+        pos = next;
+    }
+
+    // Out of lines with text left: the last line shows what fits before "..."
+    while (pos < length && text[pos] == L' ')
+        ++pos;
+    if (pos < length && !metrics.lines.empty()) {
+        LabelLine& last = metrics.lines.back();
+        size_t end = last.start;
+        while (end < length && widthOf(last.start, end + 1) + ellipsisWidth <= maxWidth)
+            ++end;
+        end = trimEnd(last.start, end);
+
+        last.length = static_cast<uint16_t>(end - last.start);
+        last.width = widthOf(last.start, end) + ellipsisWidth;
+        last.ellipsis = true;
+    }
+
+    for (const auto& line : metrics.lines)
+        metrics.width = (std::max)(metrics.width, line.width);
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>             // size_t
+#include <cstdint>             // Compact line records
+#include <vector>              // Line list
+
+////////////////////////////////////////////////////////////////////////
+// Struct: LabelMetrics
+// Purpose: Line breaks of one label as measured with one font. Cached
+//          per tool; `epoch` names the font/DPI generation it belongs to,
+//          so a font change invalidates every label without touching them.
+////////////////////////////////////////////////////////////////////////
+struct LabelLine {
+    uint16_t start;        // First character in the label text
+    uint16_t length;       // Characters drawn (trailing spaces excluded)
+    int width;             // Pixel width of those characters
+    bool ellipsis;         // Text continues: draw "..." after the line
+};
+
+struct LabelMetrics {
+    std::vector<LabelLine> lines;
+    int width = 0;         // Widest line (including its ellipsis)
+    int lineHeight = 0;
+    uint32_t epoch = 0;    // 0 = never measured
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: LabelLayout
+// Purpose: Word wrapping from precomputed character extents (one
+//          GetTextExtentExPoint call per label instead of a DrawText
+//          DT_WORDBREAK pass on every paint).
+//          Breaks after spaces; a word wider than the box is split by
+//          characters. Text left over when maxLines is reached ends the
+//          last line with an ellipsis, like DT_END_ELLIPSIS.
+////////////////////////////////////////////////////////////////////////
+class LabelLayout {
+public:
+    // extents[i] = width of text[0..i] (as GetTextExtentExPoint reports)
+    static void Wrap(const wchar_t* text, size_t length, const int* extents,
+        int maxWidth, int maxLines, int ellipsisWidth, LabelMetrics& metrics);
+};
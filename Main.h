@@ -1,158 +1,313 @@
-﻿#pragma once
-
-// Windows & System Headers
-#include <windows.h>
-#include <windowsx.h>
-#include <commctrl.h>
-#include <shellapi.h>
-#include <shlobj.h>
-#include <shobjidl_core.h>
-#include <dwmapi.h>
-
-// C++ Standard Headers
-#include <string>
-#include <vector>
-#include <map>
-#include <memory>
-#include <algorithm>
-#include <stdexcept>
-
-// GDI+ Headers
-#include <gdiplus.h>
-#pragma comment(lib, "gdiplus.lib")
-
-using namespace Gdiplus;
-
-// Forward declarations
-class ToolIconManager;
-class ToolScanner;
-class ToolRenderer;
-
-// ────────────────────────────────────────────────────────────────
-// Constants — Layout & Theme (Windows 11 Style)
-// ────────────────────────────────────────────────────────────────
-constexpr int HEADER_HEIGHT = 80;
-constexpr int SEARCH_BOX_HEIGHT = 10;
-constexpr int TOOL_BUTTON_SIZE = 150;
-constexpr int COLS_PER_ROW = 8;
-
-// Windows 11 Color Palette
-constexpr COLORREF win11_background = RGB(249, 249, 249);
-constexpr COLORREF win11_surface = RGB(255, 255, 255);
-constexpr COLORREF win11_hover = RGB(243, 242, 241);
-constexpr COLORREF win11_accent = RGB(0, 120, 212);
-constexpr COLORREF win11_text = RGB(32, 31, 30);
-constexpr COLORREF win11_text_secondary = RGB(96, 94, 92);
-constexpr COLORREF TOOLS_AVAILABLE_COLOR = RGB(26, 26, 255);
-
-// ────────────────────────────────────────────────────────────────
-// Enums
-// ────────────────────────────────────────────────────────────────
-enum class ViewMode {
-    List,
-    VIEW_GRID,
-    Details
-};
-
-// ────────────────────────────────────────────────────────────────
-// ToolInfo — Tool Metadata & Drawing Info
-// ────────────────────────────────────────────────────────────────
-struct ToolInfo {
-    std::wstring filename;
-    std::wstring displayName;
-    std::wstring extension;
-    RECT rect = { 0, 0, 0, 0 };
-    HBITMAP icon = nullptr;
-};
-
-// ────────────────────────────────────────────────────────────────
-// ToolLauncher — Main Application Class
-// ────────────────────────────────────────────────────────────────
-class ToolLauncher {
-public:
-    ToolLauncher();
-    ~ToolLauncher();
-
-    bool CreateMainWindow();
-    int MessageLoop();
-    void Show(int nCmdShow);
-
-private:
-    // Window handles
-    HWND hwnd = nullptr;
-    HWND searchBox = nullptr;
-    HWND statusBar = nullptr;
-    HWND searchPanel = nullptr;
-    HWND searchLabel = nullptr;
-    HWND clearButton = nullptr;
-
-    // GDI+ resources
-    ULONG_PTR gdiplusToken = 0;
-    GdiplusStartupInput gdiplusStartupInput;
-
-    // GDI objects
-    HBRUSH backgroundBrush = nullptr;
-    HBRUSH buttonBrush = nullptr;
-    HBRUSH hoverBrush = nullptr;
-    HBRUSH accentBrush = nullptr;
-    HFONT headerFont = nullptr;
-    HFONT toolFont = nullptr;
-    HFONT searchFont = nullptr;
-    HFONT modernFont = nullptr;
-
-    // Tool data
-    std::vector<ToolInfo> tools;
-    std::vector<ToolInfo> filteredTools;
-    std::unique_ptr<ToolIconManager> iconManager;
-    std::unique_ptr<ToolScanner> scanner;
-    std::unique_ptr<ToolRenderer> renderer;
-
-    // Double buffering
-    HDC hBufferDC = nullptr;
-    HBITMAP hBufferBitmap = nullptr;
-    int lastWidth = 0;
-    int lastHeight = 0;
-
-    // State tracking
-    int hoveredTool = -1;
-    int lastHoveredTool = -1;
-    int selectedTool = -1;
-    bool isTrackingMouse = false;
-    ViewMode viewMode = ViewMode::VIEW_GRID;
-
-    // Scroll bars
-    int scrollX = 0, scrollY = 0;
-    int maxScrollX = 0, maxScrollY = 0;
-    int virtualWidth = 0, virtualHeight = 0;
-    bool showHScrollBar = false;
-    bool showVScrollBar = false;
-
-    // Core methods
-    void ScanForTools();
-    void FilterTools(const std::wstring& searchText);
-    void LaunchTool(int index);
-    void CalculateToolPositions();
-    int GetToolAtPoint(POINT pt);
-
-    // Drawing
-    void OnPaint(HDC hdc);
-    void UpdateDoubleBuffer(int width, int height);
-    void CleanupDoubleBuffer();
-    void UpdateStatusText(const std::wstring& message, int toolCount);
-    void DrawSearchIcon(HDC hdc, int x, int y);
-    void ConvertTopropercase(std::wstring& str);
-
-    // Scroll methods
-    void UpdateScrollBars();
-    void HandleHorizontalScroll(WPARAM wParam);
-    void HandleVerticalScroll(WPARAM wParam);
-    void InvalidateToolRegion(int toolId);
-    void CalculateVirtualSize();
-
-    // Message handling
-    LRESULT HandleMessage(UINT msg, WPARAM wParam, LPARAM lParam);
-    static LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam);
-
-    friend class ToolRenderer; // Grant ToolRenderer access if needed
-};
-
+﻿#pragma once
+
+// Windows & System Headers
+#include <windows.h>
+#include <windowsx.h>
+#include <commctrl.h>
+#include <shellapi.h>
+#include <shlobj.h>
+#include <shobjidl_core.h>
+#include <dwmapi.h>
+
+// C++ Standard Headers
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+#include <mutex>
+
+// GDI+ Headers
+#include <gdiplus.h>
+#pragma comment(lib, "gdiplus.lib")
+
+using namespace Gdiplus;
+
+// Project Headers
+#include "ToolWatcher.h"
+#include "SearchService.h"
+#include "VirtualLayout.h"
+#include "LabelLayout.h"
+#include "ColumnSort.h"
+#include "BackBuffer.h"
+#include "Profiler.h"
+#include "ProfilerHud.h"
+#include "ToolIconManager.h"
+
+// Forward declarations
+class ToolScanner;
+class ToolRenderer;
+struct RescanResult;
+struct DeltaResult;
+
+// ────────────────────────────────────────────────────────────────
+// Constants — Layout & Theme (Windows 11 Style)
+// ────────────────────────────────────────────────────────────────
+constexpr int HEADER_HEIGHT = 80;
+constexpr int SEARCH_BOX_HEIGHT = 10;
+constexpr int TOOL_BUTTON_SIZE = 150;
+constexpr int VIEW_TOP = HEADER_HEIGHT + SEARCH_BOX_HEIGHT + 70;   // Content y of the first row
+constexpr int VIEW_MARGIN = 32;                                    // Content left edge and trailing padding
+constexpr int DETAILS_HEADER_HEIGHT = 30;                          // Column titles above details rows
+
+// Windows 11 Color Palette
+constexpr COLORREF win11_background = RGB(249, 249, 249);
+constexpr COLORREF win11_surface = RGB(255, 255, 255);
+constexpr COLORREF win11_hover = RGB(243, 242, 241);
+constexpr COLORREF win11_accent = RGB(0, 120, 212);
+constexpr COLORREF win11_text = RGB(32, 31, 30);
+constexpr COLORREF win11_text_secondary = RGB(96, 94, 92);
+constexpr COLORREF TOOLS_AVAILABLE_COLOR = RGB(26, 26, 255);
+
+// ────────────────────────────────────────────────────────────────
+// Custom Window Messages (posted from worker threads)
+// ────────────────────────────────────────────────────────────────
+constexpr UINT WM_APP_CATALOG_CHANGED = WM_APP + 1;   // Watcher queued deltas
+constexpr UINT WM_APP_SCAN_BATCH = WM_APP + 2;        // Background scan queued tools
+constexpr UINT WM_APP_SCAN_DONE = WM_APP + 3;         // Background scan finished
+constexpr UINT WM_APP_SEARCH_DONE = WM_APP + 4;       // Search worker published a result
+constexpr UINT WM_APP_FRAME = WM_APP + 5;             // Resolve the work handlers marked dirty
+constexpr UINT WM_APP_RESCAN_DONE = WM_APP + 6;       // Background rescan ready to merge
+constexpr UINT WM_APP_ICONS_READY = WM_APP + 7;       // Icon thread decoded executables' icons
+
+// Timers
+constexpr UINT_PTR STATUS_THROTTLE_TIMER = 2;         // Deferred hover status text
+constexpr DWORD HOVER_STATUS_INTERVAL = 100;          // ms between hover SB_SETTEXTs
+constexpr UINT_PTR HUD_TIMER = 3;                     // Refreshes the timing overlay
+constexpr UINT HUD_REFRESH_INTERVAL = 250;            // ms
+
+// ────────────────────────────────────────────────────────────────
+// Enums
+// ────────────────────────────────────────────────────────────────
+enum class ViewMode {
+    List,
+    VIEW_GRID,
+    Details
+};
+
+// Details view columns, left to right
+enum class SortColumn {
+    None,       // Catalog order, or search relevance
+    Name,
+    Extension,
+    Size,
+    Modified,
+    LastLaunched,
+    Folder
+};
+
+// Work a handler marks dirty; the frame pass resolves it once, in this order
+enum FrameWork : uint32_t {
+    FRAME_LAYOUT = 1 << 0,      // Item positions and content size
+    FRAME_SCROLLBARS = 1 << 1,  // Scroll ranges and bar visibility (from the content size)
+    FRAME_REPAINT = 1 << 2,     // The whole client area
+    FRAME_STATUS = 1 << 3       // pendingStatus to the status bar
+};
+
+// Stored as one byte in the catalog cache - append only
+enum class ToolCategory : uint8_t {
+    Other,
+    Batch,
+    Python,
+    Executable,
+    PowerShell
+};
+
+// ────────────────────────────────────────────────────────────────
+// ToolInfo — Tool Metadata & Drawing Info
+// ────────────────────────────────────────────────────────────────
+struct ToolInfo {
+    std::wstring filename;      // Full path used to launch the tool
+    std::wstring folder;        // Folder the tool lives in (working directory)
+    std::wstring displayName;
+    std::wstring extension;
+    std::wstring searchKey;     // Lowercase display name, '_' as ' ' (what search matches)
+    std::wstring displayText;   // Title Case display name, '_' as ' ' (what the grid shows)
+    ToolCategory category = ToolCategory::Other;
+    uint64_t size = 0;          // File size at last scan (rescan snapshot)
+    int64_t mtime = 0;          // Last write time at last scan (rescan snapshot)
+    int64_t lastLaunched = 0;   // When LaunchTool last started it, same clock as mtime (0 = never)
+    IconSlot icon = 0;          // Shared icon in ToolIconManager's atlas (0 = none yet)
+    uint16_t iconRequests = 0;  // Own-icon decodes still due from the icon thread
+    LabelMetrics label;         // Grid label line breaks (measured by ToolRenderer)
+    uint64_t cardSprite = 0;    // Ticket for the composed card in ToolRenderer's cache (0 = none)
+    uint32_t viewTag = 0;       // View position + 1 while a watcher batch is applied (0 = none)
+};
+
+// ────────────────────────────────────────────────────────────────
+// ToolLauncher — Main Application Class
+// ────────────────────────────────────────────────────────────────
+class ToolLauncher {
+public:
+    ToolLauncher();
+    ~ToolLauncher();
+
+    bool CreateMainWindow();
+    int MessageLoop();
+    void Show(int nCmdShow);
+
+private:
+    // Window handles
+    HWND hwnd = nullptr;
+    HWND searchBox = nullptr;
+    HWND statusBar = nullptr;
+    HWND searchPanel = nullptr;
+    HWND searchLabel = nullptr;
+    HWND clearButton = nullptr;
+
+    // GDI+ resources
+    ULONG_PTR gdiplusToken = 0;
+    GdiplusStartupInput gdiplusStartupInput;
+
+    // GDI objects
+    HBRUSH backgroundBrush = nullptr;
+    HBRUSH buttonBrush = nullptr;
+    HBRUSH hoverBrush = nullptr;
+    HBRUSH accentBrush = nullptr;
+    HFONT headerFont = nullptr;
+    HFONT toolFont = nullptr;
+    HFONT searchFont = nullptr;
+    HFONT modernFont = nullptr;
+
+    // Tool data
+    std::vector<ToolInfo> tools;
+    std::vector<uint32_t> filteredView;        // Displayed tools as positions in `tools`
+    VirtualLayout viewLayout;                  // Positions of filteredView in content coordinates
+    std::unique_ptr<ToolIconManager> iconManager;
+    std::unique_ptr<ToolScanner> scanner;
+    std::unique_ptr<ToolRenderer> renderer;
+    std::unique_ptr<ToolWatcher> watcher;
+    std::unique_ptr<SearchService> searchService;
+    std::wstring activeFilter;                 // Current search text as a search key
+    bool searchIndexDirty = true;              // tools changed since the keys were sent
+    uint32_t searchGeneration = 0;             // Awaited search result (0 = none)
+    bool searchKeepsScroll = false;            // Awaited result re-ranks, not a new query
+    SearchResult searchResult;                 // Swapped with the service's buffer
+
+    // Watcher deltas waiting for the UI thread
+    std::mutex deltaLock;
+    std::vector<CatalogDelta> pendingDeltas;
+
+    // Executables' icons from the icon thread (swapped with its buffer)
+    std::vector<FileIcon> readyIcons;
+
+    // Background scan results waiting for the UI thread
+    std::mutex scanLock;
+    std::vector<ToolInfo> pendingScanTools;
+    std::unique_ptr<RescanResult> pendingRescan;
+    bool catalogDirty = false;                 // Catalog differs from the cache file
+    bool historyLoaded = false;                // Launch history applied to the full catalog
+    bool historyDirty = false;                 // lastLaunched differs from the history file
+
+    // Double buffering
+    BackBuffer backBuffer;
+    bool inSizeMove = false;                   // Between WM_ENTERSIZEMOVE and WM_EXITSIZEMOVE
+    HRGN updateRegion = nullptr;               // WM_PAINT's update region (reused)
+    std::vector<uint8_t> regionData;           // RGNDATA of updateRegion (reused)
+
+    // State tracking
+    int hoveredTool = -1;
+    int lastHoveredTool = -1;
+    int selectedTool = -1;
+    bool isTrackingMouse = false;
+    ViewMode viewMode = ViewMode::VIEW_GRID;
+
+    // Details view sorting
+    SortColumn sortColumn = SortColumn::None;
+    bool sortDescending = false;
+    ColumnSort columnSort;                     // Order of `tools` by sortColumn
+    bool sortDirty = true;                     // tools changed since columnSort was built
+    int rowWidth = 0;                          // List/details row width from the last UpdateLayout
+
+    // Scroll bars
+    int scrollX = 0, scrollY = 0;
+    int maxScrollX = 0, maxScrollY = 0;
+    int virtualWidth = 0, virtualHeight = 0;
+    bool showHScrollBar = false;
+    bool showVScrollBar = false;
+
+    // Frame scheduling: handlers mark work, one WM_APP_FRAME resolves it
+    uint32_t frameWork = 0;                    // FrameWork bits
+    bool framePosted = false;                  // WM_APP_FRAME is in the queue
+    bool inFrame = false;                      // RunFrame is on the stack
+    std::wstring pendingStatus;                // Newest status text
+    std::wstring shownStatus;                  // What the status bar shows
+    bool statusFromHover = false;              // pendingStatus only follows the cursor
+    DWORD statusSentAt = 0;                    // GetTickCount of the last SB_SETTEXT
+
+    // Timing overlay (F11); the numbers are summarized on HUD_TIMER, not per paint
+    bool showHud = false;
+    ProfileSummary hudSummaries[static_cast<int>(ProfileZone::Count)];
+    HudResizeStats hudResize;                  // The last drag of the window edge
+    std::vector<ProfileSample> hudSamples;     // Reused by RefreshHud
+
+    // Core methods
+    void ScanForTools();
+    void MergeScanBatch();
+    void MergeRescan();
+    void OnScanComplete();
+    void SaveCatalog();
+    void EnsureVisibleIcons(const RECT& clientRect);
+    void ApplyFileIcons();
+    void RefreshTools();
+    void FilterTools(const std::wstring& searchText);
+    void ReapplyFilter();
+    void PatchView(const DeltaResult& result);
+    void SubmitSearch(bool keepScroll);
+    void OnSearchComplete();
+    void ShowView(bool keepScroll);
+    bool MatchesFilter(const ToolInfo& tool) const;
+    void RebuildCatalogView();
+    ToolInfo& GetViewTool(int position);
+    int GetViewCount() const;
+    void StartWatcher();
+    void ApplyCatalogDeltas();
+    void LaunchTool(int index);
+    void UpdateLayout();
+    void SetViewMode(ViewMode mode);
+    void SortByColumn(SortColumn column);
+    void ApplySortOrder();
+    void BuildSortOrder();
+    RECT GetDetailsHeaderRect() const;
+    int GetContentTop() const;
+    SortColumn GetHeaderColumnAtPoint(POINT pt) const;
+    RECT GetToolScreenRect(int position) const;
+    void GetVisibleTools(const RECT& clientRect, size_t& first, size_t& last) const;
+    int GetToolAtPoint(POINT pt);
+
+    // Drawing
+    void OnPaint(HDC hdc, HRGN dirtyRegion);
+    bool UpdateDoubleBuffer(int width, int height);
+    void CleanupDoubleBuffer();
+    void UpdateStatusText(const std::wstring& message, int toolCount, bool fromHover = false);
+    void SetStatusText(const std::wstring& text, bool fromHover = false);
+    void SendStatusText();
+    void DrawSearchIcon(HDC hdc, int x, int y);
+
+    // Scroll methods
+    void UpdateScrollBars();
+    void HandleHorizontalScroll(WPARAM wParam);
+    void HandleVerticalScroll(WPARAM wParam);
+    void ScrollTo(int x, int y);
+    void InvalidateToolRegion(int toolId);
+
+    // Frame scheduling
+    void RequestFrame(uint32_t work);
+    void RunFrame();
+
+    // Instrumentation
+    RECT GetHudRect() const;
+    void ToggleHud();
+    void RefreshHud();
+    void ExportTrace();
+
+    // Message handling
+    LRESULT HandleMessage(UINT msg, WPARAM wParam, LPARAM lParam);
+    bool HandleShortcut(WPARAM key);
+    static LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam);
+
+    friend class ToolRenderer; // Grant ToolRenderer access if needed
+};
+
@@ -1,158 +1,214 @@
-﻿#include "Main.h"
-#include "ToolRenderer.h"
-using namespace Gdiplus;
-
-///////////////////////////////////////////////////////////////////////////
-// Function   : ToolLauncher::OnPaint
-// Purpose    : Handles the WM_PAINT message by rendering the window UI.
-//              Uses double buffering and GDI+ for smooth graphics.
-///////////////////////////////////////////////////////////////////////////
-void ToolLauncher::OnPaint(HDC hdc)
-{
-    // Get the size of the client area (inside the window, excluding title bar)
-    RECT clientRect;
-    GetClientRect(hwnd, &clientRect);
-
-    // If window size changed, update the memory buffer to match new dimensions
-    if (clientRect.right != lastWidth || clientRect.bottom != lastHeight) {
-        UpdateDoubleBuffer(clientRect.right, clientRect.bottom);
-    }
-
-    // Use memory device context for flicker-free offscreen drawing
-    HDC hdcMem = hBufferDC;
-
-    // Fill entire background using a pre-selected brush (solid or pattern)
-    FillRect(hdcMem, &clientRect, backgroundBrush);
-
-    //----------------------------------------------
-    // 1. DRAW THE HEADER (TOP SECTION)
-    //----------------------------------------------
-    RECT headerRect = { 0, 0, clientRect.right, HEADER_HEIGHT };
-
-    // Create a GDI+ graphics object for advanced drawing (gradients, antialiasing)
-    Graphics graphics(hdcMem);
-
-    // Create a vertical gradient brush from white to light gray
-    LinearGradientBrush gradientBrush(
-        Point(0, 0), Point(0, HEADER_HEIGHT),
-        Color(39, 245, 91, 204),     // Top gradient color (custom shade)
-        Color(250, 249, 248, 255)    // Bottom gradient color (off-white)
-    );
-
-    // Fill the header rectangle with the gradient
-    graphics.FillRectangle(&gradientBrush, 0, 0, clientRect.right, HEADER_HEIGHT);
-
-    // Set background mode for text to transparent (no solid background)
-    SetBkMode(hdcMem, TRANSPARENT);
-
-    // Set main header text color (predefined Win11 color)
-    SetTextColor(hdcMem, win11_text);
-
-    // Use previously created header font (e.g., Segoe UI 32pt)
-    HFONT oldFont = (HFONT)SelectObject(hdcMem, headerFont);
-
-    //----------------------------------------------
-    // 2. DRAW SUBTITLE TEXT (e.g., "Customization Tools")
-    //----------------------------------------------
-
-    // Create a subtitle font (23pt Times New Roman)
-    HFONT subtitleFont = CreateFont(
-        23, 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
-        DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
-        CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_SWISS, L"Times New Roman"
-    );
-
-    // Change text color to predefined subtitle color
-    SetTextColor(hdcMem, TOOLS_AVAILABLE_COLOR);
-
-    // Switch to subtitle font
-    SelectObject(hdcMem, subtitleFont);
-
-    // Define rectangle area to draw the subtitle string
-    RECT subtitleRect = { 30, 50, clientRect.right - 30, HEADER_HEIGHT - 5 };
-
-    // Draw the subtitle text
-    std::wstring subtitleText = L"Customization Tools";
-    DrawText(hdcMem, subtitleText.c_str(), -1, &subtitleRect, DT_LEFT | DT_VCENTER | DT_SINGLELINE);
-
-    // Restore old font and delete temporary subtitle font
-    SelectObject(hdcMem, oldFont);
-    DeleteObject(subtitleFont);
-
-    //----------------------------------------------
-    // 3. DRAW ALL TOOLS (icons and labels)
-    //----------------------------------------------
-    for (size_t i = 0; i < filteredTools.size(); ++i)
-    {
-        // Check if mouse is hovering over this tool
-        bool isHovered = (hoveredTool == static_cast<int>(i));
-
-        // Delegate the tool drawing to ToolRenderer
-        renderer->DrawTool(hdcMem, filteredTools[i], static_cast<int>(i), isHovered);
-    }
-
-    //----------------------------------------------
-    // 4. COPY TO SCREEN (BitBlt for smooth final paint)
-    //----------------------------------------------
-    BitBlt(
-        hdc,                  // Target: actual screen device context
-        0, 0,                 // Destination X, Y
-        clientRect.right,     // Width
-        clientRect.bottom,    // Height
-        hdcMem,               // Source: our memory DC
-        0, 0,                 // Source X, Y
-        SRCCOPY               // Copy operation
-    );
-}
-
-///////////////////////////////////////////////////////////////////////////
-// Function   : ToolLauncher::UpdateDoubleBuffer
-// Purpose    : Recreates the memory buffer used for offscreen drawing.
-//              Called when window size changes.
-///////////////////////////////////////////////////////////////////////////
-void ToolLauncher::UpdateDoubleBuffer(int width, int height)
-{
-    // Free any existing buffer to avoid memory leaks
-    CleanupDoubleBuffer();
-
-    // Get a handle to the device context of the screen
-    HDC hdc = GetDC(hwnd);
-
-    // Create a memory-compatible device context (offscreen drawing)
-    hBufferDC = CreateCompatibleDC(hdc);
-
-    // Create a bitmap compatible with the screen
-    hBufferBitmap = CreateCompatibleBitmap(hdc, width, height);
-
-    // Attach the bitmap to the memory device context
-    SelectObject(hBufferDC, hBufferBitmap);
-
-    // Store the new dimensions for future resize checks
-    lastWidth = width;
-    lastHeight = height;
-
-    // Release the screen device context
-    ReleaseDC(hwnd, hdc);
-}
-
-///////////////////////////////////////////////////////////////////////////
-// Function   : ToolLauncher::CleanupDoubleBuffer
-// Purpose    : Frees the memory buffer and associated bitmap.
-//              Should be called before resizing or on destruction.
-///////////////////////////////////////////////////////////////////////////
-void ToolLauncher::CleanupDoubleBuffer()
-{
-    // Delete the offscreen bitmap
-    if (hBufferBitmap)
-    {
-        DeleteObject(hBufferBitmap);
-        hBufferBitmap = nullptr;
-    }
-
-    // Delete the memory device context
-    if (hBufferDC)
-    {
-        DeleteDC(hBufferDC);
-        hBufferDC = nullptr;
-    }
-}
+﻿#include "Main.h"
+#include "ToolRenderer.h"
+#include "GdiRenderBackend.h"
+#include "ProfilerHud.h"
+using namespace Gdiplus;
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : ToolLauncher::OnPaint
+// Purpose    : Handles the WM_PAINT message by rendering the window UI.
+//              Uses double buffering and GDI+ for smooth graphics.
+//              The back buffer keeps the previous frame, so only the
+//              damaged region is redrawn and copied to the screen.
+///////////////////////////////////////////////////////////////////////////
+void ToolLauncher::OnPaint(HDC hdc, HRGN dirtyRegion)
+{
+    ScopedTimer timer(ProfileZone::Paint);
+
+    // Get the size of the client area (inside the window, excluding title bar)
+    RECT clientRect;
+    GetClientRect(hwnd, &clientRect);
+
+    // If window size changed, update the memory buffer to match new dimensions
+    if (UpdateDoubleBuffer(clientRect.right, clientRect.bottom)) {
+        // The layout moved with the size: everything is dirty
+        SetRectRgn(dirtyRegion, 0, 0, clientRect.right, clientRect.bottom);
+    }
+
+    RECT dirtyRect;
+    GetRgnBox(dirtyRegion, &dirtyRect);
+    if (!IntersectRect(&dirtyRect, &dirtyRect, &clientRect))
+        return;
+
+    // Use memory device context for flicker-free offscreen drawing
+    HDC hdcMem = backBuffer.GetDC();
+    if (!hdcMem)
+        return;
+
+    // GDI+ graphics and brushes come from the renderer's cache (no per-frame objects)
+    RenderResources& resources = renderer->GetResources();
+    Graphics* graphics = resources.GetGraphics(hdcMem);
+
+    // Nothing outside the damaged region is touched, GDI or GDI+
+    SelectClipRgn(hdcMem, dirtyRegion);
+    graphics->SetClip(dirtyRegion);
+
+    // Fill the damaged background using a pre-selected brush (solid or pattern)
+    FillRect(hdcMem, &dirtyRect, backgroundBrush);
+
+    //----------------------------------------------
+    // 1. DRAW THE HEADER (TOP SECTION)
+    //----------------------------------------------
+    RECT headerRect = { 0, 0, clientRect.right, HEADER_HEIGHT };
+    if (dirtyRect.top < headerRect.bottom)
+    {
+        // Vertical gradient brush from a custom shade to off-white
+        LinearGradientBrush* gradientBrush = resources.GetVerticalGradient(HEADER_HEIGHT,
+            Color(39, 245, 91, 204),     // Top gradient color (custom shade)
+            Color(250, 249, 248, 255)    // Bottom gradient color (off-white)
+        );
+
+        // Fill the header rectangle with the gradient
+        graphics->FillRectangle(gradientBrush, 0, 0, clientRect.right, HEADER_HEIGHT);
+
+        // Set background mode for text to transparent (no solid background)
+        SetBkMode(hdcMem, TRANSPARENT);
+
+        // Set main header text color (predefined Win11 color)
+        SetTextColor(hdcMem, win11_text);
+
+        // Use previously created header font (e.g., Segoe UI 32pt)
+        HFONT oldFont = (HFONT)SelectObject(hdcMem, headerFont);
+
+        //----------------------------------------------
+        // 2. DRAW SUBTITLE TEXT (e.g., "Customization Tools")
+        //----------------------------------------------
+
+        // Change text color to predefined subtitle color
+        SetTextColor(hdcMem, TOOLS_AVAILABLE_COLOR);
+
+        // Switch to subtitle font (23pt Times New Roman)
+        SelectObject(hdcMem, resources.GetFont(23, FW_NORMAL, L"Times New Roman"));
+
+        // Define rectangle area to draw the subtitle string
+        RECT subtitleRect = { 30, 50, clientRect.right - 30, HEADER_HEIGHT - 5 };
+
+        // Draw the subtitle text
+        std::wstring subtitleText = L"Customization Tools";
+        DrawText(hdcMem, subtitleText.c_str(), -1, &subtitleRect, DT_LEFT | DT_VCENTER | DT_SINGLELINE);
+
+        // Restore old font
+        SelectObject(hdcMem, oldFont);
+    }
+
+    //----------------------------------------------
+    // 3. DRAW ALL TOOLS (icons and labels)
+    //----------------------------------------------
+    // Tools loaded from the catalog cache get their icon on first sight
+    EnsureVisibleIcons(dirtyRect);
+
+    // Only the rows crossing the damaged band get a screen rectangle
+    size_t firstVisible, lastVisible;
+    GetVisibleTools(dirtyRect, firstVisible, lastVisible);
+
+    // Rows never cover the band above them, so ScrollTo can leave that
+    // band in place and shift only the rows
+    const int contentTop = GetContentTop();
+    IntersectClipRect(hdcMem, 0, contentTop, clientRect.right, clientRect.bottom);
+    graphics->IntersectClip(Rect(0, contentTop, clientRect.right, clientRect.bottom - contentTop));
+
+    for (size_t i = firstVisible; i < lastVisible; ++i)
+    {
+        // Skip cards (with their 2px shadow) the dirty region misses
+        RECT toolRect = GetToolScreenRect(static_cast<int>(i));
+        RECT cardRect = { toolRect.left - 2, toolRect.top - 2, toolRect.right + 2, toolRect.bottom + 2 };
+        if (!RectVisible(hdcMem, &cardRect))
+            continue;
+
+        // Check if mouse is hovering over (or pressing) this tool
+        bool isHovered = (hoveredTool == static_cast<int>(i));
+        CardState state = (selectedTool == static_cast<int>(i)) ? CardState::Pressed
+            : isHovered ? CardState::Hover : CardState::Normal;
+
+        // Delegate the tool drawing to ToolRenderer
+        ToolInfo& tool = tools[filteredView[i]];
+        if (viewMode == ViewMode::VIEW_GRID)
+        {
+            renderer->DrawTool(hdcMem, tool, toolRect, static_cast<int>(i), state);
+        }
+        else
+        {
+            renderer->DrawToolRow(hdcMem, tool, toolRect, isHovered, viewMode == ViewMode::Details);
+        }
+    }
+
+    SelectClipRgn(hdcMem, dirtyRegion);
+    graphics->SetClip(dirtyRegion);
+
+    // Details column titles (they follow horizontal scrolling only)
+    RECT band = { 0, VIEW_TOP, clientRect.right, contentTop };
+    if (viewMode == ViewMode::Details && RectVisible(hdcMem, &band))
+    {
+        FillRect(hdcMem, &band, backgroundBrush);
+        renderer->DrawDetailsHeader(hdcMem, GetDetailsHeaderRect(), sortColumn, sortDescending);
+    }
+
+    // Timing overlay, over everything (RefreshHud invalidates it)
+    RECT hudRect = GetHudRect();
+    if (showHud && RectVisible(hdcMem, &hudRect))
+    {
+        GdiRenderBackend backend(hdcMem, resources, graphics);
+        ProfilerHud::Paint(backend, hudRect.left, hudRect.top, hudSummaries, hudResize);
+    }
+
+    SelectClipRgn(hdcMem, nullptr);
+    graphics->ResetClip();
+
+    //----------------------------------------------
+    // 4. COPY TO SCREEN (BitBlt of the damaged rectangles only)
+    //----------------------------------------------
+    DWORD dataSize = GetRegionData(dirtyRegion, 0, nullptr);
+    if (dataSize > regionData.size())
+        regionData.resize(dataSize);
+
+    RGNDATA* data = reinterpret_cast<RGNDATA*>(regionData.data());
+    if (dataSize == 0 || GetRegionData(dirtyRegion, dataSize, data) == 0)
+    {
+        BitBlt(hdc, dirtyRect.left, dirtyRect.top, dirtyRect.right - dirtyRect.left,
+            dirtyRect.bottom - dirtyRect.top, hdcMem, dirtyRect.left, dirtyRect.top, SRCCOPY);
+        return;
+    }
+
+    const RECT* rects = reinterpret_cast<const RECT*>(data->Buffer);
+    for (DWORD i = 0; i < data->rdh.nCount; ++i)
+    {
+        const RECT& r = rects[i];
+        BitBlt(hdc, r.left, r.top, r.right - r.left, r.bottom - r.top, hdcMem, r.left, r.top, SRCCOPY);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : ToolLauncher::UpdateDoubleBuffer
+// Purpose    : Matches the memory buffer to the client size. Returns
+//              true if the size changed. The buffer only reallocates
+//              when it runs out of slack (or, outside a live resize,
+//              holds far more than it needs).
+///////////////////////////////////////////////////////////////////////////
+bool ToolLauncher::UpdateDoubleBuffer(int width, int height)
+{
+    if (backBuffer.GetDC() && width == backBuffer.GetWidth() && height == backBuffer.GetHeight())
+        return false;
+
+    bool replaced = backBuffer.Resize(width, height);
+    if (!inSizeMove)
+        replaced = backBuffer.Trim() || replaced;
+
+    // The cached GDI+ Graphics is bound to the old bitmap
+    if (replaced)
+        renderer->GetResources().ReleaseGraphics();
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : ToolLauncher::CleanupDoubleBuffer
+// Purpose    : Frees the memory buffer and associated bitmap.
+//              Should be called on destruction.
+///////////////////////////////////////////////////////////////////////////
+void ToolLauncher::CleanupDoubleBuffer()
+{
+    // The cached GDI+ Graphics draws into this DC
+    if (renderer)
+        renderer->GetResources().ReleaseGraphics();
+
+    backBuffer.Release();
+}
@@ -0,0 +1,327 @@
+#include "PeIconReader.h"
+#include <algorithm>           // std::stable_sort
+#include <filesystem>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+//////////////////////////////////////////////////////////////////////
+// ReadLE16 / ReadLE32: Field readers (callers check the bounds)
+//////////////////////////////////////////////////////////////////////
+static uint16_t ReadLE16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+static uint32_t ReadLE32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////
+PeIconReader::PeIconReader() {}
+
+PeIconReader::~PeIconReader() {
+    Close();
+}
+
+//////////////////////////////////////////////////////////////////////
+// Open: Maps the whole file read-only; nothing past the headers and
+//       directories is touched until ReadIcon
+//////////////////////////////////////////////////////////////////////
+bool PeIconReader::Open(const std::wstring& file) {
+    Close();
+
+#ifdef _WIN32
+    HANDLE handle = CreateFileW(file.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE)
+        return false;
+    fileHandle = handle;
+
+    LARGE_INTEGER length;
+    if (!GetFileSizeEx(handle, &length) || length.QuadPart < 6 || length.QuadPart > SIZE_MAX) {
+        Close();
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        Close();
+        return false;
+    }
+    mapHandle = mapping;
+
+    data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    dataSize = static_cast<size_t>(length.QuadPart);
+#else
+    int fd = open(fs::path(file).string().c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    fileHandle = reinterpret_cast<void*>(static_cast<intptr_t>(fd) + 1);   // +1 keeps fd 0 non-null
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < 6) {
+        Close();
+        return false;
+    }
+
+    void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    data = view == MAP_FAILED ? nullptr : static_cast<const uint8_t*>(view);
+    dataSize = static_cast<size_t>(info.st_size);
+#endif
+
+    if (!data) {
+        Close();
+        return false;
+    }
+
+    const bool valid = data[0] == 'M' && data[1] == 'Z' ? ParsePe() : ParseIco();
+    if (!valid) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Close: Releases the view and handles; safe to call repeatedly
+//////////////////////////////////////////////////////////////////////
+void PeIconReader::Close() {
+#ifdef _WIN32
+    if (data)
+        UnmapViewOfFile(data);
+    if (mapHandle)
+        CloseHandle(mapHandle);
+    if (fileHandle)
+        CloseHandle(fileHandle);
+#else
+    if (data)
+        munmap(const_cast<uint8_t*>(data), dataSize);
+    if (fileHandle)
+        close(static_cast<int>(reinterpret_cast<intptr_t>(fileHandle) - 1));
+#endif
+
+    data = nullptr;
+    dataSize = 0;
+    fileHandle = nullptr;
+    mapHandle = nullptr;
+    isIco = false;
+    directoryOffset = 0;
+    resourceOffset = 0;
+    sectionsOffset = 0;
+    sectionCount = 0;
+}
+
+//////////////////////////////////////////////////////////////////////
+// ParsePe: DOS stub -> "PE\0\0" -> COFF header -> optional header
+// (PE32 or PE32+) -> resource data directory -> first RT_GROUP_ICON
+//////////////////////////////////////////////////////////////////////
+bool PeIconReader::ParsePe() {
+    if (dataSize < 0x40)
+        return false;
+
+    const size_t peOffset = ReadLE32(data + 0x3C);
+    if (peOffset > dataSize - 24 || ReadLE32(data + peOffset) != 0x00004550)   // "PE\0\0"
+        return false;
+
+    const uint8_t* coff = data + peOffset + 4;
+    const int sections = ReadLE16(coff + 2);
+    const size_t optionalSize = ReadLE16(coff + 16);
+    const size_t optionalOffset = peOffset + 24;
+    if (optionalOffset + optionalSize > dataSize || optionalSize < 2)
+        return false;
+
+    // Data directories follow the fixed part, which is wider in PE32+
+    const uint16_t magic = ReadLE16(data + optionalOffset);
+    size_t directoriesOffset;
+    if (magic == 0x10B)
+        directoriesOffset = 96;
+    else if (magic == 0x20B)
+        directoriesOffset = 112;
+    else
+        return false;
+
+    const size_t resourceEntry = directoriesOffset + 2 * 8;   // IMAGE_DIRECTORY_ENTRY_RESOURCE
+    if (optionalSize < resourceEntry + 8 || ReadLE32(data + optionalOffset + directoriesOffset - 4) < 3)
+        return false;
+
+    sectionsOffset = optionalOffset + optionalSize;
+    sectionCount = sections;
+    if (sectionsOffset + size_t(sectionCount) * 40 > dataSize)
+        return false;
+
+    const uint32_t resourceRva = ReadLE32(data + optionalOffset + resourceEntry);
+    if (resourceRva == 0 || !RvaToOffset(resourceRva, 16, resourceOffset))
+        return false;
+
+    size_t length;
+    if (!FindResourceData(RT_GROUP_ICON_ID, -1, directoryOffset, length) || length < 6)
+        return false;
+    return ReadLE16(data + directoryOffset + 4) * size_t(14) + 6 <= length;
+}
+
+//////////////////////////////////////////////////////////////////////
+// ParseIco: ICONDIR header (reserved 0, type 1) and its 16-byte entries
+//////////////////////////////////////////////////////////////////////
+bool PeIconReader::ParseIco() {
+    if (ReadLE16(data) != 0 || ReadLE16(data + 2) != 1)
+        return false;
+
+    isIco = true;
+    directoryOffset = 0;
+    return ReadLE16(data + 4) * size_t(16) + 6 <= dataSize;
+}
+
+//////////////////////////////////////////////////////////////////////
+// RvaToOffset: Through the section holding the RVA's raw data
+//////////////////////////////////////////////////////////////////////
+bool PeIconReader::RvaToOffset(uint32_t rva, uint32_t length, size_t& offset) const {
+    for (int i = 0; i < sectionCount; ++i) {
+        const uint8_t* section = data + sectionsOffset + size_t(i) * 40;
+        const uint32_t address = ReadLE32(section + 12);
+        const uint32_t rawSize = ReadLE32(section + 16);
+        const uint32_t rawOffset = ReadLE32(section + 20);
+
+        if (rva < address || uint64_t(rva) - address + length > rawSize)
+            continue;
+
+        const uint64_t fileOffset = uint64_t(rawOffset) + (rva - address);
+        if (fileOffset + length > dataSize)
+            return false;
+        offset = static_cast<size_t>(fileOffset);
+        return true;
+    }
+    return false;
+}
+
+//////////////////////////////////////////////////////////////////////
+// FindResourceEntry: IMAGE_RESOURCE_DIRECTORY is 16 bytes (named and
+// id entry counts at 12 and 14), then 8-byte entries: name or id, and
+// the target with the high bit set for subdirectories
+//////////////////////////////////////////////////////////////////////
+bool PeIconReader::FindResourceEntry(uint32_t directory, int64_t id, bool subdirectory, uint32_t& target) const {
+    const uint64_t offset = uint64_t(resourceOffset) + directory;
+    if (offset + 16 > dataSize)
+        return false;
+
+    const uint8_t* header = data + offset;
+    const size_t count = size_t(ReadLE16(header + 12)) + ReadLE16(header + 14);
+    if (offset + 16 + count * 8 > dataSize)
+        return false;
+
+    for (size_t i = 0; i < count; ++i) {
+        const uint8_t* entry = header + 16 + i * 8;
+        const uint32_t name = ReadLE32(entry);
+        const uint32_t value = ReadLE32(entry + 4);
+
+        if (id >= 0 && ((name & 0x80000000u) || name != id))
+            continue;
+        if (((value & 0x80000000u) != 0) != subdirectory)
+            return false;
+
+        target = value & 0x7FFFFFFFu;
+        return true;
+    }
+    return false;
+}
+
+//////////////////////////////////////////////////////////////////////
+// FindResourceData: Type, name, then language level, ending at an
+// IMAGE_RESOURCE_DATA_ENTRY (RVA and size of the bytes)
+//////////////////////////////////////////////////////////////////////
+bool PeIconReader::FindResourceData(uint32_t type, int64_t id, size_t& offset, size_t& length) const {
+    uint32_t names, languages, dataEntry;
+    if (!FindResourceEntry(0, type, true, names) ||
+        !FindResourceEntry(names, id, true, languages) ||
+        !FindResourceEntry(languages, -1, false, dataEntry))
+        return false;
+
+    const uint64_t entryOffset = uint64_t(resourceOffset) + dataEntry;
+    if (entryOffset + 16 > dataSize)
+        return false;
+
+    const uint32_t rva = ReadLE32(data + entryOffset);
+    const uint32_t size = ReadLE32(data + entryOffset + 4);
+    if (!RvaToOffset(rva, size, offset))
+        return false;
+
+    length = size;
+    return true;
+}
+
+bool PeIconReader::GetImage(const Candidate& candidate, const uint8_t*& image, size_t& length) const {
+    size_t offset;
+    if (isIco) {
+        offset = candidate.id;
+        length = candidate.length;
+        if (uint64_t(offset) + length > dataSize)
+            return false;
+    }
+    else if (!FindResourceData(RT_ICON_ID, candidate.id, offset, length)) {
+        return false;
+    }
+
+    image = data + offset;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// ReadIcon: Ranks the directory's entries (a width byte of 0 means
+// 256) and decodes the first one that works
+//////////////////////////////////////////////////////////////////////
+bool PeIconReader::ReadIcon(int size, DecodedIcon& icon) const {
+    icon = DecodedIcon();
+    if (!data)
+        return false;
+
+    // GRPICONDIRENTRY is 14 bytes and ends in the RT_ICON id; ICONDIRENTRY
+    // is 16 and ends in the image's file offset
+    const size_t entrySize = isIco ? 16 : 14;
+    const size_t count = ReadLE16(data + directoryOffset + 4);
+
+    std::vector<Candidate> candidates;
+    candidates.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const uint8_t* entry = data + directoryOffset + 6 + i * entrySize;
+        Candidate candidate;
+        candidate.width = entry[0] ? entry[0] : 256;
+        candidate.bitCount = ReadLE16(entry + 6);
+        candidate.length = ReadLE32(entry + 8);
+        candidate.id = isIco ? ReadLE32(entry + 12) : ReadLE16(entry + 12);
+        candidates.push_back(candidate);
+    }
+
+    std::stable_sort(candidates.begin(), candidates.end(),
+        [size](const Candidate& a, const Candidate& b) {
+            const bool aFits = a.width >= size;
+            const bool bFits = b.width >= size;
+            if (aFits != bFits)
+                return aFits;
+            if (a.width != b.width)
+                return aFits ? a.width < b.width : a.width > b.width;
+            return a.bitCount > b.bitCount;
+        });
+
+    for (const Candidate& candidate : candidates) {
+        const uint8_t* image;
+        size_t length;
+        if (GetImage(candidate, image, length) && IconImageDecoder::Decode(image, length, icon))
+            return true;
+    }
+    return false;
+}
+
+bool PeIconReader::Load(const std::wstring& file, int size, DecodedIcon& icon) {
+    PeIconReader reader;
+    return reader.Open(file) && reader.ReadIcon(size, icon);
+}
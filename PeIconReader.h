@@ -0,0 +1,79 @@
+#pragma once
+
+#include "IconImageDecoder.h"
+#include <cstdint>             // On-disk fields
+#include <string>              // File path
+
+////////////////////////////////////////////////////////////////////////
+// Class: PeIconReader
+// Purpose: Reads the main icon of an executable (PE32/PE32+) or of an
+//          .ico file without the shell: the file is memory-mapped, so
+//          only the headers, the resource directory and the one chosen
+//          image are read from disk.
+//
+// For a PE file the icon is the first RT_GROUP_ICON resource (what
+// Explorer shows); its entries name RT_ICON resources by id. An .ico
+// file holds the same directory with file offsets instead of ids.
+// Out of the listed sizes the smallest one at least as large as asked
+// for wins, else the largest; more colours break ties. Images the
+// decoder rejects are skipped for the next best.
+////////////////////////////////////////////////////////////////////////
+class PeIconReader {
+public:
+    PeIconReader();
+    ~PeIconReader();
+
+    PeIconReader(const PeIconReader&) = delete;
+    PeIconReader& operator=(const PeIconReader&) = delete;
+
+    // Maps the file and finds its icon directory; false if it has none
+    bool Open(const std::wstring& file);
+
+    // Unmaps the file (also done by the destructor)
+    void Close();
+
+    // Decodes the best image for `size` x `size` pixels (not resized)
+    bool ReadIcon(int size, DecodedIcon& icon) const;
+
+    // Open + ReadIcon
+    static bool Load(const std::wstring& file, int size, DecodedIcon& icon);
+
+private:
+    // One image listed in a GRPICONDIR / ICONDIR
+    struct Candidate {
+        int width;
+        int bitCount;
+        uint32_t id;           // RT_ICON id (PE) or file offset (.ico)
+        uint32_t length;
+    };
+
+    static constexpr uint32_t RT_ICON_ID = 3;
+    static constexpr uint32_t RT_GROUP_ICON_ID = 14;
+
+    const uint8_t* data = nullptr;
+    size_t dataSize = 0;
+    void* fileHandle = nullptr;   // Platform handles for the mapping
+    void* mapHandle = nullptr;
+
+    bool isIco = false;
+    size_t directoryOffset = 0;   // GRPICONDIR / ICONDIR in the file
+    size_t resourceOffset = 0;    // PE resource root in the file
+    size_t sectionsOffset = 0;    // PE section table
+    int sectionCount = 0;
+
+    bool ParsePe();
+    bool ParseIco();
+
+    // File offset of `length` bytes at `rva`, checked against the file
+    bool RvaToOffset(uint32_t rva, uint32_t length, size_t& offset) const;
+
+    // Resource directory entry by id, or the first one when id < 0.
+    // `target` is the subdirectory or data entry, relative to the root
+    bool FindResourceEntry(uint32_t directory, int64_t id, bool subdirectory, uint32_t& target) const;
+
+    // RT_<type>/<id>/<first language> as a span of the file
+    bool FindResourceData(uint32_t type, int64_t id, size_t& offset, size_t& length) const;
+
+    // The image bytes of a listed candidate
+    bool GetImage(const Candidate& candidate, const uint8_t*& image, size_t& length) const;
+};
@@ -0,0 +1,230 @@
+#include "Profiler.h"
+#include <algorithm>           // std::sort, std::nth_element, std::min
+#include <atomic>              // Ring slots and positions
+#include <chrono>              // steady_clock
+#include <filesystem>          // Wide trace paths
+#include <fstream>             // Trace output
+#include <mutex>               // Ring registration (once per thread)
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr uint32_t kRingCapacity = 8192;     // Samples per thread, power of two
+constexpr uint32_t kMaxRings = 64;           // Threads recording at the same time
+
+const std::chrono::steady_clock::time_point kEpoch = std::chrono::steady_clock::now();
+
+//////////////////////////////////////////////////////////////////////
+// Ring: One thread's newest samples. The writer announces a slot in
+// `claimed` before filling it and publishes it through `written`; a
+// reader that sees `claimed` past its slot after copying knows the copy
+// may be torn (seqlock style). Slots hold the sample as two words:
+// start, and duration | zone << 32
+//////////////////////////////////////////////////////////////////////
+struct Ring {
+    std::atomic<uint64_t> claimed{ 0 };
+    std::atomic<uint64_t> written{ 0 };
+    std::atomic<bool> owned{ false };
+    std::atomic<int64_t> starts[kRingCapacity];
+    std::atomic<uint64_t> packed[kRingCapacity];
+};
+
+// Never freed: a reader may still be copying a ring whose thread exited
+std::atomic<Ring*> rings[kMaxRings];
+std::atomic<uint32_t> ringCount{ 0 };
+std::mutex registerLock;
+
+//////////////////////////////////////////////////////////////////////
+// AcquireRing: A ring given up by a finished thread, or a new one.
+// nullptr once kMaxRings threads record at the same time
+//////////////////////////////////////////////////////////////////////
+Ring* AcquireRing() {
+    std::lock_guard<std::mutex> guard(registerLock);
+
+    const uint32_t count = ringCount.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < count; ++i) {
+        Ring* ring = rings[i].load(std::memory_order_relaxed);
+        if (!ring->owned.load(std::memory_order_acquire)) {
+            ring->owned.store(true, std::memory_order_relaxed);
+            return ring;
+        }
+    }
+
+    if (count == kMaxRings)
+        return nullptr;
+
+    Ring* ring = new Ring;
+    ring->owned.store(true, std::memory_order_relaxed);
+    rings[count].store(ring, std::memory_order_release);
+    ringCount.store(count + 1, std::memory_order_release);
+    return ring;
+}
+
+// Gives the thread's ring back when the thread ends
+struct ThreadRing {
+    Ring* ring = nullptr;
+    bool acquired = false;
+
+    ~ThreadRing() {
+        if (ring)
+            ring->owned.store(false, std::memory_order_release);
+    }
+};
+
+thread_local ThreadRing threadRing;
+
+uint32_t BucketOf(uint32_t duration) {
+    uint32_t value = duration >> ProfileSummary::kFirstBucketShift;
+    int bucket = 0;
+    while (value && bucket < ProfileSummary::kBuckets - 1) {
+        value >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+} // namespace
+
+int64_t Profiler::Now() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - kEpoch).count();
+}
+
+//////////////////////////////////////////////////////////////////////
+// Record: Only the recording thread writes its ring
+//////////////////////////////////////////////////////////////////////
+void Profiler::Record(ProfileZone zone, int64_t start, int64_t end) {
+    if (!threadRing.acquired) {
+        threadRing.ring = AcquireRing();
+        threadRing.acquired = true;
+    }
+    Ring* ring = threadRing.ring;
+    if (!ring)
+        return;
+
+    const uint64_t position = ring->written.load(std::memory_order_relaxed);
+    const uint32_t slot = static_cast<uint32_t>(position & (kRingCapacity - 1));
+    const uint64_t duration = static_cast<uint64_t>((std::min)(
+        (std::max)(end - start, int64_t(0)), int64_t(UINT32_MAX)));
+
+    ring->claimed.store(position + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    ring->starts[slot].store(start, std::memory_order_relaxed);
+    ring->packed[slot].store(duration | (static_cast<uint64_t>(zone) << 32), std::memory_order_relaxed);
+    ring->written.store(position + 1, std::memory_order_release);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Collect: Copies every ring, then keeps only the slots no writer
+// touched meanwhile
+//////////////////////////////////////////////////////////////////////
+void Profiler::Collect(std::vector<ProfileSample>& samples) {
+    samples.clear();
+
+    const uint32_t count = ringCount.load(std::memory_order_acquire);
+    for (uint32_t i = 0; i < count; ++i) {
+        Ring* ring = rings[i].load(std::memory_order_acquire);
+
+        const uint64_t end = ring->written.load(std::memory_order_acquire);
+        const uint64_t begin = end > kRingCapacity ? end - kRingCapacity : 0;
+        const size_t first = samples.size();
+
+        for (uint64_t position = begin; position < end; ++position) {
+            const uint32_t slot = static_cast<uint32_t>(position & (kRingCapacity - 1));
+            const uint64_t packed = ring->packed[slot].load(std::memory_order_relaxed);
+
+            ProfileSample sample;
+            sample.start = ring->starts[slot].load(std::memory_order_relaxed);
+            sample.duration = static_cast<uint32_t>(packed);
+            sample.zone = static_cast<ProfileZone>((packed >> 32) & 0xFF);
+            sample.thread = static_cast<uint16_t>(i);
+            samples.push_back(sample);
+        }
+
+        // Slot of `position` is reused by position + kRingCapacity
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t claimed = ring->claimed.load(std::memory_order_relaxed);
+        if (claimed > begin + kRingCapacity) {
+            const size_t torn = static_cast<size_t>((std::min)(claimed - begin - kRingCapacity, end - begin));
+            samples.erase(samples.begin() + first, samples.begin() + first + torn);
+        }
+    }
+
+    std::sort(samples.begin(), samples.end(),
+        [](const ProfileSample& a, const ProfileSample& b) { return a.start < b.start; });
+}
+
+void Profiler::Summarize(const std::vector<ProfileSample>& samples, ProfileZone zone,
+    ProfileSummary& summary) {
+    summary = ProfileSummary();
+
+    std::vector<uint32_t> durations;
+    for (const ProfileSample& sample : samples) {
+        if (sample.zone != zone)
+            continue;
+        durations.push_back(sample.duration);
+        ++summary.buckets[BucketOf(sample.duration)];
+    }
+
+    if (durations.empty())
+        return;
+
+    summary.count = static_cast<uint32_t>(durations.size());
+    summary.last = durations.back();
+
+    const auto percentile = [&durations](size_t percent) {
+        auto nth = durations.begin() + (durations.size() - 1) * percent / 100;
+        std::nth_element(durations.begin(), nth, durations.end());
+        return *nth;
+    };
+    summary.p50 = percentile(50);
+    summary.p99 = percentile(99);
+    summary.max = *std::max_element(durations.begin(), durations.end());
+}
+
+//////////////////////////////////////////////////////////////////////
+// ExportChromeTrace: Complete ("X") events, one per sample, plus a
+// name for each ring
+//////////////////////////////////////////////////////////////////////
+bool Profiler::ExportChromeTrace(const std::wstring& path) {
+    std::vector<ProfileSample> samples;
+    Collect(samples);
+
+    std::ofstream out(fs::path(path), std::ios::trunc);
+    if (!out)
+        return false;
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    const uint32_t count = ringCount.load(std::memory_order_acquire);
+    for (uint32_t i = 0; i < count; ++i) {
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << i
+            << ",\"args\":{\"name\":\"Thread " << i << "\"}}"
+            << (i + 1 < count || !samples.empty() ? ",\n" : "\n");
+    }
+
+    for (size_t i = 0; i < samples.size(); ++i) {
+        const ProfileSample& sample = samples[i];
+        out << "{\"name\":\"" << GetZoneName(sample.zone) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+            << sample.thread << ",\"ts\":" << sample.start << ",\"dur\":" << sample.duration << "}"
+            << (i + 1 < samples.size() ? ",\n" : "\n");
+    }
+
+    out << "]}\n";
+    return static_cast<bool>(out);
+}
+
+const char* Profiler::GetZoneName(ProfileZone zone) {
+    switch (zone) {
+    case ProfileZone::Dispatch: return "Dispatch";
+    case ProfileZone::Filter:   return "Filter";
+    case ProfileZone::Search:   return "Search";
+    case ProfileZone::Layout:   return "Layout";
+    case ProfileZone::Paint:    return "Paint";
+    case ProfileZone::DrawTool: return "DrawTool";
+    case ProfileZone::IconLoad: return "IconLoad";
+    case ProfileZone::Launch:   return "Launch";
+    default:                    return "?";
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>             // Timestamps, durations
+#include <string>              // Trace file path
+#include <vector>              // Collected samples
+
+// Instrumented code paths (names in Profiler::GetZoneName)
+enum class ProfileZone : uint8_t {
+    Dispatch,   // ToolLauncher::HandleMessage, one window message
+    Filter,     // FilterTools: the UI side of a keystroke
+    Search,     // Ranked query on the search thread
+    Layout,     // UpdateLayout
+    Paint,      // OnPaint: one frame
+    DrawTool,   // One grid card
+    IconLoad,   // ToolIconManager decoding an executable's icon or drawing one into its atlas
+    Launch,     // LaunchTool: ShellExecuteEx and the bookkeeping around it
+    Count
+};
+
+////////////////////////////////////////////////////////////////////////
+// Struct: ProfileSample
+// Purpose: One timed scope. Times are microseconds on the profiler's
+//          steady clock; `thread` is the ring the sample came from
+////////////////////////////////////////////////////////////////////////
+struct ProfileSample {
+    int64_t start;
+    uint32_t duration;
+    ProfileZone zone;
+    uint16_t thread;
+};
+
+////////////////////////////////////////////////////////////////////////
+// Struct: ProfileSummary
+// Purpose: Percentiles of one zone plus a log2 histogram: bucket 0
+//          holds durations below 64us, each next bucket doubles the
+//          bound, the last one takes everything from 64ms up
+////////////////////////////////////////////////////////////////////////
+struct ProfileSummary {
+    static constexpr int kBuckets = 12;
+    static constexpr int kFirstBucketShift = 6;   // 64us
+
+    uint32_t count = 0;
+    uint32_t last = 0;         // Newest sample
+    uint32_t p50 = 0;
+    uint32_t p99 = 0;
+    uint32_t max = 0;
+    uint32_t buckets[kBuckets] = {};
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: Profiler
+// Purpose: Cheap always-on timing. Every thread that records gets its
+//          own ring of the newest samples; recording is a few relaxed
+//          atomic stores, with no lock and no allocation after the
+//          thread's first sample. Readers (HUD, trace export) copy the
+//          rings from any thread and drop the slots a writer lapped
+//          while they were copying.
+//          Rings of finished threads are handed to new threads (the
+//          directory walkers come and go), so a trace thread id names
+//          a ring rather than one OS thread.
+////////////////////////////////////////////////////////////////////////
+class Profiler {
+public:
+    // Microseconds since the profiler started
+    static int64_t Now();
+
+    static void Record(ProfileZone zone, int64_t start, int64_t end);
+
+    // All rings, oldest first
+    static void Collect(std::vector<ProfileSample>& samples);
+
+    static void Summarize(const std::vector<ProfileSample>& samples, ProfileZone zone,
+        ProfileSummary& summary);
+
+    // Chrome trace event JSON (chrome://tracing, Perfetto)
+    static bool ExportChromeTrace(const std::wstring& path);
+
+    static const char* GetZoneName(ProfileZone zone);
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: ScopedTimer
+// Purpose: Records the enclosing scope as one sample of `zone`
+////////////////////////////////////////////////////////////////////////
+class ScopedTimer {
+public:
+    explicit ScopedTimer(ProfileZone zone) : zone(zone), start(Profiler::Now()) {}
+    ~ScopedTimer() { Profiler::Record(zone, start, Profiler::Now()); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    ProfileZone zone;
+    int64_t start;
+};
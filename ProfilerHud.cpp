@@ -0,0 +1,103 @@
+#include "ProfilerHud.h"
+#include <algorithm>           // std::max
+#include <cwchar>              // swprintf
+
+namespace {
+
+constexpr int kPadding = 10;
+constexpr int kRowPitch = 18;
+constexpr int kHistogramTop = 32;
+constexpr int kHistogramHeight = 48;
+constexpr int kTableTop = 120;
+constexpr int kSlowBucket = 9;             // 16ms and up: a missed 60Hz frame
+
+constexpr RenderColor kBackground = MakeRenderColor(0xD8, 24, 24, 28);
+constexpr RenderColor kText = MakeRenderColor(0xFF, 240, 240, 240);
+constexpr RenderColor kSecondary = MakeRenderColor(0xFF, 160, 160, 168);
+constexpr RenderColor kBar = MakeRenderColor(0xFF, 0, 120, 212);
+constexpr RenderColor kSlowBar = MakeRenderColor(0xFF, 232, 72, 56);
+
+void Text(RenderBackend& backend, int x, int y, const wchar_t* text, RenderColor color) {
+    backend.DrawString(RenderFont::Detail, x, y, text, wcslen(text), color);
+}
+
+double Milliseconds(uint32_t microseconds) {
+    return microseconds / 1000.0;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////
+// Paint: Title line, Paint histogram, one row per zone, then the
+//        last resize drag
+//////////////////////////////////////////////////////////////////////
+void ProfilerHud::Paint(RenderBackend& backend, int x, int y,
+    const ProfileSummary (&summaries)[static_cast<int>(ProfileZone::Count)],
+    const HudResizeStats& resize) {
+    backend.FillRoundedRect(x, y, kWidth, kHeight, 8, kBackground);
+
+    const ProfileSummary& frames = summaries[static_cast<int>(ProfileZone::Paint)];
+    wchar_t line[96];
+    swprintf(line, 96, L"Frame %.2f ms   p50 %.2f   p99 %.2f",
+        Milliseconds(frames.last), Milliseconds(frames.p50), Milliseconds(frames.p99));
+    Text(backend, x + kPadding, y + kPadding, line, kText);
+
+    // Frame times, log2 buckets from <64us to 64ms+
+    uint32_t tallest = 1;
+    for (uint32_t count : frames.buckets)
+        tallest = (std::max)(tallest, count);
+
+    const int pitch = (kWidth - 2 * kPadding) / ProfileSummary::kBuckets;
+    const int baseline = y + kHistogramTop + kHistogramHeight;
+    for (int bucket = 0; bucket < ProfileSummary::kBuckets; ++bucket) {
+        const int height = static_cast<int>(static_cast<int64_t>(frames.buckets[bucket]) * kHistogramHeight / tallest);
+        if (height > 0)
+            backend.FillRect(x + kPadding + bucket * pitch, baseline - height, pitch - 3, height,
+                bucket >= kSlowBucket ? kSlowBar : kBar);
+    }
+    backend.FillRect(x + kPadding, baseline, kWidth - 2 * kPadding, 1, kSecondary);
+    Text(backend, x + kPadding, baseline + 4, L"<64us", kSecondary);
+    int extents[5];
+    backend.MeasureText(RenderFont::Detail, L"64ms+", 5, extents);
+    Text(backend, x + kWidth - kPadding - extents[4], baseline + 4, L"64ms+", kSecondary);
+
+    // Per zone: samples in the rings, p50 and p99 in ms
+    const int columns[] = { x + kPadding, x + 110, x + 170, x + 235 };
+    int row = y + kTableTop;
+    Text(backend, columns[0], row, L"Zone", kSecondary);
+    Text(backend, columns[1], row, L"n", kSecondary);
+    Text(backend, columns[2], row, L"p50", kSecondary);
+    Text(backend, columns[3], row, L"p99", kSecondary);
+
+    for (int zone = 0; zone < static_cast<int>(ProfileZone::Count); ++zone) {
+        row += kRowPitch;
+        const ProfileSummary& summary = summaries[zone];
+
+        // Zone names are ASCII
+        const char* name = Profiler::GetZoneName(static_cast<ProfileZone>(zone));
+        size_t length = 0;
+        while (name[length] && length < 95) {
+            line[length] = static_cast<wchar_t>(name[length]);
+            ++length;
+        }
+        line[length] = L'\0';
+        Text(backend, columns[0], row, line, kText);
+        swprintf(line, 96, L"%u", summary.count);
+        Text(backend, columns[1], row, line, kText);
+        swprintf(line, 96, L"%.2f", Milliseconds(summary.p50));
+        Text(backend, columns[2], row, line, kText);
+        swprintf(line, 96, L"%.2f", Milliseconds(summary.p99));
+        Text(backend, columns[3], row, line, summary.p99 >= (64u << (kSlowBucket - 1)) ? kSlowBar : kText);
+    }
+
+    if (resize.frames == 0)
+        return;
+
+    row += kRowPitch + 6;
+    Text(backend, columns[0], row, L"Resize", kSecondary);
+    swprintf(line, 96, L"%u frames, %u allocations", resize.frames, resize.allocations);
+    Text(backend, columns[1], row, line, kText);
+    row += kRowPitch;
+    swprintf(line, 96, L"avg %.2f  max %.2f ms", resize.averageMilliseconds, resize.maxMilliseconds);
+    Text(backend, columns[1], row, line, resize.maxMilliseconds >= 16.0 ? kSlowBar : kText);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Profiler.h"
+#include "RenderBackend.h"
+
+////////////////////////////////////////////////////////////////////////
+// Struct: HudResizeStats
+// Purpose: The last drag of the window edge (the back buffer's counters)
+////////////////////////////////////////////////////////////////////////
+struct HudResizeStats {
+    uint32_t frames = 0;                // 0: no drag yet, nothing is shown
+    uint32_t allocations = 0;           // Back buffer bitmaps created
+    double averageMilliseconds = 0;     // Per frame
+    double maxMilliseconds = 0;
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: ProfilerHud
+// Purpose: The timing overlay: frame time, the frame histogram,
+//          p50/p99 per zone and the last resize drag. Drawn through a
+//          RenderBackend like the cards, translucent over whatever is
+//          below it. `summaries` holds one ProfileSummary per ProfileZone.
+////////////////////////////////////////////////////////////////////////
+class ProfilerHud {
+public:
+    static constexpr int kWidth = 300;
+    static constexpr int kHeight = 330;
+
+    static void Paint(RenderBackend& backend, int x, int y,
+        const ProfileSummary (&summaries)[static_cast<int>(ProfileZone::Count)],
+        const HudResizeStats& resize);
+};
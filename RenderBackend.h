@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>             // size_t
+#include <cstdint>             // Colors, pixels
+
+// 0xAARRGGBB with straight alpha (the layout of GDI+ ARGB)
+using RenderColor = uint32_t;
+
+constexpr RenderColor MakeRenderColor(uint8_t a, uint8_t r, uint8_t g, uint8_t b) {
+    return (RenderColor(a) << 24) | (RenderColor(r) << 16) | (RenderColor(g) << 8) | RenderColor(b);
+}
+
+// Logical fonts; each backend maps them to what it can draw
+enum class RenderFont : uint8_t {
+    Title,      // Window header
+    Subtitle,
+    Label,      // Grid card names
+    Row,        // List and details names
+    Detail      // Secondary text
+};
+
+////////////////////////////////////////////////////////////////////////
+// Struct: RenderImage
+// Purpose: A bitmap either backend can draw: top-down 0xAARRGGBB rows
+//          (`pixels`, rows packed) for the software backend, or a
+//          platform handle (`native`, an HBITMAP for GDI). A native image
+//          may be one cell of a larger bitmap (the icon atlas): it is the
+//          width x height area at (left, top)
+////////////////////////////////////////////////////////////////////////
+struct RenderImage {
+    const uint32_t* pixels = nullptr;
+    int width = 0;
+    int height = 0;
+    const void* native = nullptr;
+    int left = 0;
+    int top = 0;
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: RenderBackend
+// Purpose: The drawing primitives the launcher's cards are made of.
+//          GdiRenderBackend draws into a window DC with GDI/GDI+;
+//          SoftwareRenderBackend rasterizes into a pixel buffer with no
+//          platform dependency, so rendering can run (and be measured)
+//          without a Windows session.
+//          Coordinates are pixels; shapes follow GDI+ conventions
+//          (a w x h rounded rect outline spans x..x+w, y..y+h).
+////////////////////////////////////////////////////////////////////////
+class RenderBackend {
+public:
+    virtual ~RenderBackend() = default;
+
+    virtual void FillRect(int x, int y, int width, int height, RenderColor color) = 0;
+    virtual void FillVerticalGradient(int x, int y, int width, int height,
+        RenderColor top, RenderColor bottom) = 0;
+
+    // Anti-aliased; alpha blends over what is already there
+    virtual void FillRoundedRect(int x, int y, int width, int height, int radius, RenderColor color) = 0;
+    virtual void StrokeRoundedRect(int x, int y, int width, int height, int radius,
+        float penWidth, RenderColor color) = 0;
+
+    // Scales `image` into the width x height box at (x, y)
+    virtual void DrawImage(int x, int y, int width, int height, const RenderImage& image) = 0;
+
+    // Single line, (x, y) is the top left of the line box
+    virtual int GetLineHeight(RenderFont font) = 0;
+    virtual void MeasureText(RenderFont font, const wchar_t* text, size_t length, int* extents) = 0;
+    virtual void DrawString(RenderFont font, int x, int y, const wchar_t* text, size_t length,
+        RenderColor color) = 0;
+};
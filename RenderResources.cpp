@@ -0,0 +1,158 @@
+#include "RenderResources.h"
+
+RenderResources::~RenderResources() {
+    Reset();
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : GetFont
+// Purpose  : ClearType Swiss font of the given pixel height and weight
+//////////////////////////////////////////////////////////////////////
+HFONT RenderResources::GetFont(int height, int weight, const wchar_t* face) {
+    for (const auto& entry : fonts) {
+        if (entry.height == height && entry.weight == weight && entry.face == face)
+            return entry.font;
+    }
+
+    HFONT font = CreateFont(height, 0, 0, 0, weight, FALSE, FALSE, FALSE,
+        DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
+        CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_SWISS, face);
+    fonts.push_back({ height, weight, face, font });
+    ++creations;
+    return font;
+}
+
+HBRUSH RenderResources::GetBrush(COLORREF color) {
+    for (const auto& entry : brushes) {
+        if (entry.color == color)
+            return entry.brush;
+    }
+
+    HBRUSH brush = CreateSolidBrush(color);
+    brushes.push_back({ color, brush });
+    ++creations;
+    return brush;
+}
+
+HPEN RenderResources::GetPen(COLORREF color, int width) {
+    for (const auto& entry : pens) {
+        if (entry.color == color && entry.width == width)
+            return entry.pen;
+    }
+
+    HPEN pen = CreatePen(PS_SOLID, width, color);
+    pens.push_back({ color, width, pen });
+    ++creations;
+    return pen;
+}
+
+HDC RenderResources::GetMemoryDC() {
+    if (!memoryDC) {
+        memoryDC = CreateCompatibleDC(nullptr);
+        ++creations;
+    }
+    return memoryDC;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : GetGraphics
+// Purpose  : One Graphics per target DC; a different DC replaces it
+//////////////////////////////////////////////////////////////////////
+Graphics* RenderResources::GetGraphics(HDC hdc) {
+    if (!graphics || graphicsDC != hdc) {
+        graphics = std::make_unique<Graphics>(hdc);
+        graphics->SetSmoothingMode(SmoothingModeAntiAlias);
+        graphics->SetTextRenderingHint(TextRenderingHintClearTypeGridFit);
+        graphicsDC = hdc;
+        ++creations;
+    }
+    return graphics.get();
+}
+
+void RenderResources::ReleaseGraphics() {
+    graphics.reset();
+    graphicsDC = nullptr;
+}
+
+SolidBrush* RenderResources::GetSolidBrush(const Color& color) {
+    const ARGB value = color.GetValue();
+    for (const auto& entry : solidBrushes) {
+        if (entry.color == value)
+            return entry.brush.get();
+    }
+
+    solidBrushes.push_back({ value, std::make_unique<SolidBrush>(color) });
+    ++creations;
+    return solidBrushes.back().brush.get();
+}
+
+Pen* RenderResources::GetSolidPen(const Color& color, REAL width) {
+    const ARGB value = color.GetValue();
+    for (const auto& entry : solidPens) {
+        if (entry.color == value && entry.width == width)
+            return entry.pen.get();
+    }
+
+    solidPens.push_back({ value, width, std::make_unique<Pen>(color, width) });
+    ++creations;
+    return solidPens.back().pen.get();
+}
+
+LinearGradientBrush* RenderResources::GetVerticalGradient(int height, const Color& top, const Color& bottom) {
+    for (const auto& entry : gradients) {
+        if (entry.height == height && entry.top == top.GetValue() && entry.bottom == bottom.GetValue())
+            return entry.brush.get();
+    }
+
+    gradients.push_back({ height, top.GetValue(), bottom.GetValue(),
+        std::make_unique<LinearGradientBrush>(Point(0, 0), Point(0, height), top, bottom) });
+    ++creations;
+    return gradients.back().brush.get();
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : GetRoundedRect
+// Purpose  : Card outlines differ only in position, so one path per
+//            size serves every card
+//////////////////////////////////////////////////////////////////////
+GraphicsPath* RenderResources::GetRoundedRect(int w, int h, int r) {
+    for (const auto& entry : paths) {
+        if (entry.width == w && entry.height == h && entry.radius == r)
+            return entry.path.get();
+    }
+
+    auto path = std::make_unique<GraphicsPath>();
+    path->AddArc(0, 0, r * 2, r * 2, 180, 90);
+    path->AddArc(w - r * 2, 0, r * 2, r * 2, 270, 90);
+    path->AddArc(w - r * 2, h - r * 2, r * 2, r * 2, 0, 90);
+    path->AddArc(0, h - r * 2, r * 2, r * 2, 90, 90);
+    path->CloseFigure();
+
+    paths.push_back({ w, h, r, std::move(path) });
+    ++creations;
+    return paths.back().path.get();
+}
+
+void RenderResources::Reset() {
+    ReleaseGraphics();
+
+    for (const auto& entry : fonts)
+        DeleteObject(entry.font);
+    for (const auto& entry : brushes)
+        DeleteObject(entry.brush);
+    for (const auto& entry : pens)
+        DeleteObject(entry.pen);
+    fonts.clear();
+    brushes.clear();
+    pens.clear();
+
+    solidBrushes.clear();
+    solidPens.clear();
+    gradients.clear();
+    paths.clear();
+
+    if (memoryDC) {
+        DeleteDC(memoryDC);
+        memoryDC = nullptr;
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <windows.h>
+#include <gdiplus.h>           // GDI+ brushes, pens, paths
+#include <memory>              // Owned GDI+ objects
+#include <string>              // Font face names
+#include <vector>              // Cache entries
+using namespace Gdiplus;
+
+///////////////////////////////////////////////////////////////////////////////
+// Class: RenderResources
+// Purpose: Owns every GDI and GDI+ object the window paints with. Objects
+//          are created on first request and kept until Reset (theme or DPI
+//          change) or destruction, so a steady-state paint creates none.
+//          Caches are short vectors searched linearly: a window uses a
+//          handful of fonts and colours, and a lookup must not allocate.
+///////////////////////////////////////////////////////////////////////////////
+class RenderResources
+{
+public:
+    RenderResources() = default;
+    ~RenderResources();
+
+    RenderResources(const RenderResources&) = delete;
+    RenderResources& operator=(const RenderResources&) = delete;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // GDI
+    ///////////////////////////////////////////////////////////////////////////
+    HFONT GetFont(int height, int weight, const wchar_t* face);
+    HBRUSH GetBrush(COLORREF color);
+    HPEN GetPen(COLORREF color, int width);
+
+    // Source DC for bitmap blits; select a bitmap in, blit, select it out
+    HDC GetMemoryDC();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // GDI+
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Graphics for a long-lived target DC (the back buffer); anti-aliased
+    Graphics* GetGraphics(HDC hdc);
+
+    // Drop the Graphics before its DC is deleted
+    void ReleaseGraphics();
+
+    SolidBrush* GetSolidBrush(const Color& color);
+    Pen* GetSolidPen(const Color& color, REAL width);
+    LinearGradientBrush* GetVerticalGradient(int height, const Color& top, const Color& bottom);
+
+    // Rounded rectangle outline at (0, 0); draw it under a translation
+    GraphicsPath* GetRoundedRect(int width, int height, int radius);
+
+    // Frees everything; later requests build fresh objects
+    void Reset();
+
+    // Objects created so far (a repeated paint should not change it)
+    size_t GetCreationCount() const { return creations; }
+
+private:
+    struct FontEntry { int height; int weight; std::wstring face; HFONT font; };
+    struct BrushEntry { COLORREF color; HBRUSH brush; };
+    struct PenEntry { COLORREF color; int width; HPEN pen; };
+    struct SolidBrushEntry { ARGB color; std::unique_ptr<SolidBrush> brush; };
+    struct SolidPenEntry { ARGB color; REAL width; std::unique_ptr<Pen> pen; };
+    struct GradientEntry { int height; ARGB top; ARGB bottom; std::unique_ptr<LinearGradientBrush> brush; };
+    struct PathEntry { int width; int height; int radius; std::unique_ptr<GraphicsPath> path; };
+
+    std::vector<FontEntry> fonts;
+    std::vector<BrushEntry> brushes;
+    std::vector<PenEntry> pens;
+    std::vector<SolidBrushEntry> solidBrushes;
+    std::vector<SolidPenEntry> solidPens;
+    std::vector<GradientEntry> gradients;
+    std::vector<PathEntry> paths;
+
+    HDC memoryDC = nullptr;
+    HDC graphicsDC = nullptr;
+    std::unique_ptr<Graphics> graphics;
+
+    size_t creations = 0;
+};
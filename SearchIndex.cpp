@@ -0,0 +1,342 @@
+#include "SearchIndex.h"
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+
+//////////////////////////////////////////////////////////////////////
+// PackTrigram: 21 bits per code unit covers UTF-16 and UTF-32 wchar_t
+//////////////////////////////////////////////////////////////////////
+uint64_t SearchIndex::PackTrigram(const wchar_t* text) {
+    const uint64_t mask = 0x1FFFFF;
+    return ((static_cast<uint64_t>(text[0]) & mask) << 42) |
+        ((static_cast<uint64_t>(text[1]) & mask) << 21) |
+        (static_cast<uint64_t>(text[2]) & mask);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Clear
+//////////////////////////////////////////////////////////////////////
+void SearchIndex::Clear() {
+    trigrams.clear();
+    offsets.clear();
+    postings.clear();
+    keyText.clear();
+    keyOffsets.clear();
+    keyMasks.clear();
+}
+
+//////////////////////////////////////////////////////////////////////
+// Build: Two passes - count postings per trigram, then fill them in id
+//        order, so every posting list comes out sorted without a sort
+//////////////////////////////////////////////////////////////////////
+void SearchIndex::Build(const std::vector<std::wstring>& keys) {
+    Clear();
+
+    size_t totalLength = 0;
+    for (const auto& key : keys)
+        totalLength += key.size();
+
+    keyText.reserve(totalLength);
+    keyOffsets.reserve(keys.size() + 1);
+    keyMasks.reserve(keys.size());
+    keyOffsets.push_back(0);
+    for (const auto& key : keys) {
+        keyText += key;
+        keyOffsets.push_back(static_cast<uint32_t>(keyText.size()));
+        keyMasks.push_back(FuzzyMatcher::CharMask(key.data(), key.size()));
+    }
+
+    // Distinct trigrams of every key, reused across both passes
+    std::vector<uint64_t> keyTrigrams;
+    auto collect = [&](size_t id) {
+        keyTrigrams.clear();
+        const wchar_t* text = keyText.data() + keyOffsets[id];
+        const size_t length = keyOffsets[id + 1] - keyOffsets[id];
+        for (size_t i = 0; i + 3 <= length; ++i)
+            keyTrigrams.push_back(PackTrigram(text + i));
+
+        std::sort(keyTrigrams.begin(), keyTrigrams.end());
+        keyTrigrams.erase(std::unique(keyTrigrams.begin(), keyTrigrams.end()), keyTrigrams.end());
+    };
+
+    // Pass 1: posting list sizes
+    std::unordered_map<uint64_t, uint32_t> counts;
+    counts.reserve(totalLength);
+    size_t postingCount = 0;
+    for (size_t id = 0; id < keys.size(); ++id) {
+        collect(id);
+        for (uint64_t trigram : keyTrigrams)
+            ++counts[trigram];
+        postingCount += keyTrigrams.size();
+    }
+
+    trigrams.reserve(counts.size());
+    for (const auto& entry : counts)
+        trigrams.push_back(entry.first);
+    std::sort(trigrams.begin(), trigrams.end());
+
+    // Offsets, and a write cursor per trigram (reusing the count map)
+    offsets.resize(trigrams.size() + 1);
+    uint32_t running = 0;
+    for (size_t i = 0; i < trigrams.size(); ++i) {
+        offsets[i] = running;
+        uint32_t& slot = counts[trigrams[i]];
+        running += slot;
+        slot = offsets[i];
+    }
+    offsets[trigrams.size()] = running;
+
+    // Pass 2: ids ascend, so each list is filled in sorted order
+    postings.resize(postingCount);
+    for (size_t id = 0; id < keys.size(); ++id) {
+        collect(id);
+        for (uint64_t trigram : keyTrigrams)
+            postings[counts[trigram]++] = static_cast<uint32_t>(id);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// IntersectInPlace: Galloping search - each candidate probes 1, 2, 4...
+//                   elements ahead, then binary searches that window.
+//                   Cost grows with the short list, not the long one.
+//////////////////////////////////////////////////////////////////////
+void SearchIndex::IntersectInPlace(std::vector<uint32_t>& candidates,
+    const uint32_t* list, size_t listSize) {
+    size_t kept = 0;
+    size_t low = 0;
+
+    for (uint32_t value : candidates) {
+        size_t step = 1;
+        size_t high = low;
+        while (high < listSize && list[high] < value) {
+            low = high + 1;
+            high += step;
+            step *= 2;
+        }
+        high = (std::min)(high + 1, listSize);
+
+        low = std::lower_bound(list + low, list + high, value) - list;
+        if (low == listSize)
+            break;
+        if (list[low] == value)
+            candidates[kept++] = value;
+    }
+
+    candidates.resize(kept);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Contains: Substring test against one stored key
+//////////////////////////////////////////////////////////////////////
+bool SearchIndex::Contains(uint32_t id, const std::wstring& query) const {
+    if (id + 1 >= keyOffsets.size())
+        return false;
+
+    std::wstring_view key(keyText.data() + keyOffsets[id], keyOffsets[id + 1] - keyOffsets[id]);
+    return key.find(query) != std::wstring_view::npos;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Find: Short queries have no trigram and fall back to a scan of the
+//       contiguous key buffer; longer ones only verify intersected ids
+//////////////////////////////////////////////////////////////////////
+bool SearchIndex::Find(const std::wstring& query, std::vector<uint32_t>& results,
+    SearchScratch& scratch) const {
+    results.clear();
+    const uint32_t keyCount = static_cast<uint32_t>(GetKeyCount());
+
+    if (query.size() < 3) {
+        for (uint32_t id = 0; id < keyCount; ++id) {
+            if (id % FuzzyMatcher::kCancelStride == 0 && scratch.IsCancelled())
+                return false;
+            if (query.empty() || Contains(id, query))
+                results.push_back(id);
+        }
+        return true;
+    }
+
+    // Posting list of every distinct query trigram, shortest first
+    std::vector<PostingList>& lists = scratch.lists;
+    lists.clear();
+
+    for (size_t i = 0; i + 3 <= query.size(); ++i) {
+        uint64_t trigram = PackTrigram(query.data() + i);
+        auto it = std::lower_bound(trigrams.begin(), trigrams.end(), trigram);
+        if (it == trigrams.end() || *it != trigram)
+            return true;   // A trigram no key has - nothing can match
+
+        size_t slot = it - trigrams.begin();
+        PostingList list = { postings.data() + offsets[slot], offsets[slot + 1] - offsets[slot] };
+        if (std::none_of(lists.begin(), lists.end(), [&](const PostingList& l) { return l.ids == list.ids; }))
+            lists.push_back(list);
+    }
+
+    std::sort(lists.begin(), lists.end(),
+        [](const PostingList& a, const PostingList& b) { return a.size < b.size; });
+
+    results.assign(lists.front().ids, lists.front().ids + lists.front().size);
+    for (size_t i = 1; i < lists.size() && !results.empty(); ++i) {
+        if (scratch.IsCancelled())
+            return false;
+        IntersectInPlace(results, lists[i].ids, lists[i].size);
+    }
+
+    // Trigrams can match out of order ("abcxbcd" has abc and bcd) - verify
+    if (query.size() > 3) {
+        results.erase(std::remove_if(results.begin(), results.end(),
+            [&](uint32_t id) { return !Contains(id, query); }), results.end());
+    }
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// FindRanked: Substring tier from the trigram index, fuzzy tier from a
+//             mask-filtered pass over every other key
+//////////////////////////////////////////////////////////////////////
+bool SearchIndex::FindRanked(const std::wstring& query, std::vector<uint32_t>& results,
+    SearchScratch& scratch) const {
+    if (!Find(query, results, scratch))
+        return false;
+    if (query.empty())
+        return true;
+
+    const FuzzyKeyTable table = GetKeyTable();
+    const FuzzyMatcher matcher(query);
+
+    scratch.exact.clear();
+    matcher.ScoreBatch(table, results.data(), results.size(), scratch.exact, scratch.cancelled);
+
+    scratch.fuzzy.clear();
+    matcher.ScoreAll(table, results, scratch.fuzzy, scratch.cancelled);
+
+    if (scratch.IsCancelled())
+        return false;
+
+    MergeTiers(table, scratch, results);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// FindRankedWithin: Same tiers, but only the candidates are examined
+//////////////////////////////////////////////////////////////////////
+bool SearchIndex::FindRankedWithin(const std::wstring& query, const std::vector<uint32_t>& candidates,
+    std::vector<uint32_t>& results, SearchScratch& scratch) const {
+    const FuzzyKeyTable table = GetKeyTable();
+    const FuzzyMatcher matcher(query);
+
+    // Split into substring and fuzzy-only candidates, then score each tier
+    scratch.substring.clear();
+    scratch.rest.clear();
+    for (uint32_t id : candidates) {
+        if (id >= table.count)
+            continue;
+        (Contains(id, query) ? scratch.substring : scratch.rest).push_back(id);
+    }
+
+    scratch.exact.clear();
+    matcher.ScoreBatch(table, scratch.substring.data(), scratch.substring.size(),
+        scratch.exact, scratch.cancelled);
+
+    scratch.fuzzy.clear();
+    matcher.ScoreBatch(table, scratch.rest.data(), scratch.rest.size(),
+        scratch.fuzzy, scratch.cancelled);
+
+    if (scratch.IsCancelled())
+        return false;
+
+    MergeTiers(table, scratch, results);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// MergeTiers: Exact substrings are what users expect on top; fuzzy
+//             matches only fill in below them
+//////////////////////////////////////////////////////////////////////
+void SearchIndex::MergeTiers(const FuzzyKeyTable& table, SearchScratch& scratch,
+    std::vector<uint32_t>& results) {
+    FuzzyMatcher::Rank(table, scratch.exact, scratch.sortKeys);
+    FuzzyMatcher::Rank(table, scratch.fuzzy, scratch.sortKeys);
+
+    results.clear();
+    for (const auto& hit : scratch.exact)
+        results.push_back(hit.id);
+    for (const auto& hit : scratch.fuzzy)
+        results.push_back(hit.id);
+}
+
+FuzzyKeyTable SearchIndex::GetKeyTable() const {
+    FuzzyKeyTable table;
+    table.text = keyText.data();
+    table.offsets = keyOffsets.data();
+    table.masks = keyMasks.data();
+    table.count = GetKeyCount();
+    return table;
+}
+
+//////////////////////////////////////////////////////////////////////
+// SearchSession::IsSubsequence: If the old query is a subsequence of
+//     the new one, every new match (substring or fuzzy) was an old match
+//////////////////////////////////////////////////////////////////////
+bool SearchSession::IsSubsequence(const std::wstring& part, const std::wstring& whole) {
+    size_t matched = 0;
+    for (size_t i = 0; i < whole.size() && matched < part.size(); ++i) {
+        if (whole[i] == part[matched])
+            ++matched;
+    }
+    return matched == part.size();
+}
+
+//////////////////////////////////////////////////////////////////////
+// SearchSession::Reset / PopStep: Steps are recycled, not freed
+//////////////////////////////////////////////////////////////////////
+void SearchSession::Reset() {
+    while (!history.empty())
+        PopStep();
+}
+
+void SearchSession::PopStep() {
+    spare.push_back(std::move(history.back()));
+    history.pop_back();
+}
+
+//////////////////////////////////////////////////////////////////////
+// SearchSession::Search
+//////////////////////////////////////////////////////////////////////
+const std::vector<uint32_t>* SearchSession::Search(const std::wstring& query) {
+    // Drop steps the new query no longer builds on (backspace, edits)
+    while (!history.empty() && !IsSubsequence(history.back().query, query))
+        PopStep();
+
+    if (!history.empty() && history.back().query == query)
+        return &history.back().results;
+
+    // Oldest step makes room; its buffers are reused for the new one
+    if (history.size() == kMaxSteps) {
+        spare.push_back(std::move(history.front()));
+        history.erase(history.begin());
+    }
+
+    Step step;
+    if (!spare.empty()) {
+        step = std::move(spare.back());
+        spare.pop_back();
+    }
+    step.query = query;
+
+    // The first query with a trigram goes to the index: its posting lists
+    // are smaller than the survivors of a one- or two-character query
+    bool complete;
+    if (history.empty() || (query.size() >= 3 && history.back().query.size() < 3))
+        complete = index.FindRanked(query, step.results, scratch);
+    else
+        complete = index.FindRankedWithin(query, history.back().results, step.results, scratch);
+
+    // Partial results must never be narrowed from later
+    if (!complete) {
+        spare.push_back(std::move(step));
+        return nullptr;
+    }
+
+    history.push_back(std::move(step));
+    return &history.back().results;
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>              // Cancellation flag
+#include <cstdint>             // Compact posting ids
+#include "FuzzyMatcher.h"      // Ranking of the matches
+#include <string>              // std::wstring keys
+#include <vector>              // CSR arrays
+
+////////////////////////////////////////////////////////////////////////
+// Struct: SearchScratch
+// Purpose: Working buffers of one search. Owned by the caller and reused
+//          across queries, so steady-state searching does not allocate.
+//          `cancelled` (optional) is polled; once set, searches give up.
+////////////////////////////////////////////////////////////////////////
+struct PostingList {
+    const uint32_t* ids;
+    size_t size;
+};
+
+struct SearchScratch {
+    std::vector<PostingList> lists;   // Query trigram posting lists
+    std::vector<uint32_t> substring;  // Candidates containing the query
+    std::vector<uint32_t> rest;       // Candidates that may match fuzzily
+    std::vector<FuzzyHit> exact;      // Scored substring tier
+    std::vector<FuzzyHit> fuzzy;      // Scored fuzzy tier
+    std::vector<uint64_t> sortKeys;   // FuzzyMatcher::Rank keys
+    const std::atomic<bool>* cancelled = nullptr;
+
+    bool IsCancelled() const { return cancelled && cancelled->load(std::memory_order_relaxed); }
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: SearchIndex
+// Purpose: Substring search over normalized keys via a trigram index.
+//          Built once per catalog change; a query intersects the posting
+//          lists of its trigrams and only verifies the survivors.
+//
+// Storage is three flat arrays (CSR layout):
+//   trigrams  sorted distinct trigrams (three code units packed in 63 bits)
+//   offsets   postings of trigrams[i] are postings[offsets[i], offsets[i+1])
+//   postings  ascending key ids
+// Keys are kept in one contiguous buffer so verification stays in cache,
+// with a FuzzyMatcher character mask per key for the fuzzy tier.
+////////////////////////////////////////////////////////////////////////
+class SearchIndex {
+public:
+    // Replaces the index; key i is reported as id i
+    void Build(const std::vector<std::wstring>& keys);
+
+    // Drops all keys and postings
+    void Clear();
+
+    // Ids (ascending) of all keys that contain the normalized query.
+    // The Find* calls return false if cancelled (results are then partial).
+    bool Find(const std::wstring& query, std::vector<uint32_t>& results,
+        SearchScratch& scratch) const;
+
+    // Ranked ids: substring matches first, then fuzzy (subsequence)
+    // matches, each tier ordered by FuzzyMatcher score
+    bool FindRanked(const std::wstring& query, std::vector<uint32_t>& results,
+        SearchScratch& scratch) const;
+
+    // FindRanked restricted to the given candidate ids (any order)
+    bool FindRankedWithin(const std::wstring& query, const std::vector<uint32_t>& candidates,
+        std::vector<uint32_t>& results, SearchScratch& scratch) const;
+
+    // True if key `id` contains the query (the verification step)
+    bool Contains(uint32_t id, const std::wstring& query) const;
+
+    size_t GetKeyCount() const { return keyOffsets.empty() ? 0 : keyOffsets.size() - 1; }
+
+private:
+    std::vector<uint64_t> trigrams;
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> postings;
+
+    std::wstring keyText;               // All keys back to back
+    std::vector<uint32_t> keyOffsets;   // Key i is keyText[keyOffsets[i], keyOffsets[i+1])
+    std::vector<uint64_t> keyMasks;     // FuzzyMatcher::CharMask per key
+
+    FuzzyKeyTable GetKeyTable() const;
+
+    // Ranks both tiers and writes the ids of exact, then fuzzy hits
+    static void MergeTiers(const FuzzyKeyTable& table, SearchScratch& scratch,
+        std::vector<uint32_t>& results);
+
+    // Packs text[pos..pos+2] into one sortable integer
+    static uint64_t PackTrigram(const wchar_t* text);
+
+    // Intersects an ascending candidate list with one posting list in place
+    static void IntersectInPlace(std::vector<uint32_t>& candidates,
+        const uint32_t* list, size_t listSize);
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: SearchSession
+// Purpose: Keystroke-level search on top of a SearchIndex. Keeps a small
+//          stack of recent (query, results) steps:
+//          - typing more (the old query is a subsequence of the new one)
+//            only re-checks the previous results, which can only shrink
+//          - backspace pops back to a remembered step without searching
+//          Reset() whenever the index is rebuilt.
+////////////////////////////////////////////////////////////////////////
+class SearchSession {
+public:
+    explicit SearchSession(const SearchIndex& index) : index(index) {}
+
+    // Ranked ids for the query; valid until the next Search or Reset.
+    // nullptr if the search was cancelled (nothing is remembered then).
+    const std::vector<uint32_t>* Search(const std::wstring& query);
+
+    // Flag polled by every search of this session (another thread sets it)
+    void SetCancelFlag(const std::atomic<bool>* cancelled) { scratch.cancelled = cancelled; }
+
+    // Forgets every step (ids refer to the old index)
+    void Reset();
+
+private:
+    struct Step {
+        std::wstring query;
+        std::vector<uint32_t> results;
+    };
+
+    static constexpr size_t kMaxSteps = 16;
+
+    const SearchIndex& index;
+    std::vector<Step> history;   // Each query is a subsequence of the next
+    std::vector<Step> spare;     // Popped steps, reused with their capacity
+    SearchScratch scratch;
+
+    // Moves the newest step to the spare pool
+    void PopStep();
+
+    // True if every character of `part` appears in `whole` in order
+    static bool IsSubsequence(const std::wstring& part, const std::wstring& whole);
+};
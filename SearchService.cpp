@@ -0,0 +1,160 @@
+#include "SearchService.h"
+#include "Profiler.h"
+#include <algorithm>
+
+SearchService::SearchService() {
+    session.SetCancelFlag(&cancelled);
+}
+
+SearchService::~SearchService() {
+    Stop();
+}
+
+void SearchService::SetTiming(std::chrono::milliseconds quiet, std::chrono::milliseconds delay) {
+    std::lock_guard<std::mutex> guard(lock);
+    quietPeriod = quiet;
+    maxDelay = delay;
+}
+
+void SearchService::Start(ResultCallback callback) {
+    Stop();
+
+    onResult = std::move(callback);
+    running = true;
+    worker = std::thread(&SearchService::WorkLoop, this);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Stop: Abandons the running search and joins the worker
+//////////////////////////////////////////////////////////////////////
+void SearchService::Stop() {
+    {
+        // Taken so the worker cannot miss the wake-up below
+        std::lock_guard<std::mutex> guard(lock);
+        running = false;
+        cancelled = true;
+    }
+
+    wake.notify_all();
+
+    if (worker.joinable())
+        worker.join();
+
+    std::lock_guard<std::mutex> guard(lock);
+    pendingGeneration = 0;
+    hasCompleted = false;
+}
+
+//////////////////////////////////////////////////////////////////////
+// SetKeys: A search in flight works on ids of the old catalog - stop it
+//////////////////////////////////////////////////////////////////////
+void SearchService::SetKeys(std::vector<std::wstring>&& keys) {
+    std::lock_guard<std::mutex> guard(lock);
+    pendingKeys = std::move(keys);
+    keysPending = true;
+    cancelled = true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Submit: Replaces any queued query and cancels the running one
+//////////////////////////////////////////////////////////////////////
+uint32_t SearchService::Submit(const std::wstring& query) {
+    uint32_t submitted;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (++generation == 0)
+            ++generation;
+
+        const Clock::time_point now = Clock::now();
+        if (pendingGeneration == 0)
+            firstSubmit = now;
+        lastSubmit = now;
+
+        pendingQuery = query;
+        pendingGeneration = submitted = generation;
+        cancelled = true;
+    }
+
+    wake.notify_all();
+    return submitted;
+}
+
+void SearchService::Cancel() {
+    std::lock_guard<std::mutex> guard(lock);
+    if (++generation == 0)
+        ++generation;
+    pendingGeneration = 0;
+    hasCompleted = false;
+    cancelled = true;
+}
+
+bool SearchService::TakeResult(SearchResult& result) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (!hasCompleted)
+        return false;
+
+    // Swapped, not copied: both buffers keep their capacity
+    result.generation = completed.generation;
+    result.ids.swap(completed.ids);
+    hasCompleted = false;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// WorkLoop: Debounce, search outside the lock, publish if still newest
+//////////////////////////////////////////////////////////////////////
+void SearchService::WorkLoop() {
+    std::unique_lock<std::mutex> guard(lock);
+
+    while (running) {
+        if (pendingGeneration == 0) {
+            wake.wait(guard);
+            continue;
+        }
+
+        const Clock::time_point now = Clock::now();
+        const Clock::time_point deadline = (std::min)(lastSubmit + quietPeriod, firstSubmit + maxDelay);
+        if (now < deadline) {
+            wake.wait_until(guard, deadline);
+            continue;
+        }
+
+        const uint32_t searching = pendingGeneration;
+        pendingGeneration = 0;
+        workQuery = pendingQuery;
+
+        const bool rebuild = keysPending;
+        if (rebuild) {
+            workKeys.swap(pendingKeys);
+            keysPending = false;
+        }
+
+        // Set again by any Submit/SetKeys/Cancel from here on
+        cancelled = false;
+        guard.unlock();
+
+        if (rebuild) {
+            index.Build(workKeys);
+            session.Reset();
+        }
+        const std::vector<uint32_t>* ids;
+        {
+            ScopedTimer timer(ProfileZone::Search);
+            ids = session.Search(workQuery);
+        }
+
+        guard.lock();
+        if (!ids || searching != generation)
+            continue;   // Superseded while searching
+
+        completed.generation = searching;
+        completed.ids.assign(ids->begin(), ids->end());
+        hasCompleted = true;
+
+        // Never hold the lock while the callback runs
+        guard.unlock();
+        if (onResult)
+            onResult();
+        guard.lock();
+    }
+}
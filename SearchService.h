@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>              // Running and cancellation flags
+#include <chrono>              // Debounce timing
+#include <condition_variable>  // Wakes the worker
+#include <functional>          // Result callback
+#include <mutex>               // Guards the request/result slots
+#include "SearchIndex.h"       // Index + keystroke session owned by the worker
+#include <string>              // std::wstring queries
+#include <thread>              // Worker thread
+#include <vector>              // Keys and result ids
+
+////////////////////////////////////////////////////////////////////////
+// Struct: SearchResult
+// Purpose: Ranked ids of one finished query, tagged with the generation
+//          Submit() returned for it
+////////////////////////////////////////////////////////////////////////
+struct SearchResult {
+    uint32_t generation = 0;
+    std::vector<uint32_t> ids;
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: SearchService
+// Purpose: Runs searches on a worker thread so typing never waits for
+//          them. The worker owns the SearchIndex and SearchSession; the
+//          UI thread only hands over keys and queries.
+//          - every Submit() supersedes the previous query: a search in
+//            flight is cancelled cooperatively, a waiting one replaced
+//          - a query starts once typing pauses for the debounce delay
+//            (or the max delay expires while a key is held down)
+//          - only a result that is still the newest is published
+////////////////////////////////////////////////////////////////////////
+class SearchService {
+public:
+    // Called on the worker thread - marshal to the UI thread yourself
+    using ResultCallback = std::function<void()>;
+
+    SearchService();
+    ~SearchService();
+
+    void Start(ResultCallback callback);
+
+    // Stops the worker; no callback runs after this returns
+    void Stop();
+
+    // Replaces the searchable keys (key i is reported as id i). The index
+    // is rebuilt on the worker before the next query.
+    void SetKeys(std::vector<std::wstring>&& keys);
+
+    // Queues a normalized query; returns its generation (never 0)
+    uint32_t Submit(const std::wstring& query);
+
+    // Drops the queued query and abandons the running one
+    void Cancel();
+
+    // Moves the published result out (swapping buffers with `result`)
+    bool TakeResult(SearchResult& result);
+
+    // Debounce tuning (defaults: 30 ms quiet, 120 ms max delay)
+    void SetTiming(std::chrono::milliseconds quiet, std::chrono::milliseconds maxDelay);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    SearchIndex index;
+    SearchSession session{ index };
+    ResultCallback onResult;
+    std::atomic<bool> running{ false };
+    std::atomic<bool> cancelled{ false };   // Polled by the running search
+
+    std::mutex lock;
+    std::condition_variable wake;
+    uint32_t generation = 0;               // Newest Submit/Cancel
+    uint32_t pendingGeneration = 0;        // Queued query (0 = none)
+    std::wstring pendingQuery;
+    std::vector<std::wstring> pendingKeys;
+    bool keysPending = false;
+    SearchResult completed;
+    bool hasCompleted = false;
+    Clock::time_point firstSubmit;
+    Clock::time_point lastSubmit;
+    std::chrono::milliseconds quietPeriod{ 30 };
+    std::chrono::milliseconds maxDelay{ 120 };
+
+    // Worker-only copies, reused across queries
+    std::wstring workQuery;
+    std::vector<std::wstring> workKeys;
+
+    std::thread worker;
+
+    // Waits for debounced queries, searches and publishes the results
+    void WorkLoop();
+};
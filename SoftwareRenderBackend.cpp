@@ -0,0 +1,189 @@
+#include "SoftwareRenderBackend.h"
+#include "GlyphAtlas.h"
+#include <algorithm>           // std::min, std::max, std::fill
+#include <cmath>               // Rounded rect distances
+
+SoftwareRenderBackend::SoftwareRenderBackend(int width, int height)
+    : width((std::max)(0, width)), height((std::max)(0, height)),
+      pixels(static_cast<size_t>(this->width) * this->height, 0xFF000000u) {}
+
+void SoftwareRenderBackend::Clear(RenderColor color) {
+    std::fill(pixels.begin(), pixels.end(), color);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Blend: Straight-alpha source-over; Div255 is v / 255 rounded
+//////////////////////////////////////////////////////////////////////
+static inline unsigned Div255(unsigned v) {
+    v += 128;
+    return (v + (v >> 8)) >> 8;
+}
+
+void SoftwareRenderBackend::Blend(uint32_t& pixel, RenderColor color, unsigned coverage) {
+    const unsigned alpha = Div255((color >> 24) * coverage);
+    if (alpha == 0)
+        return;
+    if (alpha == 255) {
+        pixel = color | 0xFF000000u;
+        return;
+    }
+
+    const unsigned inverse = 255 - alpha;
+    const unsigned r = Div255(((color >> 16) & 0xFF) * alpha + ((pixel >> 16) & 0xFF) * inverse);
+    const unsigned g = Div255(((color >> 8) & 0xFF) * alpha + ((pixel >> 8) & 0xFF) * inverse);
+    const unsigned b = Div255((color & 0xFF) * alpha + (pixel & 0xFF) * inverse);
+    const unsigned a = alpha + Div255((pixel >> 24) * inverse);
+    pixel = (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+void SoftwareRenderBackend::FillRect(int x, int y, int w, int h, RenderColor color) {
+    const int left = (std::max)(x, 0), right = (std::min)(x + w, width);
+    const int top = (std::max)(y, 0), bottom = (std::min)(y + h, height);
+
+    for (int row = top; row < bottom; ++row) {
+        uint32_t* line = pixels.data() + static_cast<size_t>(row) * width;
+        for (int col = left; col < right; ++col)
+            Blend(line[col], color, 255);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// FillVerticalGradient: Channels interpolated per row, top to bottom
+//////////////////////////////////////////////////////////////////////
+void SoftwareRenderBackend::FillVerticalGradient(int x, int y, int w, int h,
+    RenderColor top, RenderColor bottom) {
+    if (h <= 0)
+        return;
+
+    const int first = (std::max)(y, 0), last = (std::min)(y + h, height);
+    for (int row = first; row < last; ++row) {
+        const unsigned t = static_cast<unsigned>((row - y) * 255 / (std::max)(1, h - 1));
+        RenderColor color = 0;
+        for (int shift = 0; shift < 32; shift += 8) {
+            const unsigned a = (top >> shift) & 0xFF, b = (bottom >> shift) & 0xFF;
+            color |= RenderColor(Div255(a * (255 - t) + b * t)) << shift;
+        }
+        FillRect(x, row, w, 1, color);
+    }
+}
+
+void SoftwareRenderBackend::FillRoundedRect(int x, int y, int w, int h, int radius, RenderColor color) {
+    RasterizeRoundedRect(x, y, w, h, radius, 0.0f, false, color);
+}
+
+void SoftwareRenderBackend::StrokeRoundedRect(int x, int y, int w, int h, int radius,
+    float penWidth, RenderColor color) {
+    RasterizeRoundedRect(x, y, w, h, radius, penWidth, true, color);
+}
+
+//////////////////////////////////////////////////////////////////////
+// RasterizeRoundedRect: d = signed distance from the pixel center to
+//                       the outline (negative inside). Fill coverage is
+//                       0.5 - d, stroke coverage 0.5 - (|d| - pen / 2),
+//                       both clamped to [0, 1]. Between the corners a
+//                       row's interior is at least r inside (d <= -r),
+//                       so it is filled (or skipped) without distances
+//////////////////////////////////////////////////////////////////////
+void SoftwareRenderBackend::RasterizeRoundedRect(int x, int y, int w, int h, int radius,
+    float penWidth, bool stroke, RenderColor color) {
+    const float halfWidth = w * 0.5f, halfHeight = h * 0.5f;
+    const float r = (std::min)(static_cast<float>(radius), (std::min)(halfWidth, halfHeight));
+    const float centerX = x + halfWidth, centerY = y + halfHeight;
+    const float halfPen = stroke ? penWidth * 0.5f : 0.0f;
+
+    const int grow = static_cast<int>(std::ceil(halfPen)) + 1;
+    const int left = (std::max)(x - grow, 0), right = (std::min)(x + w + grow, width);
+    const int top = (std::max)(y - grow, 0), bottom = (std::min)(y + h + grow, height);
+
+    // Interior coverage is 1 (fill) or 0 (stroke) once r is large enough
+    const bool fastInterior = stroke ? r >= halfPen + 0.5f : r >= 0.5f;
+
+    for (int row = top; row < bottom; ++row) {
+        uint32_t* line = pixels.data() + static_cast<size_t>(row) * width;
+        const float qy = std::fabs(row + 0.5f - centerY) - (halfHeight - r);
+
+        int spanLeft = right, spanRight = right;
+        if (fastInterior && qy <= 0.0f) {
+            spanLeft = (std::max)(left, static_cast<int>(std::ceil(centerX - (halfWidth - r) - 0.5f)));
+            spanRight = (std::max)(spanLeft, (std::min)(right, static_cast<int>(std::floor(centerX + (halfWidth - r) - 0.5f)) + 1));
+        }
+
+        for (int col = left; col < right; ++col) {
+            if (col == spanLeft) {
+                if (!stroke) {
+                    for (; col < spanRight; ++col)
+                        Blend(line[col], color, 255);
+                }
+                col = spanRight;
+                if (col >= right)
+                    break;
+            }
+
+            const float qx = std::fabs(col + 0.5f - centerX) - (halfWidth - r);
+            const float ox = (std::max)(qx, 0.0f), oy = (std::max)(qy, 0.0f);
+            const float d = std::sqrt(ox * ox + oy * oy) + (std::min)((std::max)(qx, qy), 0.0f) - r;
+
+            float coverage = stroke ? 0.5f - (std::fabs(d) - halfPen) : 0.5f - d;
+            if (coverage <= 0.0f)
+                continue;
+            coverage = (std::min)(coverage, 1.0f);
+            Blend(line[col], color, static_cast<unsigned>(coverage * 255.0f + 0.5f));
+        }
+    }
+}
+
+void SoftwareRenderBackend::DrawImage(int x, int y, int w, int h, const RenderImage& image) {
+    if (!image.pixels || image.width <= 0 || image.height <= 0 || w <= 0 || h <= 0)
+        return;
+
+    const int left = (std::max)(x, 0), right = (std::min)(x + w, width);
+    const int top = (std::max)(y, 0), bottom = (std::min)(y + h, height);
+
+    for (int row = top; row < bottom; ++row) {
+        const uint32_t* source = image.pixels + static_cast<size_t>((row - y) * image.height / h) * image.width;
+        uint32_t* line = pixels.data() + static_cast<size_t>(row) * width;
+        for (int col = left; col < right; ++col)
+            Blend(line[col], source[(col - x) * image.width / w], 255);
+    }
+}
+
+int SoftwareRenderBackend::GetLineHeight(RenderFont) {
+    return GlyphAtlas::kLineHeight;
+}
+
+void SoftwareRenderBackend::MeasureText(RenderFont, const wchar_t* text, size_t length, int* extents) {
+    int pen = 0;
+    for (size_t i = 0; i < length; ++i) {
+        pen += GlyphAtlas::Find(text[i]).advance;
+        extents[i] = pen;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// DrawString: Each glyph's 4-bit coverage scales the color's alpha
+//////////////////////////////////////////////////////////////////////
+void SoftwareRenderBackend::DrawString(RenderFont, int x, int y, const wchar_t* text, size_t length,
+    RenderColor color) {
+    int pen = x;
+    for (size_t i = 0; i < length; ++i) {
+        const GlyphAtlas::Glyph& glyph = GlyphAtlas::Find(text[i]);
+        const int rowBytes = (glyph.width + 1) / 2;
+        const int glyphLeft = pen + glyph.left;
+
+        for (int row = 0; row < GlyphAtlas::kLineHeight; ++row) {
+            const int py = y + row;
+            if (py < 0 || py >= height)
+                continue;
+
+            const uint8_t* coverage = GlyphAtlas::kCoverage + glyph.offset + row * rowBytes;
+            uint32_t* line = pixels.data() + static_cast<size_t>(py) * width;
+            for (int col = 0; col < glyph.width; ++col) {
+                const int px = glyphLeft + col;
+                const unsigned level = (col & 1) ? (coverage[col / 2] & 0x0F) : (coverage[col / 2] >> 4);
+                if (level != 0 && px >= 0 && px < width)
+                    Blend(line[px], color, level * 17);
+            }
+        }
+        pen += glyph.advance;
+    }
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "RenderBackend.h"
+#include <vector>              // Pixel buffer
+
+////////////////////////////////////////////////////////////////////////
+// Class: SoftwareRenderBackend
+// Purpose: Portable rasterizer into a 32-bit 0xAARRGGBB buffer (rows
+//          top-down, packed). No platform calls, so it runs headless.
+//          - rounded rectangles: signed distance per pixel, coverage
+//            from the distance (one pixel of anti-aliasing)
+//          - alpha is straight and blended source-over
+//          - images are sampled nearest-neighbour
+//          - text comes from the bundled GlyphAtlas; every RenderFont
+//            uses its one size
+//          Drawing is clipped to the buffer.
+////////////////////////////////////////////////////////////////////////
+class SoftwareRenderBackend : public RenderBackend {
+public:
+    SoftwareRenderBackend(int width, int height);
+
+    void Clear(RenderColor color);
+
+    const uint32_t* GetPixels() const { return pixels.data(); }
+    int GetWidth() const { return width; }
+    int GetHeight() const { return height; }
+
+    void FillRect(int x, int y, int width, int height, RenderColor color) override;
+    void FillVerticalGradient(int x, int y, int width, int height,
+        RenderColor top, RenderColor bottom) override;
+    void FillRoundedRect(int x, int y, int width, int height, int radius, RenderColor color) override;
+    void StrokeRoundedRect(int x, int y, int width, int height, int radius,
+        float penWidth, RenderColor color) override;
+    void DrawImage(int x, int y, int width, int height, const RenderImage& image) override;
+
+    int GetLineHeight(RenderFont font) override;
+    void MeasureText(RenderFont font, const wchar_t* text, size_t length, int* extents) override;
+    void DrawString(RenderFont font, int x, int y, const wchar_t* text, size_t length,
+        RenderColor color) override;
+
+private:
+    int width;
+    int height;
+    std::vector<uint32_t> pixels;
+
+    // Source-over with the color's alpha scaled by coverage (0-255)
+    void Blend(uint32_t& pixel, RenderColor color, unsigned coverage);
+
+    // Rounded rect coverage: filled, or a band of penWidth centered on the outline
+    void RasterizeRoundedRect(int x, int y, int width, int height, int radius,
+        float penWidth, bool stroke, RenderColor color);
+};
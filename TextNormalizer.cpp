@@ -0,0 +1,398 @@
+#include "TextNormalizer.h"
+#include <algorithm>
+#include <cstring>
+#include <cwchar>
+#include <vector>
+
+// The SIMD kernels work on 16-bit lanes, i.e. Windows' UTF-16 wchar_t.
+// TEXTNORMALIZER_SCALAR forces the scalar kernel (for benchmarks).
+#if WCHAR_MAX == 0xFFFF && !defined(TEXTNORMALIZER_SCALAR)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define TEXTNORMALIZER_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TEXTNORMALIZER_SSE2
+#endif
+#endif
+
+namespace {
+    enum : uint8_t {
+        kSpace = 1,
+        kLetter = 2
+    };
+
+    //////////////////////////////////////////////////////////////////////
+    // CaseRange: Uppercase -> lowercase. Stride 1 maps every character of
+    //            [first, last]; stride 2 only those with first's parity
+    //            (the alternating pairs of the Latin/Cyrillic extensions).
+    //////////////////////////////////////////////////////////////////////
+    struct CaseRange {
+        uint16_t first;
+        uint16_t last;
+        int32_t delta;
+        uint8_t stride;
+    };
+
+    const CaseRange kLowerRanges[] = {
+        { 0x0041, 0x005A, 32, 1 },      // Basic Latin
+        { 0x00C0, 0x00D6, 32, 1 },      // Latin-1
+        { 0x00D8, 0x00DE, 32, 1 },
+        { 0x0100, 0x012F, 1, 2 },       // Latin Extended-A
+        { 0x0130, 0x0130, -199, 1 },    // Capital I with dot -> i
+        { 0x0132, 0x0137, 1, 2 },
+        { 0x0139, 0x0148, 1, 2 },
+        { 0x014A, 0x0177, 1, 2 },
+        { 0x0178, 0x0178, -121, 1 },    // Y with diaeresis -> U+00FF
+        { 0x0179, 0x017E, 1, 2 },
+        { 0x01CD, 0x01DC, 1, 2 },       // Latin Extended-B (regular blocks)
+        { 0x01DE, 0x01EF, 1, 2 },
+        { 0x01F8, 0x021F, 1, 2 },
+        { 0x0222, 0x0233, 1, 2 },
+        { 0x0386, 0x0386, 38, 1 },      // Greek
+        { 0x0388, 0x038A, 37, 1 },
+        { 0x038C, 0x038C, 64, 1 },
+        { 0x038E, 0x038F, 63, 1 },
+        { 0x0391, 0x03A1, 32, 1 },
+        { 0x03A3, 0x03AB, 32, 1 },
+        { 0x03D8, 0x03EF, 1, 2 },
+        { 0x0400, 0x040F, 80, 1 },      // Cyrillic
+        { 0x0410, 0x042F, 32, 1 },
+        { 0x0460, 0x0481, 1, 2 },
+        { 0x048A, 0x04BF, 1, 2 },
+        { 0x04C0, 0x04C0, 15, 1 },
+        { 0x04C1, 0x04CE, 1, 2 },
+        { 0x04D0, 0x052F, 1, 2 },
+        { 0x0531, 0x0556, 48, 1 },      // Armenian
+        { 0x10A0, 0x10C5, 7264, 1 },    // Georgian -> Nuskhuri
+        { 0x1E00, 0x1E95, 1, 2 },       // Latin Extended Additional
+        { 0x1EA0, 0x1EFF, 1, 2 },
+        { 0x1F08, 0x1F0F, -8, 1 },      // Greek Extended (plain letters)
+        { 0x1F18, 0x1F1D, -8, 1 },
+        { 0x1F28, 0x1F2F, -8, 1 },
+        { 0x1F38, 0x1F3F, -8, 1 },
+        { 0x1F48, 0x1F4D, -8, 1 },
+        { 0x1F68, 0x1F6F, -8, 1 },
+        { 0x2160, 0x216F, 16, 1 },      // Roman numerals
+        { 0x24B6, 0x24CF, 26, 1 },      // Circled letters
+        { 0x2C00, 0x2C2E, 48, 1 },      // Glagolitic
+        { 0xFF21, 0xFF3A, 32, 1 },      // Fullwidth Latin
+    };
+
+    // Uncased letters still count as letters for title casing
+    const uint16_t kLetterRanges[][2] = {
+        { 0x00AA, 0x00AA }, { 0x00B5, 0x00B5 }, { 0x00BA, 0x00BA },
+        { 0x00C0, 0x00D6 }, { 0x00D8, 0x00F6 }, { 0x00F8, 0x024F },
+        { 0x0370, 0x03FF }, { 0x0400, 0x052F }, { 0x0531, 0x0587 },
+        { 0x05D0, 0x05EA }, { 0x0620, 0x064A }, { 0x0E01, 0x0E30 },
+        { 0x10A0, 0x10FF }, { 0x1E00, 0x1FFF }, { 0x2C00, 0x2C5F },
+        { 0x2D00, 0x2D25 }, { 0x3041, 0x30FF }, { 0x3400, 0x4DBF },
+        { 0x4E00, 0x9FFF }, { 0xAC00, 0xD7A3 }, { 0xFF21, 0xFF3A },
+        { 0xFF41, 0xFF5A },
+    };
+
+    const uint16_t kSpaces[] = {
+        0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x0020, 0x0085, 0x00A0,
+        0x1680, 0x2000, 0x2001, 0x2002, 0x2003, 0x2004, 0x2005, 0x2006,
+        0x2007, 0x2008, 0x2009, 0x200A, 0x2028, 0x2029, 0x202F, 0x205F,
+        0x3000,
+    };
+
+    //////////////////////////////////////////////////////////////////////
+    // FoldTables: 256 pages of 256 code points. Identical pages are
+    //             stored once, so the untouched bulk of the BMP (and every
+    //             all-letter CJK page) shares a single page.
+    //////////////////////////////////////////////////////////////////////
+    struct FoldPage {
+        uint16_t lower[256];
+        uint16_t upper[256];
+        uint8_t flags[256];
+    };
+
+    struct FoldTables {
+        uint8_t pageOf[256];
+        std::vector<FoldPage> pages;
+
+        const FoldPage& Page(wchar_t ch) const { return pages[pageOf[static_cast<uint32_t>(ch) >> 8]]; }
+    };
+
+    FoldTables BuildTables() {
+        std::vector<uint16_t> lower(0x10000), upper(0x10000);
+        std::vector<uint8_t> flags(0x10000, 0);
+        for (uint32_t c = 0; c < 0x10000; ++c)
+            lower[c] = upper[c] = static_cast<uint16_t>(c);
+
+        for (const auto& range : kLowerRanges) {
+            for (uint32_t c = range.first; c <= range.last; c += range.stride)
+                lower[c] = static_cast<uint16_t>(static_cast<int32_t>(c) + range.delta);
+        }
+
+        // Inverse mapping; ascending order lets 'I' claim 'i' before U+0130
+        std::vector<bool> claimed(0x10000, false);
+        for (uint32_t c = 0; c < 0x10000; ++c) {
+            if (lower[c] != c && !claimed[lower[c]]) {
+                upper[lower[c]] = static_cast<uint16_t>(c);
+                claimed[lower[c]] = true;
+            }
+        }
+
+        for (const auto& range : kLetterRanges) {
+            for (uint32_t c = range[0]; c <= range[1]; ++c)
+                flags[c] |= kLetter;
+        }
+        for (uint32_t c = 0; c < 0x10000; ++c) {
+            if (lower[c] != c || upper[c] != c || (c < 0x80 && ((c | 0x20) - 'a') < 26))
+                flags[c] |= kLetter;
+        }
+        for (uint16_t c : kSpaces)
+            flags[c] = kSpace;
+
+        FoldTables tables;
+        tables.pages.reserve(32);
+        for (uint32_t p = 0; p < 256; ++p) {
+            FoldPage page;
+            std::memcpy(page.lower, &lower[p << 8], sizeof(page.lower));
+            std::memcpy(page.upper, &upper[p << 8], sizeof(page.upper));
+            std::memcpy(page.flags, &flags[p << 8], sizeof(page.flags));
+
+            auto same = std::find_if(tables.pages.begin(), tables.pages.end(),
+                [&](const FoldPage& other) { return std::memcmp(&other, &page, sizeof(page)) == 0; });
+
+            tables.pageOf[p] = static_cast<uint8_t>(same - tables.pages.begin());
+            if (same == tables.pages.end())
+                tables.pages.push_back(page);
+        }
+        return tables;
+    }
+
+    // Built on first use; thread-safe static initialization
+    const FoldTables& GetTables() {
+        static const FoldTables tables = BuildTables();
+        return tables;
+    }
+
+    // Always true for 16-bit wchar_t (Windows), where the test would warn
+    inline bool InBmp(wchar_t ch) {
+#if WCHAR_MAX > 0xFFFF
+        return static_cast<uint32_t>(ch) < 0x10000;
+#else
+        (void)ch;
+        return true;
+#endif
+    }
+
+    inline wchar_t LowerScalar(wchar_t ch, const FoldTables& tables) {
+        if (static_cast<uint32_t>(ch) < 0x80)
+            return (ch >= L'A' && ch <= L'Z') ? static_cast<wchar_t>(ch + 32) : ch;
+        if (!InBmp(ch))
+            return ch;
+        return static_cast<wchar_t>(tables.Page(ch).lower[ch & 0xFF]);
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    // LowerAsciiRun: Folds whole blocks for as long as they are pure
+    //                ASCII; returns how many characters were written.
+    //                The block that stopped it goes through the table.
+    //////////////////////////////////////////////////////////////////////
+#if defined(TEXTNORMALIZER_AVX2)
+    const size_t kBlock = 16;
+
+    size_t LowerAsciiRun(const wchar_t* src, size_t length, wchar_t* dst, bool searchKey) {
+        const __m256i highBits = _mm256_set1_epi16(static_cast<short>(0xFF80));
+        const __m256i beforeA = _mm256_set1_epi16(L'A' - 1);
+        const __m256i afterZ = _mm256_set1_epi16(L'Z' + 1);
+        const __m256i caseBit = _mm256_set1_epi16(0x20);
+        const __m256i underscore = _mm256_set1_epi16(L'_');
+        const __m256i toSpace = _mm256_set1_epi16(searchKey ? (L'_' ^ L' ') : 0);
+
+        size_t i = 0;
+        for (; i + kBlock <= length; i += kBlock) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            if (!_mm256_testz_si256(v, highBits))
+                break;
+
+            __m256i isUpper = _mm256_and_si256(_mm256_cmpgt_epi16(v, beforeA), _mm256_cmpgt_epi16(afterZ, v));
+            v = _mm256_or_si256(v, _mm256_and_si256(isUpper, caseBit));
+            v = _mm256_xor_si256(v, _mm256_and_si256(_mm256_cmpeq_epi16(v, underscore), toSpace));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), v);
+        }
+        return i;
+    }
+#elif defined(TEXTNORMALIZER_SSE2)
+    const size_t kBlock = 8;
+
+    size_t LowerAsciiRun(const wchar_t* src, size_t length, wchar_t* dst, bool searchKey) {
+        const __m128i highBits = _mm_set1_epi16(static_cast<short>(0xFF80));
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i beforeA = _mm_set1_epi16(L'A' - 1);
+        const __m128i afterZ = _mm_set1_epi16(L'Z' + 1);
+        const __m128i caseBit = _mm_set1_epi16(0x20);
+        const __m128i underscore = _mm_set1_epi16(L'_');
+        const __m128i toSpace = _mm_set1_epi16(searchKey ? (L'_' ^ L' ') : 0);
+
+        size_t i = 0;
+        for (; i + kBlock <= length; i += kBlock) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, highBits), zero)) != 0xFFFF)
+                break;
+
+            __m128i isUpper = _mm_and_si128(_mm_cmpgt_epi16(v, beforeA), _mm_cmplt_epi16(v, afterZ));
+            v = _mm_or_si128(v, _mm_and_si128(isUpper, caseBit));
+            v = _mm_xor_si128(v, _mm_and_si128(_mm_cmpeq_epi16(v, underscore), toSpace));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+        }
+        return i;
+    }
+#else
+    const size_t kBlock = 8;
+
+    size_t LowerAsciiRun(const wchar_t* src, size_t length, wchar_t* dst, bool searchKey) {
+        const uint32_t toSpace = searchKey ? (L'_' ^ L' ') : 0;
+
+        size_t i = 0;
+        for (; i < length; ++i) {
+            uint32_t ch = static_cast<uint32_t>(src[i]);
+            if (ch >= 0x80)
+                break;
+
+            ch |= static_cast<uint32_t>(ch - L'A' < 26) << 5;
+            ch ^= (ch == L'_') ? toSpace : 0;
+            dst[i] = static_cast<wchar_t>(ch);
+        }
+        return i;
+    }
+#endif
+
+    //////////////////////////////////////////////////////////////////////
+    // Fold: ASCII runs through the kernel, the rest one block at a time
+    //       through the table (loaded only once non-ASCII shows up)
+    //////////////////////////////////////////////////////////////////////
+    void Fold(const wchar_t* src, size_t length, wchar_t* dst, bool searchKey) {
+        size_t i = 0;
+        while (i < length) {
+            i += LowerAsciiRun(src + i, length - i, dst + i, searchKey);
+            if (i == length)
+                break;
+
+            const FoldTables& tables = GetTables();
+            const size_t end = (std::min)(length, i + kBlock);
+            for (; i < end; ++i) {
+                wchar_t ch = src[i];
+                dst[i] = (searchKey && ch == L'_') ? L' ' : LowerScalar(ch, tables);
+            }
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// Single characters
+//////////////////////////////////////////////////////////////////////
+wchar_t TextNormalizer::Lower(wchar_t ch) {
+    if (static_cast<uint32_t>(ch) < 0x80)
+        return (ch >= L'A' && ch <= L'Z') ? static_cast<wchar_t>(ch + 32) : ch;
+    return LowerScalar(ch, GetTables());
+}
+
+wchar_t TextNormalizer::Upper(wchar_t ch) {
+    if (static_cast<uint32_t>(ch) < 0x80)
+        return (ch >= L'a' && ch <= L'z') ? static_cast<wchar_t>(ch - 32) : ch;
+    if (!InBmp(ch))
+        return ch;
+    return static_cast<wchar_t>(GetTables().Page(ch).upper[ch & 0xFF]);
+}
+
+bool TextNormalizer::IsSpace(wchar_t ch) {
+    if (static_cast<uint32_t>(ch) < 0x80)
+        return ch == L' ' || (ch >= L'\t' && ch <= L'\r');
+    return InBmp(ch) && (GetTables().Page(ch).flags[ch & 0xFF] & kSpace) != 0;
+}
+
+bool TextNormalizer::IsLetter(wchar_t ch) {
+    if (static_cast<uint32_t>(ch) < 0x80)
+        return ((static_cast<uint32_t>(ch) | 0x20) - L'a') < 26;
+    return InBmp(ch) && (GetTables().Page(ch).flags[ch & 0xFF] & kLetter) != 0;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Raw kernels
+//////////////////////////////////////////////////////////////////////
+void TextNormalizer::ToLower(const wchar_t* src, size_t length, wchar_t* dst) {
+    Fold(src, length, dst, false);
+}
+
+void TextNormalizer::ToSearchKey(const wchar_t* src, size_t length, wchar_t* dst) {
+    Fold(src, length, dst, true);
+}
+
+//////////////////////////////////////////////////////////////////////
+// MakeKeys: The search key is folded a block at a time and title cased
+//           into the display text while that block is still in cache
+//////////////////////////////////////////////////////////////////////
+void TextNormalizer::MakeKeys(const wchar_t* name, size_t length, wchar_t* searchKey, wchar_t* displayText) {
+    const size_t kChunk = 64;
+    bool capitalize = true;
+
+    for (size_t start = 0; start < length; start += kChunk) {
+        const size_t end = (std::min)(length, start + kChunk);
+        Fold(name + start, end - start, searchKey + start, true);
+
+        for (size_t i = start; i < end; ++i) {
+            wchar_t ch = searchKey[i];
+            const uint32_t code = static_cast<uint32_t>(ch);
+
+            if (code < 0x80) {
+                // Already lowercase: only spaces and a-z matter here
+                if (code == L' ' || code - L'\t' < 5) {
+                    capitalize = true;
+                }
+                else if (capitalize && code - L'a' < 26) {
+                    ch = static_cast<wchar_t>(code - 32);
+                    capitalize = false;
+                }
+            }
+            else if (IsSpace(ch)) {
+                capitalize = true;
+            }
+            else if (capitalize && IsLetter(ch)) {
+                ch = Upper(ch);
+                capitalize = false;
+            }
+            displayText[i] = ch;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// std::wstring wrappers
+//////////////////////////////////////////////////////////////////////
+std::wstring TextNormalizer::ToLower(const std::wstring& text) {
+    std::wstring result(text.size(), L'\0');
+    Fold(text.data(), text.size(), &result[0], false);
+    return result;
+}
+
+std::wstring TextNormalizer::ToUpper(const std::wstring& text) {
+    std::wstring result(text);
+    for (auto& ch : result)
+        ch = Upper(ch);
+    return result;
+}
+
+std::wstring TextNormalizer::ToSearchKey(const std::wstring& text) {
+    std::wstring result(text.size(), L'\0');
+    Fold(text.data(), text.size(), &result[0], true);
+    return result;
+}
+
+std::wstring TextNormalizer::ToDisplayText(const std::wstring& text) {
+    std::wstring searchKey, displayText;
+    MakeKeys(text, searchKey, displayText);
+    return displayText;
+}
+
+void TextNormalizer::MakeKeys(const std::wstring& name, std::wstring& searchKey, std::wstring& displayText) {
+    searchKey.resize(name.size());
+    displayText.resize(name.size());
+    MakeKeys(name.data(), name.size(), &searchKey[0], &displayText[0]);
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>             // size_t
+#include <cstdint>             // Table entries
+#include <string>              // std::wstring wrappers
+
+////////////////////////////////////////////////////////////////////////
+// Class: TextNormalizer
+// Purpose: Locale-independent case folding for tool names. The same
+//          input gives the same output on every machine, whatever the
+//          user's locale (towlower and CharLowerBuffW do not promise that).
+//          - ASCII runs go through an SSE2/AVX2 kernel, 8/16 characters
+//            per step (scalar where neither is available, wchar_t is
+//            32 bits wide or TEXTNORMALIZER_SCALAR is defined)
+//          - everything else in the BMP is a two-level table lookup
+//            (simple one-to-one mappings: Latin, Greek, Cyrillic,
+//            Armenian, Georgian, fullwidth forms...); code points outside
+//            the BMP and surrogates pass through unchanged
+//
+// Keys:
+//   search key    lowercase, '_' as ' '          "My_Tool" -> "my tool"
+//   display text  Title Case, '_' as ' '         "MY_tool" -> "My Tool"
+// A letter is capitalized after whitespace or at the start; other
+// characters ("3d" -> "3D") do not end the wait for the next letter.
+////////////////////////////////////////////////////////////////////////
+class TextNormalizer {
+public:
+    static wchar_t Lower(wchar_t ch);
+    static wchar_t Upper(wchar_t ch);
+    static bool IsSpace(wchar_t ch);
+    static bool IsLetter(wchar_t ch);
+
+    // Raw kernels: dst must hold `length` characters (may equal src)
+    static void ToLower(const wchar_t* src, size_t length, wchar_t* dst);
+    static void ToSearchKey(const wchar_t* src, size_t length, wchar_t* dst);
+
+    // Both keys in one pass over the name
+    static void MakeKeys(const wchar_t* name, size_t length, wchar_t* searchKey, wchar_t* displayText);
+
+    static std::wstring ToLower(const std::wstring& text);
+    static std::wstring ToUpper(const std::wstring& text);
+    static std::wstring ToSearchKey(const std::wstring& text);
+    static std::wstring ToDisplayText(const std::wstring& text);
+    static void MakeKeys(const std::wstring& name, std::wstring& searchKey, std::wstring& displayText);
+};
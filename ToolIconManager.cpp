@@ -1,146 +1,508 @@
-﻿#include "ToolIconManager.h"
-#include <algorithm>
-#include "Main.h"
-
-///////////////////////////////////////////////////////////////////////////
-// Constructor: ToolIconManager
-// Purpose    : Initializes the icon manager (currently no setup needed)
-///////////////////////////////////////////////////////////////////////////
-ToolIconManager::ToolIconManager() {}
-
-///////////////////////////////////////////////////////////////////////////
-// Destructor: ~ToolIconManager
-// Purpose    : Cleans up icon resources (done in ToolInfo, so nothing here)
-///////////////////////////////////////////////////////////////////////////
-ToolIconManager::~ToolIconManager() {}
-
-///////////////////////////////////////////////////////////////////////////
-// Function   : CreateToolIcon
-// Purpose    : Creates a 64x64 custom icon bitmap for the tool based on its
-//              file extension or name.
-// Returns    : HBITMAP handle to the created icon image.
-///////////////////////////////////////////////////////////////////////////
-HBITMAP ToolIconManager::CreateToolIcon(const std::wstring& extension, const std::wstring& toolName) {
-    // Get screen device context (DC) for bitmap compatibility
-    HDC hdc = GetDC(NULL);
-
-    // Create a memory device context (offscreen drawing)
-    HDC memDC = CreateCompatibleDC(hdc);
-
-    // Create a 64x64 bitmap compatible with screen DC
-    HBITMAP hBitmap = CreateCompatibleBitmap(hdc, 64, 64);
-
-    // Select the bitmap into the memory DC
-    HBITMAP oldBitmap = (HBITMAP)SelectObject(memDC, hBitmap);
-
-    //-----------------------------------------------
-    // Step 1: Fill icon background
-    //-----------------------------------------------
-    HBRUSH brush = CreateSolidBrush(win11_background);   // Create background brush (Win11 theme color)
-    HBRUSH oldBrush = (HBRUSH)SelectObject(memDC, brush);
-    PatBlt(memDC, 0, 0, 64, 64, PATCOPY);                // Fill the whole 64x64 area
-    SelectObject(memDC, oldBrush);                       // Restore previous brush
-    DeleteObject(brush);                                 // Clean up brush
-
-    //-----------------------------------------------
-    // Step 2: Draw emoji/symbol text on icon
-    //-----------------------------------------------
-    DrawIconText(memDC, extension);
-
-    //-----------------------------------------------
-    // Step 3: Final cleanup and return
-    //-----------------------------------------------
-    SelectObject(memDC, oldBitmap);                      // Restore previous bitmap
-    DeleteDC(memDC);                                     // Free memory DC
-    ReleaseDC(NULL, hdc);                                // Release screen DC
-
-    return hBitmap;                                      // Return the created icon bitmap
-}
-
-///////////////////////////////////////////////////////////////////////////
-// Function   : GetIconBrush
-// Purpose    : Returns a solid color brush based on the file extension.
-//              Used for category-based background coloring.
-///////////////////////////////////////////////////////////////////////////
-HBRUSH ToolIconManager::GetIconBrush(const std::wstring& extension) {
-    if (extension == L".py") {
-        return CreateSolidBrush(RGB(52, 144, 220));    // Python = blue
-    }
-    else if (extension == L".bat") {
-        return CreateSolidBrush(RGB(72, 72, 72));      // BAT = gray
-    }
-    else if (extension == L".exe") {
-        return CreateSolidBrush(RGB(0, 120, 215));     // EXE = blue
-    }
-    else if (extension == L".ps1") {
-        return CreateSolidBrush(RGB(1, 36, 86));       // PowerShell = dark blue
-    }
-    else {
-        return CreateSolidBrush(RGB(96, 94, 92));      // Default = neutral gray
-    }
-}
-
-///////////////////////////////////////////////////////////////////////////
-// Function   : DrawIconText
-// Purpose    : Draws a symbol or emoji on the icon using "Segoe UI Emoji" font
-//              centered in the 64x64 space.
-///////////////////////////////////////////////////////////////////////////
-void ToolIconManager::DrawIconText(HDC memDC, const std::wstring& extension) {
-    SetBkMode(memDC, TRANSPARENT);                     // No background behind text
-    SetTextColor(memDC, RGB(0, 153, 51));              // Green color text
-
-    // Create emoji-capable font (Segoe UI Emoji)
-    HFONT iconFont = CreateFont(
-        44, 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
-        DEFAULT_CHARSET, OUT_TT_PRECIS, CLIP_DEFAULT_PRECIS,
-        CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_DONTCARE,
-        L"Segoe UI Emoji"
-    );
-
-    // Select the emoji font
-    HFONT oldFont = (HFONT)SelectObject(memDC, iconFont);
-
-    // Get the character to draw (emoji or extension)
-    std::wstring displayText = GetIconSymbol(extension);
-
-    // Center the emoji in the 64x64 bitmap
-    RECT textRect = { 0, 12, 64, 52 };
-    DrawText(memDC, displayText.c_str(), -1, &textRect,
-        DT_CENTER | DT_VCENTER | DT_SINGLELINE);
-
-    // Clean up font
-    SelectObject(memDC, oldFont);
-    DeleteObject(iconFont);
-}
-
-///////////////////////////////////////////////////////////////////////////
-// Function   : IsEmojiSymbol
-// Purpose    : Returns true if the given text is a known emoji symbol.
-// Note       : Only checks known ones used in this project.
-///////////////////////////////////////////////////////////////////////////
-bool ToolIconManager::IsEmojiSymbol(const std::wstring& text) {
-    return (text == L"👽" || text == L"⚡");
-}
-
-///////////////////////////////////////////////////////////////////////////
-// Function   : GetIconSymbol
-// Purpose    : Returns an emoji or fallback text to be used for a tool icon.
-//              Uses emojis for known extensions, or shows text for others.
-///////////////////////////////////////////////////////////////////////////
-std::wstring ToolIconManager::GetIconSymbol(const std::wstring& extension) {
-    if (extension == L".py") {
-        return L"👽";       // Python = alien emoji
-    }
-    else if (extension == L".bat") {
-        return L"⚡";       // BAT = lightning bolt emoji
-    }
-    else {
-        // For other extensions, show uppercase text like "TXT" or "DLL"
-        if (extension.length() > 1 && extension[0] == L'.') {
-            std::wstring result = extension.substr(1); // Remove the dot
-            std::transform(result.begin(), result.end(), result.begin(), ::towupper);
-            return result;
-        }
-        return extension;
-    }
-}
+﻿#include "ToolIconManager.h"
+#include <algorithm>
+#include "Main.h"
+#include "PeIconReader.h"
+#include "TextNormalizer.h"
+
+///////////////////////////////////////////////////////////////////////////
+// Constructor: ToolIconManager
+// Purpose    : Nothing to set up: the atlas and font come with the first icon
+///////////////////////////////////////////////////////////////////////////
+ToolIconManager::ToolIconManager() {}
+
+///////////////////////////////////////////////////////////////////////////
+// Destructor: ~ToolIconManager
+// Purpose    : Stops the icon thread, then frees the atlas and the icon
+//              font (tools only hold slots)
+///////////////////////////////////////////////////////////////////////////
+ToolIconManager::~ToolIconManager() {
+    Stop();
+    if (atlas)
+        DeleteObject(atlas);
+    if (iconFont)
+        DeleteObject(iconFont);
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : AcquireIcon
+// Purpose    : Finds or reserves the atlas cell for the file's icon.
+//              Called from walker threads too, so it only decodes and
+//              books the cell; GetIcon draws it on the UI thread.
+///////////////////////////////////////////////////////////////////////////
+IconSlot ToolIconManager::AcquireIcon(const std::wstring& extension, const std::wstring& path) {
+    // Decoded before taking the lock: it reads the file
+    DecodedIcon image;
+    if (extension == L".exe" && LoadFileIcon(path, image))
+        return AcquireImage(GetIconSymbol(extension), std::move(image.pixels));
+
+    return AcquireSymbolIcon(extension);
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : AcquireSymbolIcon
+// Purpose    : The file type's symbol; what an executable shows until
+//              the icon thread has decoded its own icon.
+///////////////////////////////////////////////////////////////////////////
+IconSlot ToolIconManager::AcquireSymbolIcon(const std::wstring& extension) {
+    std::wstring symbol = GetIconSymbol(extension);
+
+    std::lock_guard<std::mutex> guard(lock);
+    return FindOrAddCell(symbol, symbol, std::vector<uint32_t>());
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : AcquireImage
+// Purpose    : Executables' icons stop SYMBOL_CELLS short of a full atlas,
+//              so the symbols always find a cell; past that an executable
+//              shows its symbol like before it had an icon of its own.
+///////////////////////////////////////////////////////////////////////////
+IconSlot ToolIconManager::AcquireImage(std::wstring symbol, std::vector<uint32_t>&& pixels) {
+    std::wstring key = MakeImageKey(pixels);
+
+    std::lock_guard<std::mutex> guard(lock);
+    auto found = slots.find(key);
+    if (found != slots.end()) {
+        ++cells[found->second - 1].references;
+        return found->second;
+    }
+    if (imageCells < MAX_IMAGE_ICONS) {
+        IconSlot slot = FindOrAddCell(std::move(key), symbol, std::move(pixels));
+        if (slot) {
+            cells[slot - 1].image = true;
+            ++imageCells;
+            return slot;
+        }
+    }
+
+    return FindOrAddCell(symbol, symbol, std::vector<uint32_t>());
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : Start
+// Purpose    : Runs WorkLoop on the icon thread until Stop.
+///////////////////////////////////////////////////////////////////////////
+void ToolIconManager::Start(ReadyCallback callback) {
+    Stop();
+
+    onReady = std::move(callback);
+    running = true;
+    worker = std::thread(&ToolIconManager::WorkLoop, this);
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : Stop
+// Purpose    : Joins the icon thread (after the file it is reading) and
+//              drops the queue and the icons nobody took.
+///////////////////////////////////////////////////////////////////////////
+void ToolIconManager::Stop() {
+    {
+        std::lock_guard<std::mutex> guard(queueLock);
+        running = false;
+    }
+
+    queueWake.notify_all();
+
+    if (worker.joinable())
+        worker.join();
+
+    std::vector<FileIcon> dropped;
+    {
+        std::lock_guard<std::mutex> guard(queueLock);
+        queuedPaths.clear();
+        dropped.swap(decoded);
+    }
+    for (const FileIcon& icon : dropped)
+        ReleaseIcon(icon.slot);
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : RequestFileIcon
+// Purpose    : Only executables carry an icon worth reading.
+///////////////////////////////////////////////////////////////////////////
+bool ToolIconManager::RequestFileIcon(const std::wstring& extension, const std::wstring& path) {
+    if (extension != L".exe")
+        return false;
+
+    {
+        std::lock_guard<std::mutex> guard(queueLock);
+        if (!running)
+            return false;
+        queuedPaths.push_back(path);
+    }
+
+    queueWake.notify_one();
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : TakeFileIcons
+// Purpose    : Hands the decoded icons to the UI thread; `icons` comes
+//              back empty so its capacity is reused.
+///////////////////////////////////////////////////////////////////////////
+bool ToolIconManager::TakeFileIcons(std::vector<FileIcon>& icons) {
+    icons.clear();
+
+    std::lock_guard<std::mutex> guard(queueLock);
+    icons.swap(decoded);
+    return !icons.empty();
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : WorkLoop
+// Purpose    : One executable at a time, oldest request first. The
+//              callback only fires when the results were empty: one
+//              message is enough for whatever piles up before it is read.
+///////////////////////////////////////////////////////////////////////////
+void ToolIconManager::WorkLoop() {
+    const std::wstring symbol = GetIconSymbol(L".exe");
+
+    for (;;) {
+        std::wstring path;
+        {
+            std::unique_lock<std::mutex> guard(queueLock);
+            queueWake.wait(guard, [this] { return !running || !queuedPaths.empty(); });
+            if (!running)
+                return;
+            path = std::move(queuedPaths.front());
+            queuedPaths.pop_front();
+        }
+
+        // No usable icon in the file: the symbol, like AcquireIcon
+        FileIcon icon;
+        DecodedIcon image;
+        if (LoadFileIcon(path, image))
+            icon.slot = AcquireImage(symbol, std::move(image.pixels));
+        else
+            icon.slot = AcquireSymbolIcon(L".exe");
+        icon.path = std::move(path);
+
+        bool stopped, notify = false;
+        {
+            std::lock_guard<std::mutex> guard(queueLock);
+            stopped = !running;
+            if (!stopped) {
+                notify = decoded.empty();
+                decoded.push_back(std::move(icon));
+            }
+        }
+
+        if (stopped) {
+            ReleaseIcon(icon.slot);
+            return;
+        }
+        if (notify && onReady)
+            onReady();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : FindOrAddCell
+// Purpose    : One more reference to the key's cell, or a new cell from
+//              the free list / the end of the atlas. Caller holds `lock`.
+///////////////////////////////////////////////////////////////////////////
+IconSlot ToolIconManager::FindOrAddCell(std::wstring key, std::wstring symbol, std::vector<uint32_t>&& pixels) {
+    auto found = slots.find(key);
+    if (found != slots.end()) {
+        ++cells[found->second - 1].references;
+        return found->second;
+    }
+
+    IconSlot slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    }
+    else if (cells.size() < MAX_ICONS) {
+        cells.emplace_back();
+        slot = static_cast<IconSlot>(cells.size());
+    }
+    else {
+        return 0;   // Drawn as the "no icon" placeholder
+    }
+
+    Cell& cell = cells[slot - 1];
+    cell.key = key;
+    cell.symbol = std::move(symbol);
+    cell.pixels = std::move(pixels);
+    cell.references = 1;
+    cell.image = false;
+    cell.drawn = false;
+    slots.emplace(std::move(key), slot);
+    return slot;
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : ReleaseIcon
+// Purpose    : The last reference frees the cell for another symbol
+///////////////////////////////////////////////////////////////////////////
+void ToolIconManager::ReleaseIcon(IconSlot slot) {
+    if (slot == 0)
+        return;
+
+    std::lock_guard<std::mutex> guard(lock);
+    Cell& cell = cells[slot - 1];
+    if (cell.references == 0 || --cell.references > 0)
+        return;
+
+    slots.erase(cell.key);
+    cell.key.clear();
+    cell.symbol.clear();
+    std::vector<uint32_t>().swap(cell.pixels);
+    if (cell.image)
+        --imageCells;
+    cell.image = false;
+    cell.drawn = false;
+    freeSlots.push_back(slot);
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : GetIcon
+// Purpose    : Cell position of a slot in the atlas, drawing the icon if
+//              this is the first time it is shown.
+///////////////////////////////////////////////////////////////////////////
+bool ToolIconManager::GetIcon(IconSlot slot, HBITMAP& bitmap, int& x, int& y) {
+    if (slot == 0)
+        return false;
+
+    std::lock_guard<std::mutex> guard(lock);
+    Cell& cell = cells[slot - 1];
+    if (cell.references == 0)
+        return false;
+
+    const int index = slot - 1;
+    x = (index % ATLAS_COLUMNS) * ICON_SIZE;
+    y = (index / ATLAS_COLUMNS) * ICON_SIZE;
+
+    if (!cell.drawn) {
+        ScopedTimer timer(ProfileZone::IconLoad);
+        if (!GrowAtlas(index / ATLAS_COLUMNS + 1))
+            return false;
+
+        HDC screen = GetDC(NULL);
+        HDC memDC = CreateCompatibleDC(screen);
+        HBITMAP oldBitmap = (HBITMAP)SelectObject(memDC, atlas);
+        DrawIcon(memDC, x, y, cell);
+        SelectObject(memDC, oldBitmap);
+        DeleteDC(memDC);
+        ReleaseDC(NULL, screen);
+        cell.drawn = true;
+        std::vector<uint32_t>().swap(cell.pixels);   // The atlas holds it now
+    }
+
+    bitmap = atlas;
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : GrowAtlas
+// Purpose    : Doubles the atlas height until `rows` rows fit; cells
+//              already drawn are copied into the new bitmap.
+///////////////////////////////////////////////////////////////////////////
+bool ToolIconManager::GrowAtlas(int rows) {
+    if (atlas && rows <= atlasRows)
+        return true;
+
+    int newRows = (std::max)(atlasRows, 1);
+    while (newRows < rows)
+        newRows *= 2;
+
+    HDC screen = GetDC(NULL);
+    HBITMAP newAtlas = CreateCompatibleBitmap(screen, ATLAS_COLUMNS * ICON_SIZE, newRows * ICON_SIZE);
+    if (newAtlas && atlas) {
+        HDC source = CreateCompatibleDC(screen);
+        HDC target = CreateCompatibleDC(screen);
+        HBITMAP oldSource = (HBITMAP)SelectObject(source, atlas);
+        HBITMAP oldTarget = (HBITMAP)SelectObject(target, newAtlas);
+        BitBlt(target, 0, 0, ATLAS_COLUMNS * ICON_SIZE, atlasRows * ICON_SIZE, source, 0, 0, SRCCOPY);
+        SelectObject(source, oldSource);
+        SelectObject(target, oldTarget);
+        DeleteDC(source);
+        DeleteDC(target);
+    }
+    ReleaseDC(NULL, screen);
+
+    if (!newAtlas)
+        return false;
+
+    if (atlas)
+        DeleteObject(atlas);
+    atlas = newAtlas;
+    atlasRows = newRows;
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : DrawIcon
+// Purpose    : Draws one 64x64 icon at (x, y) of the atlas.
+///////////////////////////////////////////////////////////////////////////
+void ToolIconManager::DrawIcon(HDC memDC, int x, int y, const Cell& cell) {
+    //-----------------------------------------------
+    // Step 1: Fill icon background
+    //-----------------------------------------------
+    HBRUSH brush = CreateSolidBrush(win11_background);   // Create background brush (Win11 theme color)
+    HBRUSH oldBrush = (HBRUSH)SelectObject(memDC, brush);
+    PatBlt(memDC, x, y, ICON_SIZE, ICON_SIZE, PATCOPY);  // Fill the whole 64x64 cell
+    SelectObject(memDC, oldBrush);                       // Restore previous brush
+    DeleteObject(brush);                                 // Clean up brush
+
+    //-----------------------------------------------
+    // Step 2: Blend the decoded icon over the background
+    //         (pixels are premultiplied), or draw the symbol
+    //-----------------------------------------------
+    if (cell.pixels.empty()) {
+        DrawIconText(memDC, { x, y + 12, x + ICON_SIZE, y + 52 }, cell.symbol);
+        return;
+    }
+
+    const uint32_t backR = GetRValue(win11_background);
+    const uint32_t backG = GetGValue(win11_background);
+    const uint32_t backB = GetBValue(win11_background);
+
+    std::vector<uint32_t> blended(cell.pixels.size());
+    for (size_t i = 0; i < blended.size(); ++i) {
+        const uint32_t pixel = cell.pixels[i];
+        const uint32_t inverse = 255 - (pixel >> 24);
+        const uint32_t r = ((pixel >> 16) & 0xFF) + (backR * inverse + 127) / 255;
+        const uint32_t g = ((pixel >> 8) & 0xFF) + (backG * inverse + 127) / 255;
+        const uint32_t b = (pixel & 0xFF) + (backB * inverse + 127) / 255;
+        blended[i] = ((std::min)(r, 255u) << 16) | ((std::min)(g, 255u) << 8) | (std::min)(b, 255u);
+    }
+
+    BITMAPINFO info = {};
+    info.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    info.bmiHeader.biWidth = ICON_SIZE;
+    info.bmiHeader.biHeight = -ICON_SIZE;              // Top-down, like the decoder's rows
+    info.bmiHeader.biPlanes = 1;
+    info.bmiHeader.biBitCount = 32;
+    info.bmiHeader.biCompression = BI_RGB;
+    SetDIBitsToDevice(memDC, x, y, ICON_SIZE, ICON_SIZE, 0, 0, 0, ICON_SIZE,
+        blended.data(), &info, DIB_RGB_COLORS);
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : LoadFileIcon
+// Purpose    : Picks the image closest to ICON_SIZE and fits it to a cell.
+//              Small icons are centered rather than blown up.
+///////////////////////////////////////////////////////////////////////////
+bool ToolIconManager::LoadFileIcon(const std::wstring& path, DecodedIcon& icon) {
+    ScopedTimer timer(ProfileZone::IconLoad);
+
+    DecodedIcon image;
+    if (!PeIconReader::Load(path, ICON_SIZE, image))
+        return false;
+
+    if (image.width > ICON_SIZE || image.height > ICON_SIZE) {
+        IconImageDecoder::Resize(image, ICON_SIZE, ICON_SIZE, icon);
+        return true;
+    }
+
+    icon.width = icon.height = ICON_SIZE;
+    icon.pixels.assign(ICON_SIZE * ICON_SIZE, 0);
+    const int left = (ICON_SIZE - image.width) / 2;
+    const int top = (ICON_SIZE - image.height) / 2;
+    for (int row = 0; row < image.height; ++row) {
+        std::copy_n(image.pixels.begin() + static_cast<size_t>(row) * image.width, image.width,
+            icon.pixels.begin() + static_cast<size_t>(top + row) * ICON_SIZE + left);
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : MakeImageKey
+// Purpose    : FNV-1a hash of the pixels, so executables sharing an icon
+//              share a cell. Starts with a control character no symbol has.
+///////////////////////////////////////////////////////////////////////////
+std::wstring ToolIconManager::MakeImageKey(const std::vector<uint32_t>& pixels) {
+    uint64_t hash = 14695981039346656037ull;
+    for (uint32_t pixel : pixels) {
+        hash ^= pixel;
+        hash *= 1099511628211ull;
+    }
+
+    wchar_t key[24];
+    swprintf(key, 24, L"\x1%016llx", static_cast<unsigned long long>(hash));
+    return key;
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : GetIconBrush
+// Purpose    : Returns a solid color brush based on the file extension.
+//              Used for category-based background coloring.
+///////////////////////////////////////////////////////////////////////////
+HBRUSH ToolIconManager::GetIconBrush(const std::wstring& extension) {
+    if (extension == L".py") {
+        return CreateSolidBrush(RGB(52, 144, 220));    // Python = blue
+    }
+    else if (extension == L".bat") {
+        return CreateSolidBrush(RGB(72, 72, 72));      // BAT = gray
+    }
+    else if (extension == L".exe") {
+        return CreateSolidBrush(RGB(0, 120, 215));     // EXE = blue
+    }
+    else if (extension == L".ps1") {
+        return CreateSolidBrush(RGB(1, 36, 86));       // PowerShell = dark blue
+    }
+    else {
+        return CreateSolidBrush(RGB(96, 94, 92));      // Default = neutral gray
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : DrawIconText
+// Purpose    : Draws a symbol or emoji on the icon using "Segoe UI Emoji" font
+//              centered in the 64x64 space.
+///////////////////////////////////////////////////////////////////////////
+void ToolIconManager::DrawIconText(HDC memDC, RECT textRect, const std::wstring& symbol) {
+    SetBkMode(memDC, TRANSPARENT);                     // No background behind text
+    SetTextColor(memDC, RGB(0, 153, 51));              // Green color text
+
+    // Emoji-capable font (Segoe UI Emoji), created once for every icon
+    if (!iconFont) {
+        iconFont = CreateFont(
+            44, 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
+            DEFAULT_CHARSET, OUT_TT_PRECIS, CLIP_DEFAULT_PRECIS,
+            CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_DONTCARE,
+            L"Segoe UI Emoji"
+        );
+    }
+
+    // Select the emoji font
+    HFONT oldFont = (HFONT)SelectObject(memDC, iconFont);
+
+    // Center the emoji in the icon's cell
+    DrawText(memDC, symbol.c_str(), -1, &textRect,
+        DT_CENTER | DT_VCENTER | DT_SINGLELINE);
+
+    // Restore the previous font (ours is kept)
+    SelectObject(memDC, oldFont);
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : IsEmojiSymbol
+// Purpose    : Returns true if the given text is a known emoji symbol.
+// Note       : Only checks known ones used in this project.
+///////////////////////////////////////////////////////////////////////////
+bool ToolIconManager::IsEmojiSymbol(const std::wstring& text) {
+    return (text == L"👽" || text == L"⚡");
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Function   : GetIconSymbol
+// Purpose    : Returns an emoji or fallback text to be used for a tool icon.
+//              Uses emojis for known extensions, or shows text for others.
+///////////////////////////////////////////////////////////////////////////
+std::wstring ToolIconManager::GetIconSymbol(const std::wstring& extension) {
+    if (extension == L".py") {
+        return L"👽";       // Python = alien emoji
+    }
+    else if (extension == L".bat") {
+        return L"⚡";       // BAT = lightning bolt emoji
+    }
+    else {
+        // For other extensions, show uppercase text like "TXT" or "DLL"
+        if (extension.length() > 1 && extension[0] == L'.') {
+            return TextNormalizer::ToUpper(extension.substr(1)); // Remove the dot
+        }
+        return extension;
+    }
+}
@@ -1,56 +1,187 @@
-﻿#pragma once
-
-#include <windows.h>     // Windows API for GDI drawing
-#include <string>        // For using std::wstring (Unicode text)
-
-//------------------------------------------------------------------------------
-// Class: ToolIconManager
-// Purpose: Responsible for generating simple bitmap icons dynamically
-//          based on file extensions (.exe, .bat, etc.)
-//------------------------------------------------------------------------------
-class ToolIconManager {
-public:
-    // Constructor - sets up any default configurations (if needed)
-    ToolIconManager();
-
-    // Destructor - currently nothing to clean, but safe practice
-    ~ToolIconManager();
-
-    //-------------------------------------------------------------------------
-    // Function: CreateToolIcon
-    // Purpose : Creates a small bitmap icon with background color + text/symbol
-    // Params  : extension - file type (e.g., ".exe")
-    //           toolName - name of the tool (used for emoji fallback logic)
-    // Returns : HBITMAP - handle to icon bitmap for display
-    //-------------------------------------------------------------------------
-    HBITMAP CreateToolIcon(const std::wstring& extension, const std::wstring& toolName);
-
-private:
-    //-------------------------------------------------------------------------
-    // Function: GetIconBrush
-    // Purpose : Returns a colored brush based on file extension
-    //           Used to paint the icon background
-    //-------------------------------------------------------------------------
-    HBRUSH GetIconBrush(const std::wstring& extension);
-
-    //-------------------------------------------------------------------------
-    // Function: DrawIconText
-    // Purpose : Renders text (like "BAT", "PY", emoji) on the icon bitmap
-    // Params  : memDC - memory DC where text is drawn
-    //           extension - extension that determines what to write
-    //-------------------------------------------------------------------------
-    void DrawIconText(HDC memDC, const std::wstring& extension);
-
-    //-------------------------------------------------------------------------
-    // Function: IsEmojiSymbol
-    // Purpose : Checks if the given text is an emoji (optional use)
-    //-------------------------------------------------------------------------
-    bool IsEmojiSymbol(const std::wstring& text);
-
-    //-------------------------------------------------------------------------
-    // Function: GetIconSymbol
-    // Purpose : Returns text or emoji to be shown inside the icon
-    //           For example: "⚙" for .exe, "🐍" for .py
-    //-------------------------------------------------------------------------
-    std::wstring GetIconSymbol(const std::wstring& extension);
-};
+﻿#pragma once
+
+#include <windows.h>     // Windows API for GDI drawing
+#include <condition_variable> // Wakes the icon thread
+#include <cstdint>       // IconSlot
+#include <deque>         // Executables waiting for their icon
+#include <functional>    // Ready callback
+#include "IconImageDecoder.h" // DecodedIcon
+#include <mutex>         // Slots are acquired on walker threads
+#include <string>        // For using std::wstring (Unicode text)
+#include <thread>        // Icon thread
+#include <unordered_map> // Symbol -> slot
+#include <vector>        // Atlas cells
+
+// A shared icon in ToolIconManager's atlas (0 = none)
+using IconSlot = uint16_t;
+
+//------------------------------------------------------------------------------
+// Struct: FileIcon
+// Purpose: An executable's icon, decoded on the icon thread (its symbol if
+//          the file has no usable one). The slot holds one reference for
+//          whoever takes it
+//------------------------------------------------------------------------------
+struct FileIcon {
+    std::wstring path;
+    IconSlot slot = 0;
+};
+
+//------------------------------------------------------------------------------
+// Class: ToolIconManager
+// Purpose: Responsible for generating simple bitmap icons dynamically
+//          based on file extensions (.exe, .bat, etc.)
+//          Executables show their own icon (read by PeIconReader) and fall
+//          back to the symbol when they have none.
+//          An icon only depends on its symbol (GetIconSymbol) or its
+//          pixels, so every distinct icon is drawn once into one shared
+//          atlas bitmap and reference-counted: tools hold an IconSlot, not
+//          a bitmap, and GDI handles stay at one bitmap and one font.
+//          The UI thread never reads files: it shows the symbol and queues
+//          executables for the icon thread (RequestFileIcon).
+//------------------------------------------------------------------------------
+class ToolIconManager {
+public:
+    static constexpr int ICON_SIZE = 64;
+
+    // Called on the icon thread - marshal to the UI thread yourself
+    using ReadyCallback = std::function<void()>;
+
+    // Constructor - the atlas is created with the first icon drawn
+    ToolIconManager();
+
+    // Destructor - stops the icon thread, frees the atlas and the icon font
+    ~ToolIconManager();
+
+    // Starts the icon thread; `callback` runs when TakeFileIcons has news
+    void Start(ReadyCallback callback);
+
+    // Stops the icon thread; no callback runs after this returns
+    void Stop();
+
+    //-------------------------------------------------------------------------
+    // Function: AcquireIcon
+    // Purpose : Shared icon for a file; one ReleaseIcon per call.
+    //           Executables are decoded here, so this is for worker
+    //           threads (the UI thread uses RequestFileIcon); no drawing
+    //           happens here
+    // Params  : extension - file type (e.g., ".exe")
+    //           path - the file, for the icon embedded in an executable
+    // Returns : IconSlot of the icon. Once the executables' own icons
+    //           have taken their share of the atlas, new ones get their
+    //           symbol instead (0 only if even that cannot fit)
+    //-------------------------------------------------------------------------
+    IconSlot AcquireIcon(const std::wstring& extension, const std::wstring& path);
+
+    // Symbol icon of a file type, without touching the file. UI thread safe
+    IconSlot AcquireSymbolIcon(const std::wstring& extension);
+
+    //-------------------------------------------------------------------------
+    // Function: RequestFileIcon
+    // Purpose : Queues an executable for the icon thread; its icon comes
+    //           back through TakeFileIcons, in request order
+    // Returns : false if the file type has no icon of its own (nothing queued)
+    //-------------------------------------------------------------------------
+    bool RequestFileIcon(const std::wstring& extension, const std::wstring& path);
+
+    // Moves the decoded icons out (swapping buffers with `icons`)
+    bool TakeFileIcons(std::vector<FileIcon>& icons);
+
+    // Drops one reference; the cell is reused once nothing refers to it
+    void ReleaseIcon(IconSlot slot);
+
+    //-------------------------------------------------------------------------
+    // Function: GetIcon
+    // Purpose : Where to blit an icon from: the atlas bitmap (not selected
+    //           into any DC) and the cell's top-left corner. Draws the
+    //           icon on first use. UI thread only
+    //-------------------------------------------------------------------------
+    bool GetIcon(IconSlot slot, HBITMAP& atlas, int& x, int& y);
+
+private:
+    static constexpr int ATLAS_COLUMNS = 8;
+    static constexpr size_t MAX_ICONS = 256;          // Distinct icons (32 rows of cells)
+    static constexpr size_t SYMBOL_CELLS = 16;        // Never taken by executables' icons
+    static constexpr size_t MAX_IMAGE_ICONS = MAX_ICONS - SYMBOL_CELLS;
+
+    struct Cell {
+        std::wstring key;                             // Symbol, or a hash of the pixels
+        std::wstring symbol;
+        std::vector<uint32_t> pixels;                 // Decoded icon until drawn (empty = symbol)
+        uint32_t references = 0;
+        bool image = false;                           // Holds an executable's own icon
+        bool drawn = false;
+    };
+
+    std::mutex lock;                                  // Guards everything below
+    std::unordered_map<std::wstring, IconSlot> slots; // Key -> slot
+    std::vector<Cell> cells;                          // Cell of slot s is cells[s - 1]
+    std::vector<IconSlot> freeSlots;
+    size_t imageCells = 0;                            // Cells with image == true
+    HBITMAP atlas = nullptr;
+    int atlasRows = 0;
+    HFONT iconFont = nullptr;
+
+    // Icon thread: executables in, decoded icons out
+    std::mutex queueLock;                             // Guards the queue and results
+    std::condition_variable queueWake;
+    std::deque<std::wstring> queuedPaths;
+    std::vector<FileIcon> decoded;
+    bool running = false;
+    ReadyCallback onReady;
+    std::thread worker;
+
+    // Decodes queued executables until Stop
+    void WorkLoop();
+
+    // Shares or books the cell of decoded pixels; the symbol's cell once
+    // the executables' share of the atlas is used up
+    IconSlot AcquireImage(std::wstring symbol, std::vector<uint32_t>&& pixels);
+
+    // Shares the cell of `key`, or books a free one; 0 if none is left
+    IconSlot FindOrAddCell(std::wstring key, std::wstring symbol, std::vector<uint32_t>&& pixels);
+
+    // Makes room for `rows` rows of cells, keeping the drawn ones
+    bool GrowAtlas(int rows);
+
+    // Renders one icon into its cell
+    void DrawIcon(HDC memDC, int x, int y, const Cell& cell);
+
+    //-------------------------------------------------------------------------
+    // Function: LoadFileIcon
+    // Purpose : An executable's icon as ICON_SIZE x ICON_SIZE pixels:
+    //           larger images are scaled down, smaller ones centered
+    //-------------------------------------------------------------------------
+    static bool LoadFileIcon(const std::wstring& path, DecodedIcon& icon);
+
+    // Atlas key of decoded pixels (never a valid symbol)
+    static std::wstring MakeImageKey(const std::vector<uint32_t>& pixels);
+
+    //-------------------------------------------------------------------------
+    // Function: GetIconBrush
+    // Purpose : Returns a colored brush based on file extension
+    //           Used to paint the icon background
+    //-------------------------------------------------------------------------
+    HBRUSH GetIconBrush(const std::wstring& extension);
+
+    //-------------------------------------------------------------------------
+    // Function: DrawIconText
+    // Purpose : Renders text (like "BAT", "PY", emoji) on the icon bitmap
+    // Params  : memDC - memory DC where text is drawn
+    //           textRect - the icon's text box within memDC
+    //           symbol - what to write (see GetIconSymbol)
+    //-------------------------------------------------------------------------
+    void DrawIconText(HDC memDC, RECT textRect, const std::wstring& symbol);
+
+    //-------------------------------------------------------------------------
+    // Function: IsEmojiSymbol
+    // Purpose : Checks if the given text is an emoji (optional use)
+    //-------------------------------------------------------------------------
+    bool IsEmojiSymbol(const std::wstring& text);
+
+    //-------------------------------------------------------------------------
+    // Function: GetIconSymbol
+    // Purpose : Returns text or emoji to be shown inside the icon
+    //           For example: "⚙" for .exe, "🐍" for .py
+    //-------------------------------------------------------------------------
+    std::wstring GetIconSymbol(const std::wstring& extension);
+};
@@ -1,254 +1,859 @@
-﻿#include "Main.h"
-#include "ToolIconManager.h"
-#include "ToolScanner.h"
-#include "ToolRenderer.h"
-#include "Resource.h"
-#include <algorithm>
-#include <memory>
-#include <cwctype>
-#undef max
-
-using namespace std;
-using namespace Gdiplus;
-
-#pragma comment(lib, "uxtheme.lib")
-#pragma comment(lib, "msimg32.lib")
-#pragma comment(lib, "gdiplus.lib")
-#pragma comment(lib, "dwmapi.lib")
-#pragma comment(lib, "comctl32.lib")
-#pragma comment(lib, "shell32.lib")
-
-ToolLauncher::ToolLauncher()
-    : hwnd(nullptr), searchBox(nullptr), statusBar(nullptr),
-    hoveredTool(-1), selectedTool(-1),
-    hBufferBitmap(nullptr), hBufferDC(nullptr),
-    lastWidth(0), lastHeight(0),
-    viewMode(ViewMode::VIEW_GRID)
-{
-    GdiplusStartup(&gdiplusToken, &gdiplusStartupInput, nullptr);
-
-    backgroundBrush = CreateSolidBrush(win11_background);
-    buttonBrush = CreateSolidBrush(win11_surface);
-    hoverBrush = CreateSolidBrush(win11_hover);
-    accentBrush = CreateSolidBrush(win11_accent);
-
-    headerFont = CreateFont(32, 0, 0, 0, FW_SEMIBOLD, FALSE, FALSE, FALSE,
-        DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
-        CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_SWISS, L"Segoe UI Variable");
-
-    toolFont = CreateFont(14, 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
-        DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
-        CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_SWISS, L"Segoe UI Variable Text");
-
-    searchFont = CreateFont(16, 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
-        DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
-        CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_SWISS, L"Segoe UI Variable Text");
-
-    iconManager = make_unique<ToolIconManager>();
-    scanner = make_unique<ToolScanner>(iconManager.get());
-    renderer = make_unique<ToolRenderer>(this);
-}
-
-ToolLauncher::~ToolLauncher()
-{
-    GdiplusShutdown(gdiplusToken);
-
-    DeleteObject(backgroundBrush);
-    DeleteObject(buttonBrush);
-    DeleteObject(hoverBrush);
-    DeleteObject(accentBrush);
-
-    DeleteObject(headerFont);
-    DeleteObject(toolFont);
-    DeleteObject(searchFont);
-
-    for (auto& tool : tools)
-    {
-        if (tool.icon)
-            DeleteObject(tool.icon);
-    }
-
-    CleanupDoubleBuffer();
-}
-
-bool ToolLauncher::CreateMainWindow()
-{
-    const wchar_t CLASS_NAME[] = L"Win11ToolLauncher";
-
-    WNDCLASS wc = {};
-    wc.lpfnWndProc = ToolLauncher::WndProc;
-    wc.hInstance = GetModuleHandle(nullptr);
-    wc.lpszClassName = CLASS_NAME;
-    wc.hCursor = LoadCursor(nullptr, IDC_ARROW);
-    wc.hbrBackground = backgroundBrush;
-    wc.hIcon = LoadIcon(GetModuleHandle(nullptr), MAKEINTRESOURCE(IDI_UI));
-
-    if (!RegisterClass(&wc)) {
-        MessageBoxW(nullptr, L"Window Registration Failed!", L"Error", MB_ICONERROR);
-        return false;
-    }
-
-    hwnd = CreateWindowEx(
-        WS_EX_APPWINDOW | WS_EX_CONTEXTHELP,
-        CLASS_NAME, L"Customization Tools",
-        WS_OVERLAPPEDWINDOW | WS_CLIPCHILDREN | WS_HSCROLL | WS_VSCROLL,
-        CW_USEDEFAULT, CW_USEDEFAULT, 900, 700,
-        nullptr, nullptr, GetModuleHandle(nullptr), this);
-
-    if (!hwnd) {
-        MessageBoxW(nullptr, L"Window Creation Failed!", L"Error", MB_ICONERROR);
-        return false;
-    }
-
-    SendMessage(hwnd, WM_SETICON, ICON_SMALL, (LPARAM)LoadIcon(GetModuleHandle(nullptr), MAKEINTRESOURCE(IDI_UI)));
-    SendMessage(hwnd, WM_SETICON, ICON_BIG, (LPARAM)LoadIcon(GetModuleHandle(nullptr), MAKEINTRESOURCE(IDI_UI)));
-
-    DWM_WINDOW_CORNER_PREFERENCE cornerPref = DWMWCP_ROUND;
-    DwmSetWindowAttribute(hwnd, DWMWA_WINDOW_CORNER_PREFERENCE, &cornerPref, sizeof(cornerPref));
-
-    return true;
-}
-
-int ToolLauncher::MessageLoop()
-{
-    MSG msg = {};
-    while (GetMessage(&msg, nullptr, 0, 0))
-    {
-        TranslateMessage(&msg);
-        DispatchMessage(&msg);
-    }
-    return static_cast<int>(msg.wParam);
-}
-
-void ToolLauncher::Show(int nCmdShow)
-{
-    ShowWindow(hwnd, nCmdShow);
-    UpdateWindow(hwnd);
-}
-
-void ToolLauncher::ScanForTools()
-{
-    tools = scanner->ScanForTools();
-
-    if (tools.empty())
-    {
-        MessageBox(hwnd, L"Tools not available!", L"Warning", MB_ICONWARNING);
-    }
-
-    filteredTools = tools;
-    scrollX = scrollY = 0;
-
-    CalculateVirtualSize();
-    UpdateScrollBars();
-    CalculateToolPositions();
-    InvalidateRect(hwnd, nullptr, TRUE);
-}
-
-void ToolLauncher::CalculateToolPositions()
-{
-    int maxX = 0, maxY = 0;
-    const int startX = 32;
-    const int startY = HEADER_HEIGHT + SEARCH_BOX_HEIGHT + 70;
-
-    if (viewMode == ViewMode::VIEW_GRID)
-    {
-        for (size_t i = 0; i < filteredTools.size(); ++i)
-        {
-            int col = static_cast<int>(i % COLS_PER_ROW);
-            int row = static_cast<int>(i / COLS_PER_ROW);
-
-            int x = startX + col * (TOOL_BUTTON_SIZE + 16);
-            int y = startY + row * (TOOL_BUTTON_SIZE + 60);
-
-            filteredTools[i].rect = {
-                x - scrollX, y - scrollY,
-                x - scrollX + TOOL_BUTTON_SIZE,
-                y - scrollY + TOOL_BUTTON_SIZE + 40
-            };
-
-            maxX = max(maxX, x + TOOL_BUTTON_SIZE + 32);
-            maxY = max(maxY, y + TOOL_BUTTON_SIZE + 72);
-        }
-    }
-    else
-    {
-        maxX = startX + 600 + 32;
-        maxY = startY;
-
-        for (size_t i = 0; i < filteredTools.size(); ++i)
-        {
-            int y = startY + static_cast<int>(i * 60);
-
-            filteredTools[i].rect = {
-                startX - scrollX, y - scrollY,
-                startX - scrollX + 600,
-                y - scrollY + 50
-            };
-
-            maxY = max(maxY, y + 82);
-        }
-    }
-
-    virtualWidth = maxX;
-    virtualHeight = maxY;
-
-    UpdateScrollBars();
-}
-
-void ToolLauncher::FilterTools(const std::wstring& searchText)
-{
-    filteredTools.clear();
-
-    if (searchText.empty()) {
-        filteredTools = tools;
-    }
-    else {
-        std::wstring lowerSearch = searchText;
-        std::transform(lowerSearch.begin(), lowerSearch.end(), lowerSearch.begin(), ::towlower);
-
-        for (const auto& tool : tools) {
-            std::wstring name = tool.displayName;
-            std::replace(name.begin(), name.end(), L'_', L' ');
-            std::transform(name.begin(), name.end(), name.begin(), ::towlower);
-
-            if (name.find(lowerSearch) != std::wstring::npos) {
-                filteredTools.push_back(tool);
-            }
-        }
-    }
-
-    scrollX = scrollY = 0;
-    CalculateVirtualSize();
-    UpdateScrollBars();
-    CalculateToolPositions();
-    InvalidateRect(hwnd, nullptr, TRUE);
-}
-
-void ToolLauncher::LaunchTool(int index)
-{
-    if (index >= 0 && index < static_cast<int>(filteredTools.size()))
-    {
-        SHELLEXECUTEINFO sei = { sizeof(sei) };
-        sei.lpVerb = L"open";
-        sei.lpFile = filteredTools[index].filename.c_str();
-        sei.nShow = SW_SHOWNORMAL;
-
-        std::wstring status = ShellExecuteEx(&sei)
-            ? L"✓ Launched: " + filteredTools[index].displayName
-            : L"✗ Failed to launch: " + filteredTools[index].displayName;
-
-        SendMessage(statusBar, SB_SETTEXT, 0, (LPARAM)status.c_str());
-    }
-}
-
-int ToolLauncher::GetToolAtPoint(POINT pt)
-{
-    for (size_t i = 0; i < filteredTools.size(); ++i)
-    {
-        if (PtInRect(&filteredTools[i].rect, pt))
-        {
-            return static_cast<int>(i);
-        }
-    }
-    return -1;
-}
+﻿#include "Main.h"
+#include "ToolIconManager.h"
+#include "ToolScanner.h"
+#include "ToolRenderer.h"
+#include "TextNormalizer.h"
+#include "FuzzyMatcher.h"
+#include "Resource.h"
+#include <algorithm>
+#include <memory>
+#include <cwctype>
+#include <iterator>
+#include <filesystem>
+#undef max
+
+using namespace std;
+using namespace Gdiplus;
+
+#pragma comment(lib, "uxtheme.lib")
+#pragma comment(lib, "msimg32.lib")
+#pragma comment(lib, "gdiplus.lib")
+#pragma comment(lib, "dwmapi.lib")
+#pragma comment(lib, "comctl32.lib")
+#pragma comment(lib, "shell32.lib")
+
+ToolLauncher::ToolLauncher()
+    : hwnd(nullptr), searchBox(nullptr), statusBar(nullptr),
+    hoveredTool(-1), selectedTool(-1),
+    viewMode(ViewMode::VIEW_GRID)
+{
+    GdiplusStartup(&gdiplusToken, &gdiplusStartupInput, nullptr);
+
+    backgroundBrush = CreateSolidBrush(win11_background);
+    buttonBrush = CreateSolidBrush(win11_surface);
+    hoverBrush = CreateSolidBrush(win11_hover);
+    accentBrush = CreateSolidBrush(win11_accent);
+
+    headerFont = CreateFont(32, 0, 0, 0, FW_SEMIBOLD, FALSE, FALSE, FALSE,
+        DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
+        CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_SWISS, L"Segoe UI Variable");
+
+    toolFont = CreateFont(14, 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
+        DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
+        CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_SWISS, L"Segoe UI Variable Text");
+
+    searchFont = CreateFont(16, 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
+        DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
+        CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_SWISS, L"Segoe UI Variable Text");
+
+    // Executables' icons are decoded off the UI thread, see ApplyFileIcons
+    iconManager = make_unique<ToolIconManager>();
+    iconManager->Start([this]() { PostMessage(hwnd, WM_APP_ICONS_READY, 0, 0); });
+    scanner = make_unique<ToolScanner>(iconManager.get());
+    scanner->LoadOptionsFromEnvironment();
+    renderer = make_unique<ToolRenderer>(this);
+
+    // Results are only announced; OnSearchComplete picks up the newest one
+    searchService = make_unique<SearchService>();
+    searchService->Start([this]() { PostMessage(hwnd, WM_APP_SEARCH_DONE, 0, 0); });
+}
+
+ToolLauncher::~ToolLauncher()
+{
+    scanner->CancelAsyncScan();
+    CleanupDoubleBuffer();
+    renderer.reset();   // Owns GDI+ objects; they must go before GDI+ itself
+    GdiplusShutdown(gdiplusToken);
+
+    if (updateRegion)
+        DeleteObject(updateRegion);
+
+    DeleteObject(backgroundBrush);
+    DeleteObject(buttonBrush);
+    DeleteObject(hoverBrush);
+    DeleteObject(accentBrush);
+
+    DeleteObject(headerFont);
+    DeleteObject(toolFont);
+    DeleteObject(searchFont);
+
+    // Tool icons are slots in iconManager's atlas, which frees itself
+}
+
+bool ToolLauncher::CreateMainWindow()
+{
+    const wchar_t CLASS_NAME[] = L"Win11ToolLauncher";
+
+    WNDCLASS wc = {};
+    wc.lpfnWndProc = ToolLauncher::WndProc;
+    wc.hInstance = GetModuleHandle(nullptr);
+    wc.lpszClassName = CLASS_NAME;
+    wc.hCursor = LoadCursor(nullptr, IDC_ARROW);
+    wc.hbrBackground = backgroundBrush;
+    wc.hIcon = LoadIcon(GetModuleHandle(nullptr), MAKEINTRESOURCE(IDI_UI));
+
+    if (!RegisterClass(&wc)) {
+        MessageBoxW(nullptr, L"Window Registration Failed!", L"Error", MB_ICONERROR);
+        return false;
+    }
+
+    hwnd = CreateWindowEx(
+        WS_EX_APPWINDOW | WS_EX_CONTEXTHELP,
+        CLASS_NAME, L"Customization Tools",
+        WS_OVERLAPPEDWINDOW | WS_CLIPCHILDREN | WS_HSCROLL | WS_VSCROLL,
+        CW_USEDEFAULT, CW_USEDEFAULT, 900, 700,
+        nullptr, nullptr, GetModuleHandle(nullptr), this);
+
+    if (!hwnd) {
+        MessageBoxW(nullptr, L"Window Creation Failed!", L"Error", MB_ICONERROR);
+        return false;
+    }
+
+    SendMessage(hwnd, WM_SETICON, ICON_SMALL, (LPARAM)LoadIcon(GetModuleHandle(nullptr), MAKEINTRESOURCE(IDI_UI)));
+    SendMessage(hwnd, WM_SETICON, ICON_BIG, (LPARAM)LoadIcon(GetModuleHandle(nullptr), MAKEINTRESOURCE(IDI_UI)));
+
+    DWM_WINDOW_CORNER_PREFERENCE cornerPref = DWMWCP_ROUND;
+    DwmSetWindowAttribute(hwnd, DWMWA_WINDOW_CORNER_PREFERENCE, &cornerPref, sizeof(cornerPref));
+
+    return true;
+}
+
+int ToolLauncher::MessageLoop()
+{
+    MSG msg = {};
+    while (GetMessage(&msg, nullptr, 0, 0))
+    {
+        // Shortcuts go first, like an accelerator table: the search box
+        // has the focus and would otherwise take every key
+        if (msg.message == WM_KEYDOWN && (msg.hwnd == hwnd || IsChild(hwnd, msg.hwnd)) &&
+            HandleShortcut(msg.wParam))
+            continue;
+
+        TranslateMessage(&msg);
+        DispatchMessage(&msg);
+    }
+    return static_cast<int>(msg.wParam);
+}
+
+void ToolLauncher::Show(int nCmdShow)
+{
+    ShowWindow(hwnd, nCmdShow);
+    UpdateWindow(hwnd);
+}
+
+void ToolLauncher::ScanForTools()
+{
+    // Stop a scan that is still running and drop everything it produced
+    scanner->CancelAsyncScan();
+    {
+        std::lock_guard<std::mutex> guard(scanLock);
+        for (auto& tool : pendingScanTools)
+            iconManager->ReleaseIcon(tool.icon);
+        pendingScanTools.clear();
+
+        if (pendingRescan)
+        {
+            for (auto& tool : pendingRescan->created)
+                iconManager->ReleaseIcon(tool.icon);
+            pendingRescan.reset();
+        }
+    }
+
+    for (auto& tool : tools)
+        iconManager->ReleaseIcon(tool.icon);
+    tools.clear();
+    filteredView.clear();
+    searchIndexDirty = sortDirty = true;
+
+    scrollX = scrollY = 0;
+    hoveredTool = lastHoveredTool = -1;
+
+    // Warm start: show the cached catalog now and only validate it in the background
+    if (scanner->LoadCatalogCache(tools))
+    {
+        scanner->LoadLaunchHistory(tools);
+        historyLoaded = true;
+        ReapplyFilter();
+        UpdateStatusText(L"Checking for changes...", static_cast<int>(filteredView.size()));
+
+        // However stale the cache, the walk is merged as is (OnScanComplete):
+        // no second walk on the UI thread
+        scanner->StartAsyncRescan(tools,
+            [this](RescanResult&& result)
+            {
+                std::lock_guard<std::mutex> guard(scanLock);
+                pendingRescan = make_unique<RescanResult>(std::move(result));
+            },
+            [this](bool cancelled)
+            {
+                if (!cancelled)
+                    PostMessage(hwnd, WM_APP_SCAN_DONE, 0, 0);
+            });
+        return;
+    }
+
+    RequestFrame(FRAME_LAYOUT | FRAME_REPAINT);
+
+    // Batches arrive on walker threads; queue them and poke the UI thread once
+    scanner->StartAsyncScan(
+        [this](std::vector<ToolInfo>&& batch)
+        {
+            bool wasEmpty;
+            {
+                std::lock_guard<std::mutex> guard(scanLock);
+                wasEmpty = pendingScanTools.empty();
+                std::move(batch.begin(), batch.end(), std::back_inserter(pendingScanTools));
+            }
+
+            if (wasEmpty)
+                PostMessage(hwnd, WM_APP_SCAN_BATCH, 0, 0);
+        },
+        [this](bool cancelled)
+        {
+            if (!cancelled)
+                PostMessage(hwnd, WM_APP_SCAN_DONE, 0, 0);
+        });
+}
+
+void ToolLauncher::MergeScanBatch()
+{
+    std::vector<ToolInfo> batch;
+    {
+        std::lock_guard<std::mutex> guard(scanLock);
+        batch.swap(pendingScanTools);
+    }
+
+    if (batch.empty())
+        return;
+
+    auto byFilename = [](const ToolInfo& a, const ToolInfo& b) { return a.filename < b.filename; };
+    std::sort(batch.begin(), batch.end(), byFilename);
+
+    // Keep the catalog sorted by filename (ApplyDeltas relies on it)
+    size_t toolsMiddle = tools.size();
+    std::move(batch.begin(), batch.end(), std::back_inserter(tools));
+    std::inplace_merge(tools.begin(), tools.begin() + toolsMiddle, tools.end(), byFilename);
+    catalogDirty = true;
+    searchIndexDirty = sortDirty = true;
+
+    // Search already works on partial results: substring matches show up
+    // now (in catalog order) and are ranked once the scan completes
+    RebuildCatalogView();
+
+    hoveredTool = lastHoveredTool = -1;
+    RequestFrame(FRAME_LAYOUT | FRAME_REPAINT);
+    UpdateStatusText(L"Scanning...", static_cast<int>(filteredView.size()));
+}
+
+void ToolLauncher::OnScanComplete()
+{
+    MergeScanBatch();
+    MergeRescan();          // Validation of a cache-loaded catalog
+    ApplyCatalogDeltas();
+
+    // A cold scan only now has every tool the history may name
+    if (!historyLoaded)
+    {
+        if (scanner->LoadLaunchHistory(tools))
+            sortDirty = true;
+        historyLoaded = true;
+    }
+
+    // Partial results were only substring-filtered; rank the final set
+    if (!activeFilter.empty())
+        ReapplyFilter();
+
+    if (tools.empty())
+    {
+        MessageBox(hwnd, L"Tools not available!", L"Warning", MB_ICONWARNING);
+    }
+
+    UpdateStatusText(L"Ready", static_cast<int>(filteredView.size()));
+    SaveCatalog();
+
+    // Follow changes live from here on
+    StartWatcher();
+}
+
+void ToolLauncher::SaveCatalog()
+{
+    // Not worth a failure message: without a cache the next start just scans
+    if (catalogDirty && !scanner->IsScanning() && scanner->SaveCatalogCache(tools))
+        catalogDirty = false;
+
+    // Per user, so launches never rewrite the shared cache. Before the
+    // history was loaded, saving would drop the entries not yet merged.
+    if (historyDirty && historyLoaded && scanner->SaveLaunchHistory(tools))
+        historyDirty = false;
+}
+
+void ToolLauncher::EnsureVisibleIcons(const RECT& clientRect)
+{
+    size_t first, last;
+    GetVisibleTools(clientRect, first, last);
+
+    for (size_t i = first; i < last; ++i)
+    {
+        ToolInfo& tool = tools[filteredView[i]];
+        if (!tool.icon)
+            scanner->EnsureIcon(tool);
+    }
+}
+
+void ToolLauncher::ApplyFileIcons()
+{
+    // Cards of the swapped icons are composed again on the next paint
+    if (iconManager->TakeFileIcons(readyIcons) && scanner->ApplyFileIcons(tools, readyIcons))
+        RequestFrame(FRAME_REPAINT);
+}
+
+ToolInfo& ToolLauncher::GetViewTool(int position)
+{
+    return tools[filteredView[position]];
+}
+
+int ToolLauncher::GetViewCount() const
+{
+    return static_cast<int>(filteredView.size());
+}
+
+void ToolLauncher::RebuildCatalogView()
+{
+    // Reuses the view's capacity - no allocation once it has grown
+    filteredView.clear();
+    for (uint32_t id = 0; id < static_cast<uint32_t>(tools.size()); ++id)
+    {
+        if (MatchesFilter(tools[id]))
+            filteredView.push_back(id);
+    }
+
+    ApplySortOrder();
+}
+
+void ToolLauncher::RefreshTools()
+{
+    // The initial scan or a rescan is still running; it will be complete anyway
+    if (scanner->IsScanning())
+    {
+        UpdateStatusText(L"Scan in progress", static_cast<int>(filteredView.size()));
+        return;
+    }
+
+    // A finished rescan still in the queue goes first: only one result is pending
+    MergeRescan();
+
+    // Walked on the scan thread; the UI thread only merges (WM_APP_RESCAN_DONE)
+    UpdateStatusText(L"Refreshing tools...", static_cast<int>(filteredView.size()));
+    scanner->StartAsyncRescan(tools,
+        [this](RescanResult&& result)
+        {
+            {
+                std::lock_guard<std::mutex> guard(scanLock);
+                pendingRescan = make_unique<RescanResult>(std::move(result));
+            }
+            PostMessage(hwnd, WM_APP_RESCAN_DONE, 0, 0);
+        },
+        nullptr);
+}
+
+void ToolLauncher::MergeRescan()
+{
+    std::unique_ptr<RescanResult> result;
+    {
+        std::lock_guard<std::mutex> guard(scanLock);
+        result.swap(pendingRescan);
+    }
+
+    if (!result)
+        return;
+
+    // Without changes every entry keeps its position: nothing to redo
+    RescanStats stats = scanner->MergeRescan(tools, *result);
+    if (stats.HasChanges())
+    {
+        catalogDirty = true;
+        searchIndexDirty = sortDirty = true;
+
+        // Catalog positions moved; re-apply the current search to the new ids
+        hoveredTool = lastHoveredTool = -1;
+        ReapplyFilter();
+    }
+
+    std::wstring message = L"Tools refreshed (+" + std::to_wstring(stats.added) +
+        L" ~" + std::to_wstring(stats.updated) +
+        L" -" + std::to_wstring(stats.removed) + L")";
+    UpdateStatusText(message, static_cast<int>(filteredView.size()));
+
+    // Watcher changes held back while the walk ran
+    ApplyCatalogDeltas();
+}
+
+void ToolLauncher::UpdateLayout()
+{
+    // Positions live in content coordinates: scrolling never comes back here.
+    // Everything is O(1) in the tool count, so live resizing stays cheap.
+    // Runs from the frame pass (FRAME_LAYOUT), which updates the scroll bars next
+    ScopedTimer timer(ProfileZone::Layout);
+
+    RECT clientRect;
+    GetClientRect(hwnd, &clientRect);
+
+    // Client size as it would be without our own scroll bars
+    const int scrollBarWidth = GetSystemMetrics(SM_CXVSCROLL);
+    const int fullWidth = clientRect.right + (showVScrollBar ? scrollBarWidth : 0);
+    const int fullHeight = clientRect.bottom + (showHScrollBar ? GetSystemMetrics(SM_CYHSCROLL) : 0);
+
+    auto fitToWidth = [this](int width)
+    {
+        UniformLayout layout;
+        layout.originX = VIEW_MARGIN;
+        layout.originY = VIEW_TOP;
+        layout.padding = VIEW_MARGIN;
+
+        const int available = width - layout.originX - layout.padding;
+        if (viewMode == ViewMode::VIEW_GRID)
+        {
+            const int gap = 16;
+            layout.pitchX = TOOL_BUTTON_SIZE + gap;
+            layout.pitchY = TOOL_BUTTON_SIZE + 60;
+            layout.itemWidth = TOOL_BUTTON_SIZE;
+            layout.itemHeight = TOOL_BUTTON_SIZE + 40;
+            layout.columns = max(1, (available + gap) / layout.pitchX);
+        }
+        else if (viewMode == ViewMode::Details)
+        {
+            // Column titles sit above the rows; below 900 the columns scroll sideways
+            layout.originY += DETAILS_HEADER_HEIGHT + 4;
+            layout.pitchX = layout.itemWidth = max(900, available);
+            layout.pitchY = 28;
+            layout.itemHeight = 26;
+            layout.columns = 1;
+        }
+        else
+        {
+            // Rows stretch to the window; narrower than this they scroll sideways
+            layout.pitchX = layout.itemWidth = max(400, available);
+            layout.pitchY = 60;
+            layout.itemHeight = 50;
+            layout.columns = 1;
+        }
+
+        rowWidth = layout.itemWidth;
+
+        viewLayout.SetUniform(layout, filteredView.size());
+    };
+
+    // Content taller than the window needs the vertical bar: fit beside it
+    fitToWidth(fullWidth);
+    if (viewLayout.GetContentHeight() > fullHeight)
+        fitToWidth(fullWidth - scrollBarWidth);
+
+    virtualWidth = viewLayout.GetContentWidth();
+    virtualHeight = viewLayout.GetContentHeight();
+}
+
+void ToolLauncher::SetViewMode(ViewMode mode)
+{
+    if (mode == viewMode)
+        return;
+
+    viewMode = mode;
+    scrollX = scrollY = 0;
+    hoveredTool = lastHoveredTool = -1;
+
+    // Only the details view is column-sorted; the others show catalog
+    // or relevance order, so the view is rebuilt when that changes
+    if (sortColumn != SortColumn::None)
+    {
+        RebuildCatalogView();
+        if (!activeFilter.empty())
+            SubmitSearch(false);
+    }
+
+    RequestFrame(FRAME_LAYOUT | FRAME_REPAINT);
+
+    const wchar_t* name = mode == ViewMode::VIEW_GRID ? L"Grid view"
+        : mode == ViewMode::List ? L"List view" : L"Details view";
+    UpdateStatusText(name, GetViewCount());
+}
+
+void ToolLauncher::SortByColumn(SortColumn column)
+{
+    // Same column flips the direction; times and sizes start newest/largest first
+    if (column == sortColumn)
+        sortDescending = !sortDescending;
+    else
+        sortDescending = column == SortColumn::Size || column == SortColumn::Modified ||
+            column == SortColumn::LastLaunched;
+
+    sortColumn = column;
+    sortDirty = true;
+
+    // The view keeps its members (search results included), only the order changes
+    hoveredTool = lastHoveredTool = -1;
+    ApplySortOrder();
+    ShowView(false);
+}
+
+void ToolLauncher::ApplySortOrder()
+{
+    if (viewMode != ViewMode::Details || sortColumn == SortColumn::None)
+        return;
+
+    if (sortDirty)
+        BuildSortOrder();
+
+    // Rank lookups only: refining a search never re-sorts the catalog
+    columnSort.Arrange(filteredView);
+}
+
+void ToolLauncher::BuildSortOrder()
+{
+    const uint32_t count = static_cast<uint32_t>(tools.size());
+    std::vector<SortKey> keys(count);
+    std::vector<std::wstring> folderKeys;
+    ColumnSort::TieCompare tie;
+
+    // Packed keys are compared as integers; text falls back to the full
+    // string only when the first four characters are equal
+    switch (sortColumn)
+    {
+    case SortColumn::Name:
+        for (uint32_t id = 0; id < count; ++id)
+            keys[id] = { ColumnSort::PackText(tools[id].searchKey), id };
+        tie = [this](uint32_t a, uint32_t b) { return tools[a].searchKey.compare(tools[b].searchKey); };
+        break;
+
+    case SortColumn::Extension:
+        for (uint32_t id = 0; id < count; ++id)
+            keys[id] = { ColumnSort::PackText(tools[id].extension), id };
+        tie = [this](uint32_t a, uint32_t b) { return tools[a].extension.compare(tools[b].extension); };
+        break;
+
+    case SortColumn::Size:
+        for (uint32_t id = 0; id < count; ++id)
+            keys[id] = { tools[id].size, id };
+        break;
+
+    case SortColumn::Modified:
+        for (uint32_t id = 0; id < count; ++id)
+            keys[id] = { ColumnSort::PackSigned(tools[id].mtime), id };
+        break;
+
+    case SortColumn::LastLaunched:
+        for (uint32_t id = 0; id < count; ++id)
+            keys[id] = { ColumnSort::PackSigned(tools[id].lastLaunched), id };
+        break;
+
+    case SortColumn::Folder:
+        folderKeys.reserve(count);
+        for (uint32_t id = 0; id < count; ++id)
+        {
+            folderKeys.push_back(TextNormalizer::ToLower(tools[id].folder));
+            keys[id] = { ColumnSort::PackText(folderKeys.back()), id };
+        }
+        tie = [&folderKeys](uint32_t a, uint32_t b) { return folderKeys[a].compare(folderKeys[b]); };
+        break;
+
+    default:
+        columnSort.Clear();
+        return;
+    }
+
+    columnSort.Build(std::move(keys), sortDescending, tie);
+    sortDirty = false;
+}
+
+RECT ToolLauncher::GetDetailsHeaderRect() const
+{
+    // Stays put vertically, follows horizontal scrolling with the rows
+    return { VIEW_MARGIN - scrollX, VIEW_TOP, VIEW_MARGIN + rowWidth - scrollX, VIEW_TOP + DETAILS_HEADER_HEIGHT };
+}
+
+int ToolLauncher::GetContentTop() const
+{
+    // Rows are clipped below this line; everything above it is pinned
+    return viewMode == ViewMode::Details ? VIEW_TOP + DETAILS_HEADER_HEIGHT + 4 : VIEW_TOP;
+}
+
+SortColumn ToolLauncher::GetHeaderColumnAtPoint(POINT pt) const
+{
+    RECT header = GetDetailsHeaderRect();
+    if (viewMode != ViewMode::Details || !PtInRect(&header, pt))
+        return SortColumn::None;
+
+    int edges[ToolRenderer::DETAILS_COLUMN_COUNT + 1];
+    ToolRenderer::GetDetailsColumns(header.left, header.right, edges);
+    for (int i = 0; i < ToolRenderer::DETAILS_COLUMN_COUNT; ++i)
+    {
+        if (pt.x >= edges[i] && pt.x < edges[i + 1])
+            return static_cast<SortColumn>(i + 1);
+    }
+    return SortColumn::None;
+}
+
+RECT ToolLauncher::GetToolScreenRect(int position) const
+{
+    HitRect item = viewLayout.GetItemRect(position);
+    return { item.left - scrollX, item.top - scrollY, item.right - scrollX, item.bottom - scrollY };
+}
+
+void ToolLauncher::GetVisibleTools(const RECT& clientRect, size_t& first, size_t& last) const
+{
+    viewLayout.GetVisibleRange(clientRect.top + scrollY, clientRect.bottom + scrollY, first, last);
+}
+
+void ToolLauncher::FilterTools(const std::wstring& searchText)
+{
+    ScopedTimer timer(ProfileZone::Filter);
+
+    // Same normalization as the keys, so "my_tool" finds "My_Tool"
+    activeFilter = ToolScanner::MakeSearchKey(searchText);
+
+    if (!activeFilter.empty())
+    {
+        // Ranked on the search thread; the grid changes when the result is in
+        SubmitSearch(false);
+        return;
+    }
+
+    // Nothing to search for: whatever is still running is stale
+    searchService->Cancel();
+    searchGeneration = 0;
+
+    RebuildCatalogView();
+    ShowView(false);
+}
+
+void ToolLauncher::SubmitSearch(bool keepScroll)
+{
+    // Keys are handed over lazily: a burst of catalog changes costs one build
+    if (searchIndexDirty)
+    {
+        std::vector<std::wstring> keys;
+        keys.reserve(tools.size());
+        for (const auto& tool : tools)
+            keys.push_back(tool.searchKey);
+
+        searchService->SetKeys(std::move(keys));
+        searchIndexDirty = false;
+    }
+
+    // A typed query still on its way keeps its jump to the top
+    searchKeepsScroll = keepScroll && (searchGeneration == 0 || searchKeepsScroll);
+    searchGeneration = searchService->Submit(activeFilter);
+}
+
+void ToolLauncher::OnSearchComplete()
+{
+    // Older generations were superseded by a later keystroke or a cleared
+    // box; a catalog change since the submit means the ids are stale
+    if (!searchService->TakeResult(searchResult) || searchResult.generation != searchGeneration ||
+        searchIndexDirty)
+        return;
+
+    searchGeneration = 0;
+    filteredView.swap(searchResult.ids);
+    ApplySortOrder();
+
+    hoveredTool = lastHoveredTool = -1;
+    ShowView(searchKeepsScroll);
+    if (!searchKeepsScroll)
+        UpdateStatusText(L"Search results", GetViewCount());
+}
+
+void ToolLauncher::ShowView(bool keepScroll)
+{
+    // New results start at the top; re-ranked ones keep the user's place
+    // (UpdateScrollBars clamps it to the new content height)
+    scrollX = 0;
+    if (!keepScroll)
+        scrollY = 0;
+
+    RequestFrame(FRAME_LAYOUT | FRAME_REPAINT);
+}
+
+// Plain substring test, used where results are not ranked (catalog order)
+bool ToolLauncher::MatchesFilter(const ToolInfo& tool) const
+{
+    if (activeFilter.empty())
+        return true;
+
+    return tool.searchKey.find(activeFilter) != std::wstring::npos;
+}
+
+void ToolLauncher::StartWatcher()
+{
+    if (!watcher)
+        watcher = make_unique<ToolWatcher>();
+
+    const WalkOptions& options = scanner->GetWalkOptions();
+
+    // Runs on the watcher thread: queue the batch and poke the UI thread once
+    watcher->Start(options.roots, options.extensions,
+        [this](std::vector<CatalogDelta>&& batch)
+        {
+            bool wasEmpty;
+            {
+                std::lock_guard<std::mutex> guard(deltaLock);
+                wasEmpty = pendingDeltas.empty();
+                std::move(batch.begin(), batch.end(), std::back_inserter(pendingDeltas));
+            }
+
+            if (wasEmpty)
+                PostMessage(hwnd, WM_APP_CATALOG_CHANGED, 0, 0);
+        });
+}
+
+void ToolLauncher::ReapplyFilter()
+{
+    // Catalog ids moved: substring matches stand in until the ranked result arrives
+    RebuildCatalogView();
+    ShowView(true);
+
+    if (!activeFilter.empty())
+        SubmitSearch(true);
+}
+
+void ToolLauncher::ApplyCatalogDeltas()
+{
+    // A running walk would overwrite them; they are applied after it
+    // (OnScanComplete / MergeRescan)
+    if (scanner->IsScanning())
+        return;
+
+    std::vector<CatalogDelta> batch;
+    {
+        std::lock_guard<std::mutex> guard(deltaLock);
+        batch.swap(pendingDeltas);
+    }
+
+    if (batch.empty())
+        return;
+
+    // A settled search result is patched (PatchView); the tags move with
+    // the entries while ApplyDeltas inserts and erases around them. Without
+    // a query the view is the whole catalog, and a search still running
+    // has to be asked again with the new keys anyway.
+    const bool patch = !activeFilter.empty() && searchGeneration == 0;
+    if (patch)
+    {
+        for (uint32_t position = 0; position < filteredView.size(); ++position)
+            tools[filteredView[position]].viewTag = position + 1;
+    }
+
+    DeltaResult result = scanner->ApplyDeltas(tools, batch);
+    if (result.needsRescan)
+    {
+        // Nothing was applied: the ids are still those of the view
+        if (patch)
+        {
+            for (uint32_t id : filteredView)
+                tools[id].viewTag = 0;
+        }
+        RefreshTools();
+        return;
+    }
+    catalogDirty = true;
+    searchIndexDirty = sortDirty = true;
+
+    // Catalog positions shifted, so the view is patched or rebuilt
+    hoveredTool = lastHoveredTool = -1;
+    if (patch)
+        PatchView(result);
+    else
+        ReapplyFilter();
+    UpdateStatusText(L"Tools updated", static_cast<int>(filteredView.size()));
+}
+
+void ToolLauncher::PatchView(const DeltaResult& result)
+{
+    // Removed entries took their tags with them. Only the changed ones are
+    // matched again (same test as the search's fuzzy tier, which includes
+    // every substring match): new matches go to the end, members that no
+    // longer match leave. The search index catches up on the next keystroke.
+    const FuzzyMatcher matcher(activeFilter);
+    const uint32_t shown = static_cast<uint32_t>(filteredView.size());
+    uint32_t next = shown;
+
+    for (const auto& path : result.changedPaths)
+    {
+        auto it = std::lower_bound(tools.begin(), tools.end(), path,
+            [](const ToolInfo& tool, const std::wstring& key) { return tool.filename < key; });
+        if (it == tools.end() || it->filename != path)
+            continue;   // Removed again later in the batch
+
+        const bool matches = matcher.Score(it->searchKey.data(), it->searchKey.size()) != FuzzyMatcher::kNoMatch;
+        if (it->viewTag && !matches)
+            it->viewTag = 0;
+        else if (!it->viewTag && matches)
+            it->viewTag = ++next;
+    }
+
+    // One pass over the catalog puts every tagged entry back at its
+    // position and clears the tag
+    const uint32_t none = UINT32_MAX;
+    filteredView.assign(next, none);
+    for (uint32_t id = 0; id < static_cast<uint32_t>(tools.size()); ++id)
+    {
+        uint32_t& tag = tools[id].viewTag;
+        if (tag)
+        {
+            filteredView[tag - 1] = id;
+            tag = 0;
+        }
+    }
+    filteredView.erase(std::remove(filteredView.begin(), filteredView.end(), none), filteredView.end());
+
+    ApplySortOrder();
+    ShowView(true);
+}
+
+void ToolLauncher::LaunchTool(int index)
+{
+    if (index >= 0 && index < GetViewCount())
+    {
+        ScopedTimer timer(ProfileZone::Launch);
+        ToolInfo& tool = GetViewTool(index);
+
+        SHELLEXECUTEINFO sei = { sizeof(sei) };
+        sei.lpVerb = L"open";
+        sei.lpFile = tool.filename.c_str();
+        sei.lpDirectory = tool.folder.c_str();
+        sei.nShow = SW_SHOWNORMAL;
+
+        bool launched = ShellExecuteEx(&sei) != FALSE;
+        std::wstring status = launched
+            ? L"✓ Launched: " + tool.displayText
+            : L"✗ Failed to launch: " + tool.displayText;
+
+        if (launched)
+        {
+            // Same clock as mtime; saved to this user's launch history
+            tool.lastLaunched = static_cast<int64_t>(
+                std::filesystem::file_time_type::clock::now().time_since_epoch().count());
+            historyDirty = true;
+            if (sortColumn == SortColumn::LastLaunched)
+                sortDirty = true;   // Re-sorted with the next view change, not under the cursor
+
+            if (viewMode == ViewMode::Details)
+            {
+                RECT row = GetToolScreenRect(index);
+                InvalidateRect(hwnd, &row, FALSE);
+            }
+        }
+
+        SetStatusText(status);
+    }
+}
+
+int ToolLauncher::GetToolAtPoint(POINT pt)
+{
+    // Rows scrolled under the header, search band or details column
+    // titles are hidden there
+    if (pt.y < GetContentTop())
+        return -1;
+
+    // Arithmetic on the layout, not a scan: constant cost per mouse event
+    return viewLayout.HitTest(pt.x + scrollX, pt.y + scrollY);
+}
@@ -1,190 +1,386 @@
-#include "ToolRenderer.h"
-#include <gdiplus.h>
-using namespace Gdiplus;
-
-// Constructor - stores the pointer to the ToolLauncher
-ToolRenderer::ToolRenderer(ToolLauncher* launcher) : toolLauncher(launcher) {}
-
-// Destructor
-ToolRenderer::~ToolRenderer() {}
-
-//////////////////////////////////////////////////////////////////////
-// Function : DrawHeader
-// Purpose  : Draws the window header with gradient background, title, and tool count
-//////////////////////////////////////////////////////////////////////
-void ToolRenderer::DrawHeader(HDC hdc, const RECT& clientRect, int toolCount) {
-    Graphics graphics(hdc);  // GDI+ graphics for advanced rendering
-
-    // Draw gradient background in header area
-    LinearGradientBrush gradientBrush(
-        Point(0, 0), Point(0, HEADER_HEIGHT),
-        Color(255, 255, 255, 255), Color(250, 249, 248, 255)
-    );
-    graphics.FillRectangle(&gradientBrush, 0, 0, clientRect.right, HEADER_HEIGHT);
-
-    // Set transparent background for text
-    SetBkMode(hdc, TRANSPARENT);
-    SetTextColor(hdc, win11_text);
-
-    // Create and select header font
-    HFONT headerFont = CreateFont(32, 0, 0, 0, FW_SEMIBOLD, FALSE, FALSE, FALSE,
-        DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
-        CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_SWISS, L"Segoe UI Variable");
-    HFONT oldFont = (HFONT)SelectObject(hdc, headerFont);
-
-    // Draw title text
-    std::wstring headerText = L"Tool Launcher";
-    RECT headerTextRect = { 30, 15, clientRect.right - 30, 50 };
-    DrawText(hdc, headerText.c_str(), -1, &headerTextRect, DT_LEFT | DT_VCENTER | DT_SINGLELINE);
-
-    // Set secondary text color and font
-    SetTextColor(hdc, win11_text_secondary);
-    HFONT subtitleFont = CreateFont(14, 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
-        DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
-        CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_SWISS, L"Segoe UI Variable Text");
-    SelectObject(hdc, subtitleFont);
-
-    // Draw subtitle (tool count)
-    std::wstring subtitleText = std::to_wstring(toolCount) + L" Tools available";
-    RECT subtitleRect = { 30, 50, clientRect.right - 30, HEADER_HEIGHT - 5 };
-    DrawText(hdc, subtitleText.c_str(), -1, &subtitleRect, DT_LEFT | DT_VCENTER | DT_SINGLELINE);
-
-    // Restore and delete fonts
-    SelectObject(hdc, oldFont);
-    DeleteObject(headerFont);
-    DeleteObject(subtitleFont);
-}
-
-//////////////////////////////////////////////////////////////////////
-// Function : DrawTool
-// Purpose  : Draws a tool card with icon and name
-//////////////////////////////////////////////////////////////////////
-void ToolRenderer::DrawTool(HDC hdc, const ToolInfo& tool, int index, bool isHovered) {
-    RECT rect = tool.rect;  // Get tool position
-
-    Graphics graphics(hdc);
-    graphics.SetSmoothingMode(SmoothingModeAntiAlias);
-    graphics.SetTextRenderingHint(TextRenderingHintClearTypeGridFit);
-
-    // Color setup based on hover state
-    Color fillColor = isHovered ? Color(246, 246, 246, 255) : Color(255, 255, 255, 255);
-    Color borderColor = isHovered ? Color(25, 102, 255) : Color(225, 223, 221, 255);
-
-    // Draw tool card shadow
-    SolidBrush shadowBrush(Color(20, 0, 0, 0));
-    FillRoundedRectangle(&graphics, &shadowBrush, rect.left + 2, rect.top + 2,
-        TOOL_BUTTON_SIZE, TOOL_BUTTON_SIZE, 8);
-
-    // Draw tool card fill and border
-    SolidBrush fillBrush(fillColor);
-    Pen borderPen(borderColor, 2.0f);
-    FillRoundedRectangle(&graphics, &fillBrush, rect.left, rect.top,
-        TOOL_BUTTON_SIZE, TOOL_BUTTON_SIZE, 8);
-    DrawRoundedRectangle(&graphics, &borderPen, rect.left, rect.top,
-        TOOL_BUTTON_SIZE - 1, TOOL_BUTTON_SIZE - 1, 8);
-
-    // Draw icon and name
-    DrawToolIcon(hdc, tool, rect);
-    DrawToolName(hdc, tool, rect);
-}
-
-//////////////////////////////////////////////////////////////////////
-// Function : DrawToolIcon
-// Purpose  : Draws icon or red placeholder if missing
-//////////////////////////////////////////////////////////////////////
-void ToolRenderer::DrawToolIcon(HDC hdc, const ToolInfo& tool, const RECT& rect) {
-    if (tool.icon) {
-        HDC memDC = CreateCompatibleDC(hdc);
-        HBITMAP oldBitmap = (HBITMAP)SelectObject(memDC, tool.icon);
-        int iconX = rect.left + (TOOL_BUTTON_SIZE - 64) / 2;
-        int iconY = rect.top + 15;
-        BitBlt(hdc, iconX, iconY, 64, 64, memDC, 0, 0, SRCCOPY);
-        SelectObject(memDC, oldBitmap);
-        DeleteDC(memDC);
-    }
-    else {
-        // Red box placeholder with label
-        HBRUSH redBrush = CreateSolidBrush(RGB(255, 0, 0));
-        RECT iconRect = { rect.left + (TOOL_BUTTON_SIZE - 64) / 2, rect.top + 15,
-                          rect.left + (TOOL_BUTTON_SIZE - 64) / 2 + 64, rect.top + 79 };
-        FillRect(hdc, &iconRect, redBrush);
-        DeleteObject(redBrush);
-
-        SetBkMode(hdc, TRANSPARENT);
-        SetTextColor(hdc, RGB(255, 255, 255));
-        DrawText(hdc, L"NO ICON", -1, &iconRect, DT_CENTER | DT_VCENTER | DT_SINGLELINE);
-    }
-}
-
-//////////////////////////////////////////////////////////////////////
-// Function : ConvertTopropercase
-// Purpose  : Changes string to Title Case
-//////////////////////////////////////////////////////////////////////
-void ToolRenderer::ConvertTopropercase(std::wstring& str) {
-    CharLowerBuffW(&str[0], str.length());
-    bool nextCap = true;
-    for (wchar_t& ch : str) {
-        if (iswspace(ch)) {
-            nextCap = true;
-        }
-        else if (nextCap && iswalpha(ch)) {
-            WCHAR temp[2] = { ch, L'\0' };
-            CharUpperBuffW(temp, 1);
-            ch = temp[0];
-            nextCap = false;
-        }
-    }
-}
-
-//////////////////////////////////////////////////////////////////////
-// Function : DrawToolName
-// Purpose  : Draws formatted tool name below icon
-//////////////////////////////////////////////////////////////////////
-void ToolRenderer::DrawToolName(HDC hdc, const ToolInfo& tool, const RECT& rect) {
-    SetBkMode(hdc, TRANSPARENT);
-    SetTextColor(hdc, RGB(102, 102, 153));
-
-    std::wstring name = tool.displayName;
-    std::replace(name.begin(), name.end(), L'_', L' ');
-    ConvertTopropercase(name);
-
-    HFONT nameFont = CreateFont(20, 0, 0, 0, FW_BOLD, FALSE, FALSE, FALSE,
-        DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
-        CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_SWISS, L"Segoe UI");
-    HFONT oldFont = (HFONT)SelectObject(hdc, nameFont);
-
-    RECT textRect = { rect.left + 10, rect.top + 85, rect.right - 10, rect.bottom - 15 };
-    DrawText(hdc, name.c_str(), -1, &textRect,
-        DT_CENTER | DT_WORDBREAK | DT_END_ELLIPSIS | DT_EDITCONTROL);
-
-    SelectObject(hdc, oldFont);
-    DeleteObject(nameFont);
-}
-
-//////////////////////////////////////////////////////////////////////
-// Function : FillRoundedRectangle
-// Purpose  : Fills rounded rectangle using GDI+ path
-//////////////////////////////////////////////////////////////////////
-void ToolRenderer::FillRoundedRectangle(Graphics* graphics, Brush* brush, INT x, INT y, INT w, INT h, INT r) {
-    GraphicsPath path;
-    path.AddArc(x, y, r * 2, r * 2, 180, 90);
-    path.AddArc(x + w - r * 2, y, r * 2, r * 2, 270, 90);
-    path.AddArc(x + w - r * 2, y + h - r * 2, r * 2, r * 2, 0, 90);
-    path.AddArc(x, y + h - r * 2, r * 2, r * 2, 90, 90);
-    path.CloseFigure();
-    graphics->FillPath(brush, &path);
-}
-
-//////////////////////////////////////////////////////////////////////
-// Function : DrawRoundedRectangle
-// Purpose  : Draws border of rounded rectangle using GDI+
-//////////////////////////////////////////////////////////////////////
-void ToolRenderer::DrawRoundedRectangle(Graphics* graphics, Pen* pen, INT x, INT y, INT w, INT h, INT r) {
-    GraphicsPath path;
-    path.AddArc(x, y, r * 2, r * 2, 180, 90);
-    path.AddArc(x + w - r * 2, y, r * 2, r * 2, 270, 90);
-    path.AddArc(x + w - r * 2, y + h - r * 2, r * 2, r * 2, 0, 90);
-    path.AddArc(x, y + h - r * 2, r * 2, r * 2, 90, 90);
-    path.CloseFigure();
-    graphics->DrawPath(pen, &path);
-}
+#include "ToolRenderer.h"
+#include "GdiRenderBackend.h"
+#include <gdiplus.h>
+#include <cwchar>      // swprintf for details cells
+using namespace Gdiplus;
+
+// Card sprites: the card plus its 2px shadow, tall enough for the label
+constexpr int CARD_BACKGROUND_SIZE = TOOL_BUTTON_SIZE + 2;
+constexpr int CARD_SPRITE_WIDTH = TOOL_BUTTON_SIZE + 2;
+constexpr int CARD_SPRITE_HEIGHT = TOOL_BUTTON_SIZE + 40;
+
+// Constructor - stores the pointer to the ToolLauncher
+ToolRenderer::ToolRenderer(ToolLauncher* launcher) : toolLauncher(launcher) {
+    backgroundSprites.SetSpriteSize(CARD_BACKGROUND_SIZE, CARD_BACKGROUND_SIZE);
+    cardSprites.SetSpriteSize(CARD_SPRITE_WIDTH, CARD_SPRITE_HEIGHT);
+}
+
+// Destructor
+ToolRenderer::~ToolRenderer() {}
+
+//////////////////////////////////////////////////////////////////////
+// Function : EnsureFonts / ResetResources
+// Purpose  : Fonts are created once, not per tool per paint. Resetting
+//            also moves to a new label epoch, so cached line breaks
+//            measured with the old fonts are redone lazily
+//////////////////////////////////////////////////////////////////////
+void ToolRenderer::EnsureFonts() {
+    if (rowFont)
+        return;
+
+    rowFont = GdiRenderBackend::GetFont(resources, RenderFont::Row);
+    detailFont = GdiRenderBackend::GetFont(resources, RenderFont::Detail);
+}
+
+void ToolRenderer::ResetResources() {
+    resources.Reset();
+    backgroundSprites.Clear();
+    cardSprites.Clear();
+    rowFont = detailFont = nullptr;
+
+    ++labelEpoch;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : EnsureLabel
+// Purpose  : Measures a grid label once per font epoch: one
+//            GetTextExtentExPoint call, then LabelLayout wraps it from
+//            the extents. Paints reuse the line breaks
+//////////////////////////////////////////////////////////////////////
+void ToolRenderer::EnsureLabel(HDC hdc, ToolInfo& tool) {
+    if (tool.label.epoch == labelEpoch)
+        return;
+
+    GdiRenderBackend backend(hdc, resources);
+    CardPainter::MeasureLabel(backend, tool.displayText.c_str(), tool.displayText.size(),
+        TOOL_BUTTON_SIZE, labelExtents, tool.label);
+    tool.label.epoch = labelEpoch;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : DrawHeader
+// Purpose  : Draws the window header with gradient background, title, and tool count
+//////////////////////////////////////////////////////////////////////
+void ToolRenderer::DrawHeader(HDC hdc, const RECT& clientRect, int toolCount) {
+    Graphics* graphics = resources.GetGraphics(hdc);  // GDI+ graphics for advanced rendering
+
+    // Draw gradient background in header area
+    LinearGradientBrush* gradientBrush = resources.GetVerticalGradient(HEADER_HEIGHT,
+        Color(255, 255, 255, 255), Color(250, 249, 248, 255));
+    graphics->FillRectangle(gradientBrush, 0, 0, clientRect.right, HEADER_HEIGHT);
+
+    // Set transparent background for text
+    SetBkMode(hdc, TRANSPARENT);
+    SetTextColor(hdc, win11_text);
+
+    // Select header font
+    HFONT oldFont = (HFONT)SelectObject(hdc, resources.GetFont(32, FW_SEMIBOLD, L"Segoe UI Variable"));
+
+    // Draw title text
+    std::wstring headerText = L"Tool Launcher";
+    RECT headerTextRect = { 30, 15, clientRect.right - 30, 50 };
+    DrawText(hdc, headerText.c_str(), -1, &headerTextRect, DT_LEFT | DT_VCENTER | DT_SINGLELINE);
+
+    // Set secondary text color and font
+    SetTextColor(hdc, win11_text_secondary);
+    SelectObject(hdc, resources.GetFont(14, FW_NORMAL, L"Segoe UI Variable Text"));
+
+    // Draw subtitle (tool count)
+    std::wstring subtitleText = std::to_wstring(toolCount) + L" Tools available";
+    RECT subtitleRect = { 30, 50, clientRect.right - 30, HEADER_HEIGHT - 5 };
+    DrawText(hdc, subtitleText.c_str(), -1, &subtitleRect, DT_LEFT | DT_VCENTER | DT_SINGLELINE);
+
+    // Restore font
+    SelectObject(hdc, oldFont);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : DrawTool
+// Purpose  : Draws a tool card with icon and name. The composed card
+//            is reused while its icon, label epoch and state are
+//            unchanged, so a steady-state paint is one BitBlt per card
+//////////////////////////////////////////////////////////////////////
+void ToolRenderer::DrawTool(HDC hdc, ToolInfo& tool, const RECT& rect, int index, CardState state) {
+    ScopedTimer timer(ProfileZone::DrawTool);
+    EnsureLabel(hdc, tool);   // No-op once measured
+    const CardSpriteKey key = { tool.icon, tool.label.epoch, static_cast<uint8_t>(state) };
+
+    CardSprite sprite;
+    if (!cardSprites.Find(tool.cardSprite, key, sprite)) {
+        tool.cardSprite = cardSprites.Allocate(key, sprite);
+        if (!tool.cardSprite) {
+            // No room for sprites: draw the card in place
+            RenderImage icon;
+            const bool hasIcon = GetIconImage(tool, icon);
+            GdiRenderBackend backend(hdc, resources, resources.GetGraphics(hdc));
+            CardPainter::PaintBackground(backend, rect.left, rect.top, TOOL_BUTTON_SIZE, state);
+            CardPainter::PaintIcon(backend, rect.left, rect.top, TOOL_BUTTON_SIZE, hasIcon ? &icon : nullptr);
+            CardPainter::PaintLabel(backend, rect.left, rect.top, TOOL_BUTTON_SIZE, tool.displayText.c_str(), tool.label);
+            return;
+        }
+        ComposeCard(sprite, tool, state);
+    }
+
+    BitBlt(hdc, rect.left, rect.top, CARD_SPRITE_WIDTH, CARD_SPRITE_HEIGHT,
+        sprite.dc, sprite.x, sprite.y, SRCCOPY);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : ComposeCard
+// Purpose  : Background sprite for the state, then icon and label, on
+//            the window background (cards never overlap each other)
+//////////////////////////////////////////////////////////////////////
+void ToolRenderer::ComposeCard(const CardSprite& sprite, const ToolInfo& tool, CardState state) {
+    RECT slot = { sprite.x, sprite.y, sprite.x + CARD_SPRITE_WIDTH, sprite.y + CARD_SPRITE_HEIGHT };
+    FillRect(sprite.dc, &slot, resources.GetBrush(win11_background));
+
+    GdiRenderBackend backend(sprite.dc, resources);
+
+    CardSprite background;
+    if (GetCardBackground(state, background)) {
+        BitBlt(sprite.dc, slot.left, slot.top, CARD_BACKGROUND_SIZE, CARD_BACKGROUND_SIZE,
+            background.dc, background.x, background.y, SRCCOPY);
+    }
+    else {
+        CardPainter::PaintBackground(backend, slot.left, slot.top, TOOL_BUTTON_SIZE, state);
+    }
+
+    RenderImage icon;
+    const bool hasIcon = GetIconImage(tool, icon);
+    CardPainter::PaintIcon(backend, slot.left, slot.top, TOOL_BUTTON_SIZE, hasIcon ? &icon : nullptr);
+    CardPainter::PaintLabel(backend, slot.left, slot.top, TOOL_BUTTON_SIZE, tool.displayText.c_str(), tool.label);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : GetCardBackground
+// Purpose  : Rasterizes each state's anti-aliased background once per
+//            resource reset, so composing a card needs no GDI+
+//////////////////////////////////////////////////////////////////////
+bool ToolRenderer::GetCardBackground(CardState state, CardSprite& sprite) {
+    const CardSpriteKey key = { 0, 0, static_cast<uint8_t>(state) };
+    uint64_t& ticket = backgroundTickets[static_cast<int>(state)];
+    if (backgroundSprites.Find(ticket, key, sprite))
+        return true;
+
+    ticket = backgroundSprites.Allocate(key, sprite);
+    if (!ticket)
+        return false;
+
+    RECT slot = { sprite.x, sprite.y, sprite.x + CARD_BACKGROUND_SIZE, sprite.y + CARD_BACKGROUND_SIZE };
+    FillRect(sprite.dc, &slot, resources.GetBrush(win11_background));
+
+    // Its own Graphics: the cached one stays on the back buffer
+    GdiRenderBackend backend(sprite.dc, resources);
+    CardPainter::PaintBackground(backend, sprite.x, sprite.y, TOOL_BUTTON_SIZE, state);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : GetDetailsColumns
+// Purpose  : Column c of a details row spans [edges[c], edges[c + 1]),
+//            with c = SortColumn - 1. Name and Folder share the width
+//            left over by the fixed columns
+//////////////////////////////////////////////////////////////////////
+void ToolRenderer::GetDetailsColumns(int left, int right, int (&edges)[DETAILS_COLUMN_COUNT + 1]) {
+    const int fixedWidths[] = { 80, 90, 140, 140 };   // Type, Size, Modified, Last launched
+    const int nameLeft = left + 8 + 20 + 12;          // After the row icon
+    const int flexible = (std::max)(0, right - nameLeft - (80 + 90 + 140 + 140));
+
+    edges[0] = nameLeft;
+    edges[1] = edges[0] + flexible * 2 / 5;
+    for (int i = 0; i < 4; ++i)
+        edges[i + 2] = edges[i + 1] + fixedWidths[i];
+    edges[DETAILS_COLUMN_COUNT] = (std::max)(edges[5], right);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : FormatSize / FormatTime
+// Purpose  : Details column text. Times are file_time_type ticks,
+//            which are FILETIME units on Windows
+//////////////////////////////////////////////////////////////////////
+static std::wstring FormatSize(uint64_t size) {
+    wchar_t buffer[32];
+    if (size < 1024)
+        swprintf(buffer, 32, L"%u B", static_cast<unsigned>(size));
+    else if (size < 1024 * 1024)
+        swprintf(buffer, 32, L"%.1f KB", size / 1024.0);
+    else
+        swprintf(buffer, 32, L"%.1f MB", size / (1024.0 * 1024.0));
+    return buffer;
+}
+
+static std::wstring FormatTime(int64_t ticks) {
+    if (ticks <= 0)
+        return L"";
+
+    FILETIME utc, local;
+    utc.dwLowDateTime = static_cast<DWORD>(ticks);
+    utc.dwHighDateTime = static_cast<DWORD>(ticks >> 32);
+
+    SYSTEMTIME time;
+    if (!FileTimeToLocalFileTime(&utc, &local) || !FileTimeToSystemTime(&local, &time))
+        return L"";
+
+    wchar_t buffer[32];
+    swprintf(buffer, 32, L"%04u-%02u-%02u %02u:%02u",
+        time.wYear, time.wMonth, time.wDay, time.wHour, time.wMinute);
+    return buffer;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : DrawDetailsHeader
+// Purpose  : Column titles of the details view; the sorted column
+//            shows its direction
+//////////////////////////////////////////////////////////////////////
+void ToolRenderer::DrawDetailsHeader(HDC hdc, const RECT& rect, SortColumn sortColumn, bool descending) {
+    static const wchar_t* const titles[DETAILS_COLUMN_COUNT] =
+        { L"Name", L"Type", L"Size", L"Modified", L"Last launched", L"Folder" };
+
+    EnsureFonts();
+    int edges[DETAILS_COLUMN_COUNT + 1];
+    GetDetailsColumns(rect.left, rect.right, edges);
+
+    SetBkMode(hdc, TRANSPARENT);
+    SetTextColor(hdc, win11_text_secondary);
+    HFONT oldFont = (HFONT)SelectObject(hdc, rowFont);
+
+    for (int i = 0; i < DETAILS_COLUMN_COUNT; ++i) {
+        std::wstring title = titles[i];
+        if (static_cast<int>(sortColumn) == i + 1)
+            title += descending ? L" \u25BC" : L" \u25B2";
+
+        RECT cell = { edges[i], rect.top, edges[i + 1] - 12, rect.bottom };
+        DrawText(hdc, title.c_str(), -1, &cell, DT_LEFT | DT_VCENTER | DT_SINGLELINE | DT_END_ELLIPSIS);
+    }
+
+    // Separator under the titles
+    HPEN oldPen = (HPEN)SelectObject(hdc, resources.GetPen(RGB(225, 223, 221), 1));
+    MoveToEx(hdc, rect.left, rect.bottom - 1, nullptr);
+    LineTo(hdc, rect.right, rect.bottom - 1);
+    SelectObject(hdc, oldPen);
+
+    SelectObject(hdc, oldFont);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : DrawToolRow
+// Purpose  : Draws a list row (card with icon, name and folder) or a
+//            details row (small icon, then one cell per column)
+//////////////////////////////////////////////////////////////////////
+void ToolRenderer::DrawToolRow(HDC hdc, const ToolInfo& tool, const RECT& rect, bool isHovered, bool details) {
+    EnsureFonts();
+    const int width = rect.right - rect.left;
+    const int height = rect.bottom - rect.top;
+
+    Graphics* graphics = resources.GetGraphics(hdc);
+
+    if (details) {
+        if (isHovered) {
+            FillRoundedRectangle(graphics, resources.GetSolidBrush(Color(255, 243, 242, 241)),
+                rect.left, rect.top, width, height, 4);
+        }
+    }
+    else {
+        Color fillColor = isHovered ? Color(246, 246, 246, 255) : Color(255, 255, 255, 255);
+        Color borderColor = isHovered ? Color(25, 102, 255) : Color(225, 223, 221, 255);
+
+        FillRoundedRectangle(graphics, resources.GetSolidBrush(fillColor), rect.left, rect.top, width, height, 6);
+        DrawRoundedRectangle(graphics, resources.GetSolidPen(borderColor, 1.0f),
+            rect.left, rect.top, width - 1, height - 1, 6);
+    }
+
+    const int iconSize = details ? 20 : 36;
+    DrawRowIcon(hdc, tool, rect.left + 8, rect.top + (height - iconSize) / 2, iconSize);
+
+    SetBkMode(hdc, TRANSPARENT);
+    HFONT oldFont = (HFONT)SelectObject(hdc, rowFont);
+    const int textLeft = rect.left + 8 + iconSize + 12;
+    const UINT singleLine = DT_LEFT | DT_VCENTER | DT_SINGLELINE | DT_END_ELLIPSIS | DT_NOPREFIX;
+
+    if (details) {
+        int edges[DETAILS_COLUMN_COUNT + 1];
+        GetDetailsColumns(rect.left, rect.right, edges);
+
+        RECT cell = { edges[0], rect.top, edges[1] - 12, rect.bottom };
+        SetTextColor(hdc, win11_text);
+        DrawText(hdc, tool.displayText.c_str(), -1, &cell, singleLine);
+
+        SelectObject(hdc, detailFont);
+        SetTextColor(hdc, win11_text_secondary);
+        const std::wstring cells[] = { tool.extension, FormatSize(tool.size),
+            FormatTime(tool.mtime), FormatTime(tool.lastLaunched) };
+        for (int i = 0; i < 4; ++i) {
+            cell = { edges[i + 1], rect.top, edges[i + 2] - 12, rect.bottom };
+            DrawText(hdc, cells[i].c_str(), -1, &cell, singleLine);
+        }
+
+        cell = { edges[5], rect.top, edges[6] - 8, rect.bottom };
+        DrawText(hdc, tool.folder.c_str(), -1, &cell, singleLine | DT_PATH_ELLIPSIS);
+    }
+    else {
+        RECT nameRect = { textLeft, rect.top + 4, rect.right - 12, rect.top + height / 2 + 2 };
+        SetTextColor(hdc, win11_text);
+        DrawText(hdc, tool.displayText.c_str(), -1, &nameRect, singleLine);
+
+        SelectObject(hdc, detailFont);
+        SetTextColor(hdc, win11_text_secondary);
+        RECT folderRect = { textLeft, rect.top + height / 2, rect.right - 12, rect.bottom - 4 };
+        DrawText(hdc, tool.folder.c_str(), -1, &folderRect, singleLine | DT_PATH_ELLIPSIS);
+    }
+
+    SelectObject(hdc, oldFont);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : DrawRowIcon
+// Purpose  : Scales the 64x64 tool icon down for row views
+//////////////////////////////////////////////////////////////////////
+void ToolRenderer::DrawRowIcon(HDC hdc, const ToolInfo& tool, int x, int y, int size) {
+    RenderImage icon;
+    if (GetIconImage(tool, icon)) {
+        HDC memDC = resources.GetMemoryDC();
+        HBITMAP oldBitmap = (HBITMAP)SelectObject(memDC, (HBITMAP)icon.native);
+        int oldMode = SetStretchBltMode(hdc, HALFTONE);
+        StretchBlt(hdc, x, y, size, size, memDC, icon.left, icon.top, icon.width, icon.height, SRCCOPY);
+        SetStretchBltMode(hdc, oldMode);
+        SelectObject(memDC, oldBitmap);
+    }
+    else {
+        RECT iconRect = { x, y, x + size, y + size };
+        FillRect(hdc, &iconRect, resources.GetBrush(RGB(255, 0, 0)));
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : GetIconImage
+// Purpose  : The tool's cell in the shared icon atlas
+//////////////////////////////////////////////////////////////////////
+bool ToolRenderer::GetIconImage(const ToolInfo& tool, RenderImage& image) {
+    HBITMAP atlas;
+    if (!toolLauncher->iconManager->GetIcon(tool.icon, atlas, image.left, image.top))
+        return false;
+
+    image.width = image.height = ToolIconManager::ICON_SIZE;
+    image.native = atlas;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : FillRoundedRectangle
+// Purpose  : Fills the cached rounded outline of this size, moved to (x, y)
+//////////////////////////////////////////////////////////////////////
+void ToolRenderer::FillRoundedRectangle(Graphics* graphics, Brush* brush, INT x, INT y, INT w, INT h, INT r) {
+    graphics->TranslateTransform(static_cast<REAL>(x), static_cast<REAL>(y));
+    graphics->FillPath(brush, resources.GetRoundedRect(w, h, r));
+    graphics->ResetTransform();
+}
+
+//////////////////////////////////////////////////////////////////////
+// Function : DrawRoundedRectangle
+// Purpose  : Draws the cached rounded outline of this size at (x, y)
+//////////////////////////////////////////////////////////////////////
+void ToolRenderer::DrawRoundedRectangle(Graphics* graphics, Pen* pen, INT x, INT y, INT w, INT h, INT r) {
+    graphics->TranslateTransform(static_cast<REAL>(x), static_cast<REAL>(y));
+    graphics->DrawPath(pen, resources.GetRoundedRect(w, h, r));
+    graphics->ResetTransform();
+}
@@ -1,68 +1,115 @@
-#pragma once
-
-// Include core definitions (ToolInfo, constants, etc.)
-#include "Main.h"
-
-// Include necessary Windows and GDI+ headers
-#include <windows.h>
-#include <gdiplus.h>  // GDI+ for advanced graphics (gradients, anti-aliasing)
-using namespace Gdiplus;
-
-// Forward declaration of the ToolLauncher class to avoid circular dependency
-class ToolLauncher;
-
-///////////////////////////////////////////////////////////////////////////////
-// Class: ToolRenderer
-// Purpose: Responsible for drawing tool launcher UI elements using GDI+
-//          This includes headers, tool buttons, icons, and labels.
-///////////////////////////////////////////////////////////////////////////////
-class ToolRenderer
-{
-public:
-    // Constructor: Requires a reference to ToolLauncher (for layout, state, etc.)
-    ToolRenderer(ToolLauncher* launcher);
-
-    // Destructor: Currently no dynamic cleanup needed
-    ~ToolRenderer();
-
-    ///////////////////////////////////////////////////////////////////////////
-    // Public Drawing Methods
-    ///////////////////////////////////////////////////////////////////////////
-
-    // Draws the top header (title + subtitle with tool count)
-    void DrawHeader(HDC hdc, const RECT& clientRect, int toolCount);
-
-    // Draws a single tool button (icon, name, and hover effect)
-    void DrawTool(HDC hdc, const ToolInfo& tool, int index, bool isHovered);
-
-private:
-    ToolLauncher* toolLauncher;  // Reference to parent window/controller
-
-    ///////////////////////////////////////////////////////////////////////////
-    // Private Helper Methods (Internally used by DrawTool and DrawHeader)
-    ///////////////////////////////////////////////////////////////////////////
-
-    // Draws the tool icon (bitmap) or fallback if missing
-    void DrawToolIcon(HDC hdc, const ToolInfo& tool, const RECT& rect);
-
-    // Converts a string to Proper Case (title format)
-    void ConvertTopropercase(std::wstring& str);
-
-    // Draws the tool name below the icon (handles wrapping and formatting)
-    void DrawToolName(HDC hdc, const ToolInfo& tool, const RECT& rect);
-
-    // [Optional] Draws a badge showing file extension like ".EXE" in corner
-    void DrawExtensionBadge(HDC hdc, const ToolInfo& tool, const RECT& rect);
-
-    ///////////////////////////////////////////////////////////////////////////
-    // Rounded Rectangle Drawing Helpers (GDI+ based)
-    ///////////////////////////////////////////////////////////////////////////
-
-    // Draws and fills a rectangle with rounded corners
-    void FillRoundedRectangle(Graphics* graphics, Brush* brush,
-        INT x, INT y, INT width, INT height, INT radius);
-
-    // Draws a border around a rounded rectangle
-    void DrawRoundedRectangle(Graphics* graphics, Pen* pen,
-        INT x, INT y, INT width, INT height, INT radius);
-};
+#pragma once
+
+// Include core definitions (ToolInfo, constants, etc.)
+#include "Main.h"
+
+// Include necessary Windows and GDI+ headers
+#include <windows.h>
+#include <gdiplus.h>  // GDI+ for advanced graphics (gradients, anti-aliasing)
+#include "RenderResources.h"
+#include "CardSpriteCache.h"
+#include "CardPainter.h"       // Card drawing shared with the software backend
+using namespace Gdiplus;
+
+// Forward declaration of the ToolLauncher class to avoid circular dependency
+class ToolLauncher;
+
+///////////////////////////////////////////////////////////////////////////////
+// Class: ToolRenderer
+// Purpose: Responsible for drawing tool launcher UI elements using GDI+
+//          This includes headers, tool buttons, icons, and labels.
+//          Every GDI/GDI+ object comes from `resources`; drawing a card
+//          creates nothing. Grid cards are composed once into sprites
+//          (state background + icon + label) and then only blitted; the
+//          card itself is drawn by CardPainter through a GdiRenderBackend.
+///////////////////////////////////////////////////////////////////////////////
+class ToolRenderer
+{
+public:
+    // Constructor: Requires a reference to ToolLauncher (for layout, state, etc.)
+    ToolRenderer(ToolLauncher* launcher);
+
+    // Destructor: Resources are released with `resources`
+    ~ToolRenderer();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Public Drawing Methods
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Draws the top header (title + subtitle with tool count)
+    void DrawHeader(HDC hdc, const RECT& clientRect, int toolCount);
+
+    // Draws a single tool button (icon, name, and hover/pressed effect);
+    // a blit of the tool's composed sprite unless it went stale
+    void DrawTool(HDC hdc, ToolInfo& tool, const RECT& rect, int index, CardState state);
+
+    // Draws one row of the list or details view
+    void DrawToolRow(HDC hdc, const ToolInfo& tool, const RECT& rect, bool isHovered, bool details);
+
+    // Draws the column titles of the details view
+    void DrawDetailsHeader(HDC hdc, const RECT& rect, SortColumn sortColumn, bool descending);
+
+    // Column boundaries of a details row spanning [left, right)
+    static constexpr int DETAILS_COLUMN_COUNT = 6;
+    static void GetDetailsColumns(int left, int right, int (&edges)[DETAILS_COLUMN_COUNT + 1]);
+
+    // Measures the grid label unless it is current for the selected fonts
+    void EnsureLabel(HDC hdc, ToolInfo& tool);
+
+    // Drops every cached object and sprite after a theme, font or DPI
+    // change; every label is measured and every card composed again on
+    // its next paint
+    void ResetResources();
+
+    // Shared object cache (also used for the window chrome)
+    RenderResources& GetResources() { return resources; }
+
+private:
+    ToolLauncher* toolLauncher;  // Reference to parent window/controller
+
+    RenderResources resources;
+
+    // Looked up in `resources` on first use after a reset
+    HFONT rowFont = nullptr;      // List and details names
+    HFONT detailFont = nullptr;   // Secondary columns
+    uint32_t labelEpoch = 1;      // Bumped by ResetResources; ToolInfo::label keeps the one it was measured with
+    std::vector<int> labelExtents;  // Scratch for EnsureLabel
+
+    // Grid card sprites: one background per CardState, one composed card per tool
+    CardSpriteCache backgroundSprites;
+    CardSpriteCache cardSprites;
+    uint64_t backgroundTickets[3] = {};
+
+    void EnsureFonts();
+
+    // Pre-rendered card background (shadow, fill, border) for a state
+    bool GetCardBackground(CardState state, CardSprite& sprite);
+
+    // Renders a tool's card into its sprite slot
+    void ComposeCard(const CardSprite& sprite, const ToolInfo& tool, CardState state);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Private Helper Methods (Internally used by DrawTool and DrawHeader)
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Draws a small scaled icon for list and details rows
+    void DrawRowIcon(HDC hdc, const ToolInfo& tool, int x, int y, int size);
+
+    // Where the tool's icon sits in the shared atlas; false without one
+    bool GetIconImage(const ToolInfo& tool, RenderImage& image);
+
+    // [Optional] Draws a badge showing file extension like ".EXE" in corner
+    void DrawExtensionBadge(HDC hdc, const ToolInfo& tool, const RECT& rect);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Rounded Rectangle Drawing Helpers (GDI+ based)
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Draws and fills a rectangle with rounded corners
+    void FillRoundedRectangle(Graphics* graphics, Brush* brush,
+        INT x, INT y, INT width, INT height, INT radius);
+
+    // Draws a border around a rounded rectangle
+    void DrawRoundedRectangle(Graphics* graphics, Pen* pen,
+        INT x, INT y, INT width, INT height, INT radius);
+};
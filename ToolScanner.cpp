@@ -1,108 +1,717 @@
-#include "ToolScanner.h"
-#include "ToolIconManager.h"
-#include <unordered_set>
-
-//////////////////////////////////////////////////////////////////////
-// Constructor: Initialize with icon manager
-//////////////////////////////////////////////////////////////////////
-ToolScanner::ToolScanner(ToolIconManager* iconMgr) : iconManager(iconMgr) {}
-
-//////////////////////////////////////////////////////////////////////
-// Destructor
-//////////////////////////////////////////////////////////////////////
-ToolScanner::~ToolScanner() {}
-
-//////////////////////////////////////////////////////////////////////
-// ScanForTools: Scans all files in current folder, filters by extension
-//////////////////////////////////////////////////////////////////////
-std::vector<ToolInfo> ToolScanner::ScanForTools() {
-    std::vector<ToolInfo> foundTools;
-    foundTools.reserve(64); // Preallocate memory for better performance
-
-    // File types we care about
-    static const std::unordered_set<std::wstring> supportedExtensions = {
-        L".bat", L".py", L".exe", L".ps1"
-    };
-
-    // Search all files in the current directory
-    WIN32_FIND_DATA findData;
-    HANDLE hFind = FindFirstFile(L"*.*", &findData);
-
-    if (hFind != INVALID_HANDLE_VALUE) {
-        do {
-            // Skip folders
-            if (!(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
-                std::wstring filename = findData.cFileName;
-
-                // Find file extension
-                size_t dotPos = filename.find_last_of(L'.');
-                if (dotPos != std::wstring::npos) {
-                    std::wstring ext = filename.substr(dotPos);
-                    if (supportedExtensions.count(ext)) {
-                        foundTools.emplace_back(CreateToolInfo(filename, ext));
-                    }
-                }
-            }
-        } while (FindNextFile(hFind, &findData));
-
-        FindClose(hFind);
-    }
-
-    return foundTools;
-}
-
-//////////////////////////////////////////////////////////////////////
-// CreateToolInfo: Generates ToolInfo from file name and extension
-//////////////////////////////////////////////////////////////////////
-ToolInfo ToolScanner::CreateToolInfo(const std::wstring& filename, const std::wstring& extension) {
-    ToolInfo tool;
-    tool.filename = filename;
-    tool.extension = extension;
-
-    // Extract display name (remove extension)
-    size_t dotPos = filename.find_last_of(L'.');
-    tool.displayName = (dotPos != std::wstring::npos) ? filename.substr(0, dotPos) : filename;
-
-    // Create icon for tool
-    if (iconManager) {
-        tool.icon = iconManager->CreateToolIcon(extension, tool.displayName);
-    }
-
-    return tool;
-}
-
-//////////////////////////////////////////////////////////////////////
-// FilterTools: Case-insensitive filter by displayName
-//////////////////////////////////////////////////////////////////////
-std::vector<ToolInfo> ToolScanner::FilterTools(const std::vector<ToolInfo>& allTools, const std::wstring& searchText) {
-    if (searchText.empty())
-        return allTools;
-
-    std::vector<ToolInfo> filtered;
-    filtered.reserve(allTools.size());
-
-    std::wstring lowerSearch = ToLower(searchText);
-
-    for (const auto& tool : allTools) {
-        std::wstring name = ToLower(tool.displayName);
-        if (name.find(lowerSearch) != std::wstring::npos) {
-            filtered.push_back(tool);
-        }
-    }
-
-    return filtered;
-}
-
-//////////////////////////////////////////////////////////////////////
-// ToLower: Converts a string to lowercase
-//////////////////////////////////////////////////////////////////////
-std::wstring ToolScanner::ToLower(const std::wstring& str) {
-    std::wstring result;
-    result.resize(str.size());
-
-    // Faster than transform with lambda for wide strings
-    for (size_t i = 0; i < str.size(); ++i)
-        result[i] = towlower(str[i]);
-
-    return result;
-}
+﻿#include "ToolScanner.h"
+#include "ToolIconManager.h"
+#include "TextNormalizer.h"
+#include <unordered_set>
+
+//////////////////////////////////////////////////////////////////////
+// Constructor: Initialize with icon manager and default scan options
+//////////////////////////////////////////////////////////////////////
+ToolScanner::ToolScanner(ToolIconManager* iconMgr) : iconManager(iconMgr) {
+    // File types we care about (lowercase, matched case-insensitively)
+    walkOptions.extensions = { L".bat", L".py", L".exe", L".ps1" };
+
+    // Default root is the working directory, as before
+    wchar_t currentDir[MAX_PATH];
+    DWORD length = GetCurrentDirectory(MAX_PATH, currentDir);
+    if (length > 0 && length < MAX_PATH)
+        walkOptions.roots.push_back(currentDir);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Destructor
+//////////////////////////////////////////////////////////////////////
+ToolScanner::~ToolScanner() {
+    CancelAsyncScan();
+}
+
+//////////////////////////////////////////////////////////////////////
+// SetRoots / SetMaxDepth: Scan configuration
+//////////////////////////////////////////////////////////////////////
+void ToolScanner::SetRoots(const std::vector<std::wstring>& roots) {
+    walkOptions.roots = roots;
+}
+
+void ToolScanner::SetMaxDepth(int depth) {
+    walkOptions.maxDepth = max(0, depth);
+}
+
+//////////////////////////////////////////////////////////////////////
+// LoadOptionsFromEnvironment: Optional overrides, e.g.
+//   TOOL_LAUNCHER_ROOTS=S:\Review comments;Z:\cee\CF\PMD\src
+//   TOOL_LAUNCHER_DEPTH=4
+//////////////////////////////////////////////////////////////////////
+void ToolScanner::LoadOptionsFromEnvironment() {
+    wchar_t buffer[4096];
+
+    DWORD length = GetEnvironmentVariable(L"TOOL_LAUNCHER_ROOTS", buffer, 4096);
+    if (length > 0 && length < 4096) {
+        std::vector<std::wstring> roots;
+        std::wstring list = buffer;
+        size_t start = 0;
+
+        while (start <= list.size()) {
+            size_t end = list.find(L';', start);
+            if (end == std::wstring::npos)
+                end = list.size();
+
+            std::wstring root = list.substr(start, end - start);
+            if (!root.empty())
+                roots.push_back(root);
+
+            start = end + 1;
+        }
+
+        if (!roots.empty())
+            SetRoots(roots);
+    }
+
+    length = GetEnvironmentVariable(L"TOOL_LAUNCHER_DEPTH", buffer, 4096);
+    if (length > 0 && length < 4096) {
+        SetMaxDepth(_wtoi(buffer));
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// ScanForTools: Walks every root in parallel, then builds ToolInfo
+//////////////////////////////////////////////////////////////////////
+std::vector<ToolInfo> ToolScanner::ScanForTools() {
+    DirectoryWalker walker(walkOptions);
+    std::vector<WalkedFile> files = walker.Walk();
+
+    std::vector<ToolInfo> foundTools;
+    foundTools.reserve(files.size()); // Exact size known after the walk
+
+    for (const auto& file : files) {
+        foundTools.emplace_back(CreateToolInfo(file));
+    }
+
+    return foundTools;
+}
+
+//////////////////////////////////////////////////////////////////////
+// StartAsyncScan: Walks on a background thread; icons are created on
+//                 the walker threads so the UI thread only merges
+//////////////////////////////////////////////////////////////////////
+void ToolScanner::StartAsyncScan(ToolBatchCallback onBatch, ScanDoneCallback onDone) {
+    RunOnScanThread([this, onBatch](DirectoryWalker& walker) {
+        walker.Walk([this, &onBatch](std::vector<WalkedFile>&& files) {
+            std::vector<ToolInfo> batch;
+            batch.reserve(files.size());
+            for (const auto& file : files)
+                batch.emplace_back(CreateToolInfo(file));
+            onBatch(std::move(batch));
+        });
+    }, onDone);
+}
+
+//////////////////////////////////////////////////////////////////////
+// RunOnScanThread: Shared thread/cancel plumbing of the async walks
+//////////////////////////////////////////////////////////////////////
+void ToolScanner::RunOnScanThread(std::function<void(DirectoryWalker&)> work, ScanDoneCallback onDone) {
+    CancelAsyncScan();
+    cancelRequested = false;
+    scanning = true;
+
+    scanThread = std::thread([this, work, onDone]() {
+        DirectoryWalker walker(walkOptions);
+        {
+            std::lock_guard<std::mutex> guard(walkerLock);
+            activeWalker = &walker;
+            if (cancelRequested)
+                walker.Cancel();
+        }
+
+        work(walker);
+
+        {
+            std::lock_guard<std::mutex> guard(walkerLock);
+            activeWalker = nullptr;
+        }
+
+        scanning = false;
+        if (onDone)
+            onDone(cancelRequested.load());
+    });
+}
+
+//////////////////////////////////////////////////////////////////////
+// CancelAsyncScan: Safe to call when no scan is running
+//////////////////////////////////////////////////////////////////////
+void ToolScanner::CancelAsyncScan() {
+    {
+        std::lock_guard<std::mutex> guard(walkerLock);
+        cancelRequested = true;
+        if (activeWalker)
+            activeWalker->Cancel();
+    }
+
+    if (scanThread.joinable())
+        scanThread.join();
+}
+
+//////////////////////////////////////////////////////////////////////
+// StartAsyncRescan: The walk, the diff against a size/mtime snapshot
+//                   and the icons of new files all stay off the UI thread
+//////////////////////////////////////////////////////////////////////
+void ToolScanner::StartAsyncRescan(const std::vector<ToolInfo>& tools,
+    RescanCallback onResult, ScanDoneCallback onDone) {
+    struct SnapshotEntry {
+        std::wstring path;
+        uint64_t size;
+        int64_t mtime;
+    };
+
+    // Copied on the UI thread; the catalog itself may change meanwhile
+    auto snapshot = std::make_shared<std::vector<SnapshotEntry>>();
+    snapshot->reserve(tools.size());
+    for (const auto& tool : tools)
+        snapshot->push_back({ tool.filename, tool.size, tool.mtime });
+
+    auto result = std::make_shared<RescanResult>();
+
+    auto finish = [result, onResult, onDone](bool cancelled) {
+        if (!cancelled)
+            onResult(std::move(*result));
+        if (onDone)
+            onDone(cancelled);
+    };
+
+    RunOnScanThread([this, snapshot, result](DirectoryWalker& walker) {
+        result->files = walker.Walk();
+        if (cancelRequested)
+            return;
+
+        // Both sides are sorted by path: one merge pass
+        auto known = snapshot->begin();
+        for (const auto& file : result->files) {
+            while (known != snapshot->end() && known->path < file.path)
+                ++known;
+
+            const bool unchanged = known != snapshot->end() && known->path == file.path &&
+                known->size == file.size && known->mtime == file.mtime;
+            if (!unchanged)
+                result->created.emplace_back(CreateToolInfo(file));
+        }
+    }, finish);
+}
+
+//////////////////////////////////////////////////////////////////////
+// MergeRescan: Merge pass over the sorted catalog, the sorted walk and
+//              the prepared entries. The catalog may have changed since
+//              the snapshot, so a file can still lack a prepared entry
+//              (made here) or have one it does not need (released)
+//////////////////////////////////////////////////////////////////////
+RescanStats ToolScanner::MergeRescan(std::vector<ToolInfo>& tools, RescanResult& result) {
+    RescanStats stats;
+
+    auto releaseIcon = [this](ToolInfo& tool) {
+        if (iconManager)
+            iconManager->ReleaseIcon(tool.icon);
+        tool.icon = 0;
+    };
+
+    std::vector<ToolInfo> refreshed;
+    refreshed.reserve(result.files.size());
+
+    auto known = tools.begin();
+    auto fresh = result.created.begin();
+
+    for (const auto& file : result.files) {
+        for (; known != tools.end() && known->filename < file.path; ++known) {
+            releaseIcon(*known);
+            ++stats.removed;
+        }
+        for (; fresh != result.created.end() && fresh->filename < file.path; ++fresh)
+            releaseIcon(*fresh);
+
+        ToolInfo* prepared = nullptr;
+        if (fresh != result.created.end() && fresh->filename == file.path)
+            prepared = &*fresh++;
+
+        if (known == tools.end() || known->filename != file.path) {
+            refreshed.emplace_back(prepared ? std::move(*prepared) : CreateToolInfo(file, false));
+            ++stats.added;
+            continue;
+        }
+
+        ToolInfo& existing = *known++;
+        if (existing.size != file.size || existing.mtime != file.mtime) {
+            existing.size = file.size;
+            existing.mtime = file.mtime;
+            ++stats.updated;
+
+            // A rebuilt executable may carry another icon (same icon, same slot)
+            if (prepared && prepared->icon != existing.icon) {
+                std::swap(existing.icon, prepared->icon);
+                existing.cardSprite = 0;
+            }
+            if (prepared)
+                existing.iconRequests = 0;   // Read after them: newer than what is due
+        }
+        else {
+            ++stats.unchanged;
+        }
+
+        if (prepared)
+            releaseIcon(*prepared);
+        refreshed.emplace_back(std::move(existing));
+    }
+
+    for (; known != tools.end(); ++known) {
+        releaseIcon(*known);
+        ++stats.removed;
+    }
+    for (; fresh != result.created.end(); ++fresh)
+        releaseIcon(*fresh);
+
+    result.created.clear();
+    tools = std::move(refreshed);
+    return stats;
+}
+
+//////////////////////////////////////////////////////////////////////
+// GetCachePath: The cache sits next to the tools it describes
+//////////////////////////////////////////////////////////////////////
+std::wstring ToolScanner::GetCachePath() const {
+    if (walkOptions.roots.empty() || walkOptions.roots.front().empty())
+        return std::wstring();
+
+    std::wstring path = walkOptions.roots.front();
+    if (path.back() != L'\\' && path.back() != L'/')
+        path += L'\\';
+    return path + L"ToolCatalog.bin";
+}
+
+//////////////////////////////////////////////////////////////////////
+// LoadCatalogCache: No directory access at all - only the mapped file
+//////////////////////////////////////////////////////////////////////
+bool ToolScanner::LoadCatalogCache(std::vector<ToolInfo>& tools) {
+    CatalogCache cache;
+    if (!cache.Open(GetCachePath()))
+        return false;
+
+    const size_t count = cache.GetEntryCount();
+    tools.clear();
+    tools.reserve(count);
+
+    CatalogRecord record;
+    for (size_t i = 0; i < count; ++i) {
+        if (!cache.ReadRecord(i, record))
+            continue;
+
+        // The extension is stored normalized; the file name keeps its case
+        if (record.fileName.size() < record.extension.size())
+            continue;
+
+        ToolInfo tool;
+        tool.folder = std::move(record.folder);
+        tool.displayName = record.fileName.substr(0, record.fileName.size() - record.extension.size());
+        tool.extension = std::move(record.extension);
+        tool.searchKey = std::move(record.searchKey);
+        tool.displayText = TextNormalizer::ToDisplayText(tool.displayName);
+        tool.category = static_cast<ToolCategory>(record.category);
+        tool.size = record.size;
+        tool.mtime = record.mtime;
+
+        tool.filename = tool.folder;
+        if (!tool.filename.empty() && tool.filename.back() != L'\\' && tool.filename.back() != L'/')
+            tool.filename += L'\\';
+        tool.filename += record.fileName;
+
+        tools.push_back(std::move(tool));
+    }
+
+    // Relative folders may resolve differently here; restore the invariant
+    auto byFilename = [](const ToolInfo& a, const ToolInfo& b) { return a.filename < b.filename; };
+    if (!std::is_sorted(tools.begin(), tools.end(), byFilename))
+        std::sort(tools.begin(), tools.end(), byFilename);
+
+    return !tools.empty();
+}
+
+//////////////////////////////////////////////////////////////////////
+// SaveCatalogCache: Snapshot of everything but the icons. The file may
+//                   be shared, so per-user launch times stay out of it.
+//////////////////////////////////////////////////////////////////////
+bool ToolScanner::SaveCatalogCache(const std::vector<ToolInfo>& tools) {
+    std::wstring path = GetCachePath();
+    if (path.empty())
+        return false;
+
+    std::vector<CatalogRecord> records;
+    records.reserve(tools.size());
+
+    for (const auto& tool : tools) {
+        CatalogRecord record;
+        record.folder = tool.folder;
+        record.fileName = tool.filename.substr(tool.filename.find_last_of(L"\\/") + 1);
+        record.extension = tool.extension;
+        record.searchKey = tool.searchKey;
+        record.size = tool.size;
+        record.mtime = tool.mtime;
+        record.category = static_cast<uint8_t>(tool.category);
+        records.push_back(std::move(record));
+    }
+
+    return CatalogCache::Write(path, records);
+}
+
+//////////////////////////////////////////////////////////////////////
+// EnsureIcon: Cached tools get their icon when first drawn. That is
+//             during WM_PAINT, so no file is read here
+//////////////////////////////////////////////////////////////////////
+void ToolScanner::EnsureIcon(ToolInfo& tool) {
+    if (!tool.icon && iconManager)
+        RequestIcon(tool);
+}
+
+//////////////////////////////////////////////////////////////////////
+// RequestIcon: Caller has released the tool's previous icon
+//////////////////////////////////////////////////////////////////////
+void ToolScanner::RequestIcon(ToolInfo& tool) {
+    tool.icon = iconManager->AcquireSymbolIcon(tool.extension);
+    if (iconManager->RequestFileIcon(tool.extension, tool.filename))
+        ++tool.iconRequests;
+}
+
+//////////////////////////////////////////////////////////////////////
+// FindTool: Binary search in a catalog sorted by filename
+//////////////////////////////////////////////////////////////////////
+static std::vector<ToolInfo>::iterator LowerBoundTool(std::vector<ToolInfo>& tools, const std::wstring& path) {
+    return std::lower_bound(tools.begin(), tools.end(), path,
+        [](const ToolInfo& tool, const std::wstring& key) { return tool.filename < key; });
+}
+
+static std::vector<ToolInfo>::iterator FindTool(std::vector<ToolInfo>& tools, const std::wstring& path) {
+    auto it = LowerBoundTool(tools, path);
+    return (it != tools.end() && it->filename == path) ? it : tools.end();
+}
+
+//////////////////////////////////////////////////////////////////////
+// ApplyFileIcons: Icons arrive in request order, so the last one due
+//                 is of the newest file. A tool that was removed,
+//                 renamed or rescanned meanwhile has nothing due.
+//////////////////////////////////////////////////////////////////////
+bool ToolScanner::ApplyFileIcons(std::vector<ToolInfo>& tools, std::vector<FileIcon>& icons) {
+    bool changed = false;
+    for (FileIcon& icon : icons) {
+        auto it = FindTool(tools, icon.path);
+        if (it != tools.end() && it->iconRequests) {
+            --it->iconRequests;
+            if (icon.slot && icon.slot != it->icon) {
+                std::swap(it->icon, icon.slot);
+                it->cardSprite = 0;
+                changed = true;
+            }
+        }
+        if (iconManager)
+            iconManager->ReleaseIcon(icon.slot);
+    }
+    icons.clear();
+    return changed;
+}
+
+//////////////////////////////////////////////////////////////////////
+// GetHistoryPath: One history file per user and catalog, named after
+//                 a hash of the catalog's cache path
+//////////////////////////////////////////////////////////////////////
+std::wstring ToolScanner::GetHistoryPath() const {
+    const std::wstring cachePath = TextNormalizer::ToLower(GetCachePath());
+    if (cachePath.empty())
+        return std::wstring();
+
+    PWSTR localAppData = nullptr;
+    if (FAILED(SHGetKnownFolderPath(FOLDERID_LocalAppData, 0, nullptr, &localAppData)))
+        return std::wstring();
+    std::wstring path = localAppData;
+    CoTaskMemFree(localAppData);
+
+    uint64_t hash = 14695981039346656037ull;   // FNV-1a
+    for (wchar_t ch : cachePath) {
+        hash ^= static_cast<uint16_t>(ch);
+        hash *= 1099511628211ull;
+    }
+
+    wchar_t name[64];
+    swprintf(name, 64, L"\\ToolLauncher\\History_%016llx.bin", static_cast<unsigned long long>(hash));
+    return path + name;
+}
+
+//////////////////////////////////////////////////////////////////////
+// LoadLaunchHistory: Same file format as the catalog cache, holding
+//                    only launched tools. A tool launched since the
+//                    catalog was loaded keeps the newer time.
+//////////////////////////////////////////////////////////////////////
+bool ToolScanner::LoadLaunchHistory(std::vector<ToolInfo>& tools) {
+    CatalogCache history;
+    if (!history.Open(GetHistoryPath()))
+        return false;
+
+    bool applied = false;
+    CatalogRecord record;
+    for (size_t i = 0; i < history.GetEntryCount(); ++i) {
+        if (!history.ReadRecord(i, record))
+            continue;
+
+        std::wstring path = record.folder;
+        if (!path.empty() && path.back() != L'\\' && path.back() != L'/')
+            path += L'\\';
+        path += record.fileName;
+
+        auto it = FindTool(tools, path);
+        if (it != tools.end() && it->lastLaunched < record.lastLaunched) {
+            it->lastLaunched = record.lastLaunched;
+            applied = true;
+        }
+    }
+    return applied;
+}
+
+//////////////////////////////////////////////////////////////////////
+// SaveLaunchHistory: Rewrites this user's history from the catalog
+//////////////////////////////////////////////////////////////////////
+bool ToolScanner::SaveLaunchHistory(const std::vector<ToolInfo>& tools) {
+    const std::wstring path = GetHistoryPath();
+    if (path.empty())
+        return false;
+
+    std::vector<CatalogRecord> records;
+    for (const auto& tool : tools) {
+        if (!tool.lastLaunched)
+            continue;
+
+        CatalogRecord record;
+        record.folder = tool.folder;
+        record.fileName = tool.filename.substr(tool.filename.find_last_of(L"\\/") + 1);
+        record.extension = tool.extension;
+        record.lastLaunched = tool.lastLaunched;
+        record.category = static_cast<uint8_t>(tool.category);
+        records.push_back(std::move(record));
+    }
+
+    const std::wstring folder = path.substr(0, path.find_last_of(L'\\'));
+    if (!CreateDirectory(folder.c_str(), nullptr) && GetLastError() != ERROR_ALREADY_EXISTS)
+        return false;
+    return CatalogCache::Write(path, records);
+}
+
+//////////////////////////////////////////////////////////////////////
+// ApplyDeltas: Patches the catalog in place from a watcher batch
+//////////////////////////////////////////////////////////////////////
+DeltaResult ToolScanner::ApplyDeltas(std::vector<ToolInfo>& tools, const std::vector<CatalogDelta>& deltas) {
+    DeltaResult result;
+
+    // An overflowed batch is handled by a single background rescan instead
+    for (const auto& delta : deltas) {
+        if (delta.kind == CatalogDelta::Kind::Rescan) {
+            result.needsRescan = true;
+            return result;
+        }
+    }
+
+    std::unordered_set<std::wstring> removedFolders;
+
+    for (const auto& delta : deltas) {
+        switch (delta.kind) {
+        case CatalogDelta::Kind::Added:
+        case CatalogDelta::Kind::Modified:
+            UpsertTool(tools, delta.path, result);
+            break;
+
+        case CatalogDelta::Kind::Removed:
+            // Not a known tool: it may have been a folder full of tools
+            if (!RemoveTool(tools, delta.path))
+                removedFolders.insert(delta.path);
+            break;
+
+        case CatalogDelta::Kind::Renamed:
+        {
+            auto it = FindTool(tools, delta.oldPath);
+            WalkedFile file;
+
+            if (it == tools.end() || !DirectoryWalker::StatFile(delta.path, file) || !IsInScanScope(file)) {
+                RemoveTool(tools, delta.oldPath);
+                UpsertTool(tools, delta.path, result);
+                break;
+            }
+
+            // Keep the existing entry (and its icon when the type is unchanged)
+            ToolInfo tool = std::move(*it);
+            tools.erase(it);
+
+            // Icons still due are for the old path: ask again for the new one
+            const bool newIcon = tool.icon && iconManager &&
+                (tool.extension != file.extension || tool.iconRequests);
+            if (newIcon)
+                iconManager->ReleaseIcon(tool.icon);
+
+            tool.filename = file.path;
+            tool.folder = file.folder;
+            tool.displayName = file.name;
+            tool.extension = file.extension;
+            if (newIcon) {
+                tool.iconRequests = 0;
+                RequestIcon(tool);
+            }
+            TextNormalizer::MakeKeys(file.name, tool.searchKey, tool.displayText);
+            tool.label.epoch = 0;   // New text: measure again
+            tool.cardSprite = 0;    // ...and compose the card again
+            tool.category = CategoryFromExtension(file.extension);
+            tool.size = file.size;
+            tool.mtime = file.mtime;
+
+            RemoveTool(tools, file.path);   // Rename may overwrite a tool
+            tools.insert(LowerBoundTool(tools, file.path), std::move(tool));
+            result.changedPaths.push_back(file.path);
+            break;
+        }
+
+        case CatalogDelta::Kind::Rescan:
+            break;
+        }
+    }
+
+    // Drop every tool that lived below a removed folder. Partitioned, not
+    // remove_if'd: the dropped entries must stay intact to release their icons
+    if (!removedFolders.empty()) {
+        auto gone = std::stable_partition(tools.begin(), tools.end(), [&](const ToolInfo& tool) {
+            std::wstring folder = tool.folder;
+            for (;;) {
+                if (removedFolders.count(folder))
+                    return false;
+                size_t slash = folder.find_last_of(L"\\/");
+                if (slash == std::wstring::npos)
+                    return true;
+                folder.resize(slash);
+            }
+        });
+
+        if (iconManager) {
+            for (auto it = gone; it != tools.end(); ++it)
+                iconManager->ReleaseIcon(it->icon);
+        }
+        tools.erase(gone, tools.end());
+    }
+
+    return result;
+}
+
+//////////////////////////////////////////////////////////////////////
+// UpsertTool: Stat one file and add/update/remove its catalog entry
+//////////////////////////////////////////////////////////////////////
+void ToolScanner::UpsertTool(std::vector<ToolInfo>& tools, const std::wstring& path, DeltaResult& result) {
+    WalkedFile file;
+    if (!DirectoryWalker::StatFile(path, file) || !IsInScanScope(file)) {
+        RemoveTool(tools, path);
+        return;
+    }
+
+    auto it = LowerBoundTool(tools, file.path);
+    if (it != tools.end() && it->filename == file.path) {
+        // A rebuilt executable may carry another icon; the current one
+        // stays until the icon thread has read the new file
+        if (it->icon && iconManager && (it->size != file.size || it->mtime != file.mtime) &&
+            iconManager->RequestFileIcon(it->extension, it->filename))
+            ++it->iconRequests;
+        it->size = file.size;
+        it->mtime = file.mtime;
+    }
+    else {
+        tools.insert(it, CreateToolInfo(file, false));
+    }
+    result.changedPaths.push_back(file.path);
+}
+
+//////////////////////////////////////////////////////////////////////
+// RemoveTool: Erase one entry and release its icon
+//////////////////////////////////////////////////////////////////////
+bool ToolScanner::RemoveTool(std::vector<ToolInfo>& tools, const std::wstring& path) {
+    auto it = FindTool(tools, path);
+    if (it == tools.end())
+        return false;
+
+    if (iconManager)
+        iconManager->ReleaseIcon(it->icon);
+    tools.erase(it);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// IsInScanScope: Same rules the walker applies during a full scan
+//////////////////////////////////////////////////////////////////////
+bool ToolScanner::IsInScanScope(const WalkedFile& file) const {
+    const auto& exts = walkOptions.extensions;
+    if (std::find(exts.begin(), exts.end(), file.extension) == exts.end())
+        return false;
+
+    for (const auto& root : walkOptions.roots) {
+        if (root.empty() || file.folder.compare(0, root.size(), root) != 0)
+            continue;
+
+        const bool rootHasSlash = root.back() == L'\\' || root.back() == L'/';
+        if (!rootHasSlash && file.folder.size() > root.size() &&
+            file.folder[root.size()] != L'\\' && file.folder[root.size()] != L'/')
+            continue;   // "C:\tools2" is not below "C:\tools"
+
+        // Count folder levels between the root and the file
+        int depth = 0;
+        bool inSegment = false;
+        for (size_t i = root.size(); i < file.folder.size(); ++i) {
+            bool separator = file.folder[i] == L'\\' || file.folder[i] == L'/';
+            if (!separator && !inSegment)
+                ++depth;
+            inSegment = !separator;
+        }
+        return depth <= walkOptions.maxDepth;
+    }
+    return false;
+}
+
+//////////////////////////////////////////////////////////////////////
+// CreateToolInfo: Generates ToolInfo from a walked file
+//////////////////////////////////////////////////////////////////////
+ToolInfo ToolScanner::CreateToolInfo(const WalkedFile& file, bool decodeIcon) {
+    ToolInfo tool;
+    tool.filename = file.path;
+    tool.folder = file.folder;
+    tool.extension = file.extension;
+    tool.size = file.size;
+    tool.mtime = file.mtime;
+
+    // Display name is the file name without extension
+    tool.displayName = file.name;
+    TextNormalizer::MakeKeys(file.name, tool.searchKey, tool.displayText);
+    tool.category = CategoryFromExtension(file.extension);
+
+    // Its own icon for an executable, else the one of its file type
+    if (iconManager) {
+        if (decodeIcon)
+            tool.icon = iconManager->AcquireIcon(tool.extension, tool.filename);
+        else
+            RequestIcon(tool);
+    }
+
+    return tool;
+}
+
+//////////////////////////////////////////////////////////////////////
+// MakeSearchKey: Computed once per file instead of once per keystroke
+//////////////////////////////////////////////////////////////////////
+std::wstring ToolScanner::MakeSearchKey(const std::wstring& displayName) {
+    return TextNormalizer::ToSearchKey(displayName);
+}
+
+//////////////////////////////////////////////////////////////////////
+// CategoryFromExtension: Extensions are already lowercase
+//////////////////////////////////////////////////////////////////////
+ToolCategory ToolScanner::CategoryFromExtension(const std::wstring& extension) {
+    if (extension == L".bat" || extension == L".cmd")
+        return ToolCategory::Batch;
+    if (extension == L".py")
+        return ToolCategory::Python;
+    if (extension == L".exe")
+        return ToolCategory::Executable;
+    if (extension == L".ps1")
+        return ToolCategory::PowerShell;
+    return ToolCategory::Other;
+}
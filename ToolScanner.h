@@ -1,42 +1,176 @@
-#pragma once
-
-#include "Main.h"              // Includes definitions like ToolInfo struct/class
-#include <vector>              // Used for storing list of tools
-#include <string>              // For using std::wstring (wide string support)
-#include <unordered_set>       // Faster extension matching than multiple scan calls
-
-// Forward declaration to avoid including full header
-class ToolIconManager;
-
-////////////////////////////////////////////////////////////////////////
-// Class: ToolScanner
-// Purpose: Responsible for scanning current directory for tools
-//          like .exe, .bat, .py files and preparing display info.
-////////////////////////////////////////////////////////////////////////
-class ToolScanner {
-public:
-    // Constructor - needs icon manager to assign icons to tools
-    ToolScanner(ToolIconManager* iconMgr);
-
-    // Destructor - no dynamic memory to clean here, safe default
-    ~ToolScanner();
-
-    // Main function to scan directory for tool files (.exe, .bat, etc.)
-    std::vector<ToolInfo> ScanForTools();
-
-    // Filters tool list based on search text (e.g., user typing in search box)
-    std::vector<ToolInfo> FilterTools(const std::vector<ToolInfo>& allTools, const std::wstring& searchText);
-
-private:
-    ToolIconManager* iconManager;  // Used to assign icons to discovered tools
-
-    // Old method: scans a single file type using pattern like *.exe
-    // (Not used in optimized version, but can be retained if fallback is needed)
-    void ScanForFileType(std::vector<ToolInfo>& tools, const std::wstring& pattern, const std::wstring& extension);
-
-    // Converts a file into ToolInfo (display name, extension, icon, etc.)
-    ToolInfo CreateToolInfo(const std::wstring& filename, const std::wstring& extension);
-
-    // Converts wide string to all lowercase (used for search matching)
-    std::wstring ToLower(const std::wstring& str);
-};
+#pragma once
+
+#include "Main.h"              // Includes definitions like ToolInfo struct/class
+#include <vector>              // Used for storing list of tools
+#include <string>              // For using std::wstring (wide string support)
+#include <unordered_set>       // Faster extension matching than multiple scan calls
+#include <atomic>              // Background scan state
+#include <functional>          // Async scan callbacks
+#include <mutex>               // Guards the active walker pointer
+#include <thread>              // Background scan thread
+#include "DirectoryWalker.h"   // Parallel multi-root traversal core (portable)
+#include "CatalogCache.h"      // Memory-mapped catalog snapshot (portable)
+#include "ToolWatcher.h"       // CatalogDelta batches from the change watcher
+
+// Forward declaration to avoid including full header
+class ToolIconManager;
+
+////////////////////////////////////////////////////////////////////////
+// Struct: RescanStats
+// Purpose: Summary of what an incremental rescan changed
+////////////////////////////////////////////////////////////////////////
+struct RescanStats {
+    size_t added = 0;       // New files, ToolInfo created, icon shared
+    size_t updated = 0;     // Size or mtime changed, icon and name reused
+    size_t removed = 0;     // Files gone, icon released
+    size_t unchanged = 0;   // Kept as-is
+
+    bool HasChanges() const { return added || updated || removed; }
+};
+
+////////////////////////////////////////////////////////////////////////
+// Struct: RescanResult
+// Purpose: A background rescan, ready for MergeRescan on the UI thread.
+//          Files that are new or changed since the snapshot already have
+//          their ToolInfo (and icon), made on the scan thread.
+////////////////////////////////////////////////////////////////////////
+struct RescanResult {
+    std::vector<WalkedFile> files;   // Everything the walk found, sorted by path
+    std::vector<ToolInfo> created;   // New or changed files, sorted by filename
+};
+
+////////////////////////////////////////////////////////////////////////
+// Struct: DeltaResult
+// Purpose: Which catalog entries a watcher batch added or changed, so
+//          the launcher can match just those against the search
+//          (entries that left need no list: see ToolLauncher::PatchView)
+////////////////////////////////////////////////////////////////////////
+struct DeltaResult {
+    std::vector<std::wstring> changedPaths;   // Entries that were added or updated
+    bool needsRescan = false;                 // Batch overflowed; nothing was applied
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: ToolScanner
+// Purpose: Responsible for scanning the configured root folders for
+//          tools like .exe, .bat, .py files and preparing display info.
+////////////////////////////////////////////////////////////////////////
+class ToolScanner {
+public:
+    // Async scan callbacks run on background threads
+    using ToolBatchCallback = std::function<void(std::vector<ToolInfo>&& batch)>;
+    using ScanDoneCallback = std::function<void(bool cancelled)>;
+    using RescanCallback = std::function<void(RescanResult&& result)>;
+
+    // Constructor - needs icon manager to assign icons to tools
+    ToolScanner(ToolIconManager* iconMgr);
+
+    // Destructor - cancels and joins a running background scan
+    ~ToolScanner();
+
+    // Main function to scan all roots for tool files (.exe, .bat, etc.)
+    std::vector<ToolInfo> ScanForTools();
+
+    // Scans on a background thread. Batches (icons already assigned) are
+    // delivered from walker threads as soon as folders are listed, then
+    // onDone runs once every batch has been delivered.
+    void StartAsyncScan(ToolBatchCallback onBatch, ScanDoneCallback onDone);
+
+    // Stops a running background scan and waits for its thread
+    void CancelAsyncScan();
+
+    // True while a background scan is running
+    bool IsScanning() const { return scanning.load(); }
+
+    // Re-walks the roots on the background thread and diffs against the
+    // size/mtime snapshot held in each ToolInfo. onResult runs right
+    // before onDone (once IsScanning() is false), unless cancelled.
+    void StartAsyncRescan(const std::vector<ToolInfo>& tools, RescanCallback onResult, ScanDoneCallback onDone);
+
+    // Makes the catalog match a rescan. Only new, changed or deleted
+    // entries are touched; everything else (icon, display name) is moved
+    // over untouched. Cheap enough for the UI thread: no file access.
+    RescanStats MergeRescan(std::vector<ToolInfo>& tools, RescanResult& result);
+
+    // Maps the catalog cache of the first root into a catalog sorted by
+    // filename. Every record is copied into a ToolInfo up front, since the
+    // view, search and sort all work on the vector; what the cache saves
+    // is the walk, the stat calls and the search keys. Icons are not
+    // created here - see EnsureIcon.
+    bool LoadCatalogCache(std::vector<ToolInfo>& tools);
+
+    // Writes the catalog to the cache file (next to the first root's tools)
+    bool SaveCatalogCache(const std::vector<ToolInfo>& tools);
+
+    // Cache file location: <first root>\ToolCatalog.bin
+    std::wstring GetCachePath() const;
+
+    // Sets lastLaunched from this user's launch history; true if any changed
+    bool LoadLaunchHistory(std::vector<ToolInfo>& tools);
+
+    // Writes every tool's lastLaunched to this user's history file
+    bool SaveLaunchHistory(const std::vector<ToolInfo>& tools);
+
+    // History location: %LOCALAPPDATA%\ToolLauncher\History_<cache path hash>.bin
+    std::wstring GetHistoryPath() const;
+
+    // Assigns the icon of a tool that came from the cache: its symbol
+    // now, an executable's own icon once the icon thread has read it
+    void EnsureIcon(ToolInfo& tool);
+
+    // Swaps in icons from ToolIconManager::TakeFileIcons where a request
+    // is still due; releases the rest. True if any tool's icon changed.
+    bool ApplyFileIcons(std::vector<ToolInfo>& tools, std::vector<FileIcon>& icons);
+
+    // Applies watcher deltas to a catalog kept sorted by filename.
+    // UI thread: executables' icons are requested, not read
+    DeltaResult ApplyDeltas(std::vector<ToolInfo>& tools, const std::vector<CatalogDelta>& deltas);
+
+    // Current roots, depth and extensions (used to start the watcher)
+    const WalkOptions& GetWalkOptions() const { return walkOptions; }
+
+    // Replaces the list of root folders to scan (default: current directory)
+    void SetRoots(const std::vector<std::wstring>& roots);
+
+    // Sets how many subfolder levels below each root are scanned
+    void SetMaxDepth(int depth);
+
+    // Reads TOOL_LAUNCHER_ROOTS (';'-separated) and TOOL_LAUNCHER_DEPTH
+    void LoadOptionsFromEnvironment();
+
+    // Lowercase name with '_' as ' ' - the text search matches against
+    static std::wstring MakeSearchKey(const std::wstring& displayName);
+
+    // Maps a lowercase extension to its category
+    static ToolCategory CategoryFromExtension(const std::wstring& extension);
+
+private:
+    ToolIconManager* iconManager;  // Used to assign icons to discovered tools
+    WalkOptions walkOptions;       // Roots, depth and extensions for DirectoryWalker
+
+    // Background scan state
+    std::thread scanThread;
+    std::mutex walkerLock;
+    DirectoryWalker* activeWalker = nullptr;
+    std::atomic<bool> scanning{ false };
+    std::atomic<bool> cancelRequested{ false };
+
+    // Starts scanThread with a walker registered for CancelAsyncScan
+    void RunOnScanThread(std::function<void(DirectoryWalker&)> work, ScanDoneCallback onDone);
+
+    // Inserts or refreshes one file; drops it if it left the scan scope
+    void UpsertTool(std::vector<ToolInfo>& tools, const std::wstring& path, DeltaResult& result);
+
+    // Removes one file; returns false if it was not in the catalog
+    bool RemoveTool(std::vector<ToolInfo>& tools, const std::wstring& path);
+
+    // True if the file has a tool extension and sits within maxDepth of a root
+    bool IsInScanScope(const WalkedFile& file) const;
+
+    // Converts a walked file into ToolInfo (display name, extension, icon, etc.)
+    // On the UI thread pass decodeIcon = false: the icon is requested instead
+    ToolInfo CreateToolInfo(const WalkedFile& file, bool decodeIcon = true);
+
+    // Symbol icon now, the executable's own icon from the icon thread
+    void RequestIcon(ToolInfo& tool);
+};
@@ -0,0 +1,499 @@
+#include "ToolWatcher.h"
+#include "DirectoryWalker.h"
+#include <algorithm>
+#include <filesystem>
+#include <unordered_set>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+//////////////////////////////////////////////////////////////////////
+// DeltaCoalescer::Touch: Records the pre-batch state on first sight
+//////////////////////////////////////////////////////////////////////
+DeltaCoalescer::Record& DeltaCoalescer::Touch(const std::wstring& path, bool existed) {
+    auto result = records.try_emplace(path);
+    Record& record = result.first->second;
+
+    if (result.second) {
+        record.existedBefore = existed;
+        record.existsNow = existed;
+        order.push_back(path);
+    }
+    return record;
+}
+
+void DeltaCoalescer::Added(const std::wstring& path) {
+    Record& record = Touch(path, false);
+    if (record.existedBefore)
+        record.modified = true;   // Deleted and recreated = changed
+    record.existsNow = true;
+}
+
+void DeltaCoalescer::Removed(const std::wstring& path) {
+    Record& record = Touch(path, true);
+    record.existsNow = false;
+    record.renamedFrom.clear();
+}
+
+void DeltaCoalescer::Modified(const std::wstring& path) {
+    Record& record = Touch(path, true);
+    record.existsNow = true;
+    record.modified = true;
+}
+
+void DeltaCoalescer::Renamed(const std::wstring& oldPath, const std::wstring& newPath) {
+    // Follow rename chains (a -> b -> c) back to the pre-batch name
+    std::wstring origin;
+    {
+        Record& source = Touch(oldPath, true);
+        if (!source.renamedFrom.empty())
+            origin = source.renamedFrom;
+        else if (source.existedBefore)
+            origin = oldPath;
+
+        source.existsNow = false;
+        source.renamedFrom.clear();
+    }
+
+    Record& target = Touch(newPath, false);
+    if (target.existedBefore)
+        target.modified = true;   // Rename replaced an existing file
+    target.existsNow = true;
+    target.renamedFrom = origin;
+}
+
+void DeltaCoalescer::Overflow() {
+    overflow = true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// DeltaCoalescer::Drain: Emits the net change per path
+//////////////////////////////////////////////////////////////////////
+std::vector<CatalogDelta> DeltaCoalescer::Drain() {
+    std::vector<CatalogDelta> deltas;
+
+    if (overflow) {
+        // Individual events are meaningless once some were lost
+        deltas.push_back({ CatalogDelta::Kind::Rescan, std::wstring(), std::wstring() });
+    }
+    else {
+        std::unordered_set<std::wstring> consumed;
+
+        for (const auto& path : order) {
+            const Record& record = records[path];
+
+            if (!record.existedBefore && record.existsNow) {
+                if (!record.renamedFrom.empty()) {
+                    const Record& source = records[record.renamedFrom];
+                    if (source.existedBefore && !source.existsNow &&
+                        consumed.insert(record.renamedFrom).second) {
+                        deltas.push_back({ CatalogDelta::Kind::Renamed, path, record.renamedFrom });
+                        continue;
+                    }
+                }
+                deltas.push_back({ CatalogDelta::Kind::Added, path, std::wstring() });
+            }
+            else if (record.existedBefore && record.existsNow && record.modified) {
+                deltas.push_back({ CatalogDelta::Kind::Modified, path, std::wstring() });
+            }
+        }
+
+        for (const auto& path : order) {
+            const Record& record = records[path];
+            if (record.existedBefore && !record.existsNow && !consumed.count(path))
+                deltas.push_back({ CatalogDelta::Kind::Removed, path, std::wstring() });
+        }
+    }
+
+    records.clear();
+    order.clear();
+    overflow = false;
+    return deltas;
+}
+
+//////////////////////////////////////////////////////////////////////
+// ToolWatcher: Constructor / Destructor
+//////////////////////////////////////////////////////////////////////
+ToolWatcher::ToolWatcher() {}
+
+ToolWatcher::~ToolWatcher() {
+    Stop();
+}
+
+void ToolWatcher::SetTiming(std::chrono::milliseconds quiet, std::chrono::milliseconds latency) {
+    std::lock_guard<std::mutex> guard(lock);
+    quietPeriod = quiet;
+    maxLatency = latency;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Start: One reader per root; roots that do not exist are skipped
+//////////////////////////////////////////////////////////////////////
+bool ToolWatcher::Start(const std::vector<std::wstring>& roots,
+    const std::vector<std::wstring>& exts, DeltaCallback callback) {
+    Stop();
+
+    extensions = exts;
+    onDeltas = std::move(callback);
+    running = true;
+
+#ifdef _WIN32
+    stopEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+#endif
+
+    for (const auto& root : roots) {
+        std::error_code ec;
+        if (!root.empty() && fs::is_directory(root, ec))
+            readers.emplace_back(&ToolWatcher::ReadLoop, this, root);
+    }
+
+    if (readers.empty()) {
+        Stop();
+        return false;
+    }
+
+    flusher = std::thread(&ToolWatcher::FlushLoop, this);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// Stop: Signals readers, wakes the flusher and joins everything
+//////////////////////////////////////////////////////////////////////
+void ToolWatcher::Stop() {
+    {
+        // Taken so the flusher cannot miss the wake-up below
+        std::lock_guard<std::mutex> guard(lock);
+        running = false;
+    }
+
+#ifdef _WIN32
+    if (stopEvent)
+        SetEvent(static_cast<HANDLE>(stopEvent));
+#endif
+
+    wake.notify_all();
+
+    for (auto& reader : readers) {
+        if (reader.joinable())
+            reader.join();
+    }
+    readers.clear();
+
+    if (flusher.joinable())
+        flusher.join();
+
+#ifdef _WIN32
+    if (stopEvent) {
+        CloseHandle(static_cast<HANDLE>(stopEvent));
+        stopEvent = nullptr;
+    }
+#endif
+
+    std::lock_guard<std::mutex> guard(lock);
+    coalescer.Drain();
+}
+
+//////////////////////////////////////////////////////////////////////
+// FlushLoop: Delivers a batch after a quiet period or max latency
+//////////////////////////////////////////////////////////////////////
+void ToolWatcher::FlushLoop() {
+    std::unique_lock<std::mutex> guard(lock);
+
+    while (running) {
+        if (coalescer.Empty()) {
+            wake.wait(guard);
+            continue;
+        }
+
+        const Clock::time_point now = Clock::now();
+        const Clock::time_point quietDeadline = lastEvent + quietPeriod;
+        const Clock::time_point latencyDeadline = firstEvent + maxLatency;
+        const Clock::time_point deadline = (std::min)(quietDeadline, latencyDeadline);
+
+        if (now < deadline) {
+            wake.wait_until(guard, deadline);
+            continue;
+        }
+
+        std::vector<CatalogDelta> batch = coalescer.Drain();
+
+        // Never hold the lock while the callback runs
+        guard.unlock();
+        if (!batch.empty() && onDeltas)
+            onDeltas(std::move(batch));
+        guard.lock();
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// Report: Drops non-tool files early; new folders force a rescan
+//         because their contents never produce individual events
+//////////////////////////////////////////////////////////////////////
+void ToolWatcher::Report(CatalogDelta::Kind kind, const std::wstring& path, const std::wstring& oldPath) {
+    std::error_code ec;
+    const bool isTool = IsToolFile(path);
+
+    std::lock_guard<std::mutex> guard(lock);
+    const bool wasEmpty = coalescer.Empty();
+
+    switch (kind) {
+    case CatalogDelta::Kind::Added:
+        if (isTool)
+            coalescer.Added(path);
+        else if (fs::is_directory(path, ec))
+            coalescer.Overflow();
+        else
+            return;
+        break;
+
+    case CatalogDelta::Kind::Modified:
+        if (!isTool)
+            return;
+        coalescer.Modified(path);
+        break;
+
+    case CatalogDelta::Kind::Removed:
+        // Could be a folder - the catalog drops everything below it
+        coalescer.Removed(path);
+        break;
+
+    case CatalogDelta::Kind::Renamed:
+        if (IsToolFile(oldPath) && isTool)
+            coalescer.Renamed(oldPath, path);
+        else if (isTool)
+            coalescer.Added(path);
+        else if (fs::is_directory(path, ec))
+            coalescer.Overflow();
+        else
+            coalescer.Removed(oldPath);
+        break;
+
+    case CatalogDelta::Kind::Rescan:
+        coalescer.Overflow();
+        break;
+    }
+
+    lastEvent = Clock::now();
+    if (wasEmpty) {
+        firstEvent = lastEvent;
+        wake.notify_one();
+    }
+}
+
+bool ToolWatcher::IsToolFile(const std::wstring& path) const {
+    size_t dot = path.find_last_of(L'.');
+    size_t slash = path.find_last_of(L"\\/");
+    if (dot == std::wstring::npos || (slash != std::wstring::npos && dot < slash))
+        return false;
+
+    std::wstring ext = DirectoryWalker::NormalizeExtension(path.substr(dot));
+    return std::find(extensions.begin(), extensions.end(), ext) != extensions.end();
+}
+
+#ifdef _WIN32
+
+//////////////////////////////////////////////////////////////////////
+// ReadLoop (Windows): Overlapped ReadDirectoryChangesW on the subtree
+//////////////////////////////////////////////////////////////////////
+void ToolWatcher::ReadLoop(std::wstring root) {
+    HANDLE directory = CreateFileW(root.c_str(), FILE_LIST_DIRECTORY,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+        OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+    if (directory == INVALID_HANDLE_VALUE)
+        return;
+
+    if (!root.empty() && root.back() != L'\\' && root.back() != L'/')
+        root += L'\\';
+
+    const DWORD notifyFilter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME |
+        FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE;
+
+    // DWORD-aligned buffer; 64 KB is the limit for network shares
+    std::vector<DWORD> buffer(64 * 1024 / sizeof(DWORD));
+    OVERLAPPED overlapped = {};
+    overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    HANDLE waits[2] = { overlapped.hEvent, static_cast<HANDLE>(stopEvent) };
+    std::wstring renameOldPath;
+
+    while (running) {
+        ResetEvent(overlapped.hEvent);
+        if (!ReadDirectoryChangesW(directory, buffer.data(),
+            static_cast<DWORD>(buffer.size() * sizeof(DWORD)), TRUE,
+            notifyFilter, nullptr, &overlapped, nullptr)) {
+            break;
+        }
+
+        DWORD signaled = WaitForMultipleObjects(2, waits, FALSE, INFINITE);
+        DWORD transferred = 0;
+
+        if (signaled != WAIT_OBJECT_0) {
+            CancelIoEx(directory, &overlapped);
+            GetOverlappedResult(directory, &overlapped, &transferred, TRUE);
+            break;
+        }
+
+        if (!GetOverlappedResult(directory, &overlapped, &transferred, FALSE)) {
+            if (GetLastError() != ERROR_NOTIFY_ENUM_DIR)
+                break;
+            transferred = 0;
+        }
+
+        // Zero bytes means the kernel buffer overflowed
+        if (transferred == 0) {
+            Report(CatalogDelta::Kind::Rescan, std::wstring());
+            continue;
+        }
+
+        const BYTE* cursor = reinterpret_cast<const BYTE*>(buffer.data());
+        for (;;) {
+            const FILE_NOTIFY_INFORMATION* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(cursor);
+            std::wstring path = root + std::wstring(info->FileName, info->FileNameLength / sizeof(WCHAR));
+
+            switch (info->Action) {
+            case FILE_ACTION_ADDED:
+                Report(CatalogDelta::Kind::Added, path);
+                break;
+            case FILE_ACTION_REMOVED:
+                Report(CatalogDelta::Kind::Removed, path);
+                break;
+            case FILE_ACTION_MODIFIED:
+                Report(CatalogDelta::Kind::Modified, path);
+                break;
+            case FILE_ACTION_RENAMED_OLD_NAME:
+                renameOldPath = path;
+                break;
+            case FILE_ACTION_RENAMED_NEW_NAME:
+                Report(CatalogDelta::Kind::Renamed, path, renameOldPath);
+                renameOldPath.clear();
+                break;
+            }
+
+            if (info->NextEntryOffset == 0)
+                break;
+            cursor += info->NextEntryOffset;
+        }
+    }
+
+    CloseHandle(overlapped.hEvent);
+    CloseHandle(directory);
+}
+
+#else
+
+//////////////////////////////////////////////////////////////////////
+// AddWatchTree (Linux): inotify is not recursive - watch every folder
+//////////////////////////////////////////////////////////////////////
+static void AddWatchTree(int fd, const std::wstring& root, std::unordered_map<int, std::wstring>& watches) {
+    const uint32_t mask = IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MODIFY |
+        IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF;
+
+    std::error_code ec;
+    int wd = inotify_add_watch(fd, fs::path(root).string().c_str(), mask);
+    if (wd >= 0)
+        watches[wd] = root;
+
+    fs::recursive_directory_iterator it(root, fs::directory_options::skip_permission_denied, ec);
+    for (; !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+        if (it->is_symlink(ec)) {
+            it.disable_recursion_pending();
+            continue;
+        }
+        if (!it->is_directory(ec))
+            continue;
+
+        wd = inotify_add_watch(fd, it->path().string().c_str(), mask);
+        if (wd >= 0)
+            watches[wd] = it->path().wstring();
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// ReadLoop (Linux): inotify backend, used to test the watcher off Windows
+//////////////////////////////////////////////////////////////////////
+void ToolWatcher::ReadLoop(std::wstring root) {
+    int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0)
+        return;
+
+    std::unordered_map<int, std::wstring> watches;
+    AddWatchTree(fd, root, watches);
+
+    alignas(inotify_event) char buffer[64 * 1024];
+    std::unordered_map<uint32_t, std::wstring> pendingMoves;   // cookie -> old path
+
+    while (running) {
+        pollfd pfd = { fd, POLLIN, 0 };
+        if (poll(&pfd, 1, 100) <= 0)
+            continue;
+
+        ssize_t length = read(fd, buffer, sizeof(buffer));
+        if (length <= 0)
+            continue;
+
+        for (char* cursor = buffer; cursor < buffer + length;) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(cursor);
+            cursor += sizeof(inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                Report(CatalogDelta::Kind::Rescan, std::wstring());
+                continue;
+            }
+            if (event->mask & IN_IGNORED) {
+                watches.erase(event->wd);
+                continue;
+            }
+
+            auto watch = watches.find(event->wd);
+            if (watch == watches.end() || event->len == 0)
+                continue;
+
+            std::wstring path = watch->second + L"/" + fs::path(event->name).wstring();
+
+            if (event->mask & IN_ISDIR) {
+                if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                    AddWatchTree(fd, path, watches);
+                    Report(CatalogDelta::Kind::Rescan, path);
+                }
+                else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                    Report(CatalogDelta::Kind::Removed, path);
+                }
+                continue;
+            }
+
+            if (event->mask & IN_CREATE)
+                Report(CatalogDelta::Kind::Added, path);
+            else if (event->mask & IN_DELETE)
+                Report(CatalogDelta::Kind::Removed, path);
+            else if (event->mask & (IN_MODIFY | IN_CLOSE_WRITE))
+                Report(CatalogDelta::Kind::Modified, path);
+            else if (event->mask & IN_MOVED_FROM)
+                pendingMoves[event->cookie] = path;
+            else if (event->mask & IN_MOVED_TO) {
+                auto move = pendingMoves.find(event->cookie);
+                if (move != pendingMoves.end()) {
+                    Report(CatalogDelta::Kind::Renamed, path, move->second);
+                    pendingMoves.erase(move);
+                }
+                else {
+                    Report(CatalogDelta::Kind::Added, path);
+                }
+            }
+        }
+
+        // A move without a partner left the watched tree
+        for (const auto& move : pendingMoves)
+            Report(CatalogDelta::Kind::Removed, move.second);
+        pendingMoves.clear();
+    }
+
+    close(fd);
+}
+
+#endif
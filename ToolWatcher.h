@@ -0,0 +1,126 @@
+#pragma once
+
+#include <atomic>              // Running flag shared with reader threads
+#include <chrono>              // Debounce timing
+#include <condition_variable>  // Wakes the flush thread
+#include <functional>          // Delta callback
+#include <mutex>               // Guards the coalescer
+#include <string>              // std::wstring paths
+#include <thread>              // Reader + flush threads
+#include <unordered_map>       // Per-path coalescing records
+#include <vector>              // Batches
+
+////////////////////////////////////////////////////////////////////////
+// Struct: CatalogDelta
+// Purpose: One coalesced change to the tool catalog
+////////////////////////////////////////////////////////////////////////
+struct CatalogDelta {
+    enum class Kind {
+        Added,      // New file (or a file that was created and modified)
+        Removed,    // File or folder disappeared
+        Modified,   // Existing file changed size or timestamp
+        Renamed,    // oldPath was renamed/moved to path
+        Rescan      // Too many/unknown changes - do one incremental rescan
+    };
+
+    Kind kind = Kind::Modified;
+    std::wstring path;
+    std::wstring oldPath;   // Renamed only
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: DeltaCoalescer
+// Purpose: Folds a burst of raw notifications into the net change per
+//          path. A file that is created, written 200 times and renamed
+//          ends up as a single Added; create + delete cancels out.
+//          Not thread safe - ToolWatcher guards it with its own mutex.
+////////////////////////////////////////////////////////////////////////
+class DeltaCoalescer {
+public:
+    void Added(const std::wstring& path);
+    void Removed(const std::wstring& path);
+    void Modified(const std::wstring& path);
+    void Renamed(const std::wstring& oldPath, const std::wstring& newPath);
+    void Overflow();
+
+    bool Empty() const { return order.empty() && !overflow; }
+
+    // Returns the net deltas (renames/adds first, removals last) and resets
+    std::vector<CatalogDelta> Drain();
+
+private:
+    struct Record {
+        bool existedBefore = false;   // State before the first event of the batch
+        bool existsNow = false;       // State after the latest event
+        bool modified = false;        // Content changed while it existed
+        std::wstring renamedFrom;     // Pre-batch path this file was renamed from
+    };
+
+    std::unordered_map<std::wstring, Record> records;
+    std::vector<std::wstring> order;  // First-seen order, keeps batches deterministic
+    bool overflow = false;
+
+    // Finds or creates the record; new records start in the given state
+    Record& Touch(const std::wstring& path, bool existed);
+};
+
+////////////////////////////////////////////////////////////////////////
+// Class: ToolWatcher
+// Purpose: Watches every scanned root for file changes and streams
+//          coalesced CatalogDelta batches to a callback.
+//          Backends: ReadDirectoryChangesW on Windows, inotify on Linux.
+//          A batch is delivered once the roots have been quiet for the
+//          quiet period (or the max latency expires during a long copy),
+//          so bulk operations produce one batch, not hundreds.
+////////////////////////////////////////////////////////////////////////
+class ToolWatcher {
+public:
+    // Called on the watcher's flush thread - marshal to the UI thread yourself
+    using DeltaCallback = std::function<void(std::vector<CatalogDelta>&& batch)>;
+
+    ToolWatcher();
+    ~ToolWatcher();
+
+    // Starts one reader thread per existing root plus the flush thread
+    bool Start(const std::vector<std::wstring>& roots,
+        const std::vector<std::wstring>& extensions, DeltaCallback callback);
+
+    // Stops all threads; no callback runs after this returns
+    void Stop();
+
+    bool IsRunning() const { return running.load(); }
+
+    // Debounce tuning (defaults: 250 ms quiet, 2 s max latency)
+    void SetTiming(std::chrono::milliseconds quiet, std::chrono::milliseconds maxLatency);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    std::vector<std::wstring> extensions;
+    DeltaCallback onDeltas;
+    std::atomic<bool> running{ false };
+
+    std::mutex lock;
+    std::condition_variable wake;
+    DeltaCoalescer coalescer;
+    Clock::time_point firstEvent;
+    Clock::time_point lastEvent;
+    std::chrono::milliseconds quietPeriod{ 250 };
+    std::chrono::milliseconds maxLatency{ 2000 };
+
+    std::vector<std::thread> readers;
+    std::thread flusher;
+    void* stopEvent = nullptr;   // Windows only: manual-reset event that ends reads
+
+    // Platform-specific loop for one root
+    void ReadLoop(std::wstring root);
+
+    // Waits for quiet periods and hands batches to the callback
+    void FlushLoop();
+
+    // Filters a raw notification and feeds it to the coalescer
+    void Report(CatalogDelta::Kind kind, const std::wstring& path,
+        const std::wstring& oldPath = std::wstring());
+
+    bool IsToolFile(const std::wstring& path) const;
+};
@@ -0,0 +1,55 @@
+#include "VirtualLayout.h"
+#include <algorithm>
+
+//////////////////////////////////////////////////////////////////////
+// SetUniform: Content ends one padding past the last item (not the
+//             last pitch, which would include the trailing gap)
+//////////////////////////////////////////////////////////////////////
+void VirtualLayout::SetUniform(const UniformLayout& newLayout, size_t itemCount) {
+    layout = newLayout;
+    layout.columns = (std::max)(layout.columns, 1);
+    count = itemCount;
+    hitTester.SetUniform(layout, count);
+
+    if (count == 0) {
+        contentWidth = contentHeight = 0;
+        return;
+    }
+
+    const size_t columnsUsed = (std::min)(count, static_cast<size_t>(layout.columns));
+    const size_t rows = (count + layout.columns - 1) / layout.columns;
+
+    contentWidth = layout.originX + static_cast<int>(columnsUsed - 1) * layout.pitchX +
+        layout.itemWidth + layout.padding;
+    contentHeight = layout.originY + static_cast<int>(rows - 1) * layout.pitchY +
+        layout.itemHeight + layout.padding;
+}
+
+HitRect VirtualLayout::GetItemRect(size_t index) const {
+    const int column = static_cast<int>(index % layout.columns);
+    const int row = static_cast<int>(index / layout.columns);
+
+    HitRect rect;
+    rect.left = layout.originX + column * layout.pitchX;
+    rect.top = layout.originY + row * layout.pitchY;
+    rect.right = rect.left + layout.itemWidth;
+    rect.bottom = rect.top + layout.itemHeight;
+    return rect;
+}
+
+//////////////////////////////////////////////////////////////////////
+// GetVisibleRange: Whole rows; a row counts once any of it is visible
+//////////////////////////////////////////////////////////////////////
+void VirtualLayout::GetVisibleRange(int top, int bottom, size_t& first, size_t& last) const {
+    first = last = 0;
+    if (count == 0 || layout.pitchY <= 0 || bottom <= layout.originY || bottom <= top)
+        return;
+
+    // Row r covers [originY + r * pitchY, ... + itemHeight)
+    const int skipped = top - layout.originY - layout.itemHeight;
+    const int firstRow = skipped < 0 ? 0 : skipped / layout.pitchY + 1;
+    const int lastRow = (bottom - 1 - layout.originY) / layout.pitchY;
+
+    first = (std::min)(count, static_cast<size_t>(firstRow) * layout.columns);
+    last = (std::min)(count, static_cast<size_t>(lastRow + 1) * layout.columns);
+}
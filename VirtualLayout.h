@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>             // size_t
+#include "HitTester.h"         // UniformLayout + point lookup
+
+////////////////////////////////////////////////////////////////////////
+// Class: VirtualLayout
+// Purpose: Item positions in virtual (content) coordinates, which do not
+//          depend on the scroll position. Nothing is stored per item:
+//          a rectangle, the content size and the range of items that
+//          intersect a viewport are all computed from the layout in O(1).
+//          Scrolling only moves the viewport; SetUniform is needed only
+//          when the item count, view mode or window width changes.
+////////////////////////////////////////////////////////////////////////
+class VirtualLayout {
+public:
+    void SetUniform(const UniformLayout& layout, size_t count);
+
+    size_t GetCount() const { return count; }
+    int GetContentWidth() const { return contentWidth; }
+    int GetContentHeight() const { return contentHeight; }
+
+    // Rectangle of item `index` in content coordinates
+    HitRect GetItemRect(size_t index) const;
+
+    // Items intersecting rows [top, bottom) of the content: [first, last).
+    // Empty (first == last) when nothing is visible.
+    void GetVisibleRange(int top, int bottom, size_t& first, size_t& last) const;
+
+    // Item under a content point, or -1
+    int HitTest(int x, int y) const { return hitTester.HitTest(x, y); }
+
+private:
+    UniformLayout layout;
+    size_t count = 0;
+    int contentWidth = 0;
+    int contentHeight = 0;
+    HitTester hitTester;
+};
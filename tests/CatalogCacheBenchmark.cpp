@@ -0,0 +1,120 @@
+#include "CatalogCache.h"
+#include "DirectoryWalker.h"
+#include "TextNormalizer.h"
+#include "TestSupport.h"
+#include <cstdlib>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+//////////////////////////////////////////////////////////////////////
+// MakeTree: `count` tools, about a hundred per folder
+//////////////////////////////////////////////////////////////////////
+static void MakeTree(const fs::path& root, size_t count) {
+    const size_t folders = (std::max<size_t>)(count / 100, 1);
+    for (size_t i = 0; i < folders; ++i)
+        fs::create_directories(root / (L"group_" + std::to_wstring(i)));
+    for (size_t i = 0; i < count; ++i)
+        std::ofstream(root / (L"group_" + std::to_wstring(i % folders)) / (L"Build_Tool_" + std::to_wstring(i) + L".bat")) << "x";
+}
+
+//////////////////////////////////////////////////////////////////////
+// MeasureSize: One row of the table. The cold start walks the folders
+// and computes each name's keys (ScanForTools); the warm start maps the
+// cache and decodes every record, display text included
+// (LoadCatalogCache). Both then hold the same catalog in memory.
+//////////////////////////////////////////////////////////////////////
+static bool MeasureSize(size_t count, int runs) {
+    const fs::path root = ScratchFolder(L"CatalogCacheBenchmark");
+    const std::wstring file = (root / L"ToolCatalog.bin").wstring();
+    MakeTree(root, count);
+
+    WalkOptions options;
+    options.roots = { root.wstring() };
+    options.extensions = { L".bat" };
+
+    bool ok = true;
+    std::vector<WalkedFile> walked;
+    std::wstring searchKey, displayText;
+    const double walkTime = MeasureMicroseconds(runs, [&] {
+        DirectoryWalker walker(options);
+        walked = walker.Walk();
+        for (const WalkedFile& tool : walked)
+            TextNormalizer::MakeKeys(tool.name, searchKey, displayText);
+        KeepResult(displayText);
+    });
+    ok &= walked.size() == count;
+
+    std::vector<CatalogRecord> records;
+    records.reserve(walked.size());
+    for (const WalkedFile& tool : walked) {
+        CatalogRecord record;
+        record.folder = tool.folder;
+        record.fileName = tool.name + tool.extension;
+        record.extension = tool.extension;
+        record.searchKey = TextNormalizer::ToSearchKey(tool.name);
+        record.size = tool.size;
+        record.mtime = tool.mtime;
+        records.push_back(std::move(record));
+    }
+
+    const double writeTime = MeasureMicroseconds(runs, [&] { ok &= CatalogCache::Write(file, records); });
+    const double openTime = MeasureMicroseconds(runs, [&] {
+        CatalogCache cache;
+        ok &= cache.Open(file);
+    });
+
+    size_t decoded = 0;
+    const double loadTime = MeasureMicroseconds(runs, [&] {
+        CatalogCache cache;
+        ok &= cache.Open(file);
+        CatalogRecord record;
+        decoded = 0;
+        for (size_t i = 0; i < cache.GetEntryCount(); ++i) {
+            decoded += cache.ReadRecord(i, record);
+            record.fileName.resize(record.fileName.size() - record.extension.size());
+            displayText = TextNormalizer::ToDisplayText(record.fileName);
+        }
+        KeepResult(displayText);
+    });
+    ok &= decoded == count;
+
+    std::error_code ec;
+    const auto fileSize = fs::file_size(file, ec);
+    fs::remove_all(root, ec);
+
+    std::printf("  %8zu %9.0f KiB %12.1f %12.1f %12.1f %12.1f %8.1fx\n", count, fileSize / 1024.0,
+        walkTime, writeTime, openTime, loadTime, loadTime > 0 ? walkTime / loadTime : 0.0);
+    return ok;
+}
+
+//////////////////////////////////////////////////////////////////////
+// CatalogCacheBenchmark: Cold start (walk the tool folders) against warm
+// start (map the catalog cache) at several catalog sizes, over synthetic
+// trees in the temp folder. The OS keeps the folder listings cached
+// between runs, so the walk times are a lower bound for a real cold
+// start from disk.
+//   CatalogCacheBenchmark [records...]   (default 1000 10000 100000)
+//////////////////////////////////////////////////////////////////////
+int main(int argc, char** argv) {
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; ++i)
+        sizes.push_back(std::strtoul(argv[i], nullptr, 10));
+    if (sizes.empty())
+        sizes = { 1000, 10000, 100000 };
+
+    const int runs = 5;
+    std::printf("times in us, median of %d runs\n", runs);
+    std::printf("  %8s %13s %12s %12s %12s %12s %9s\n", "records", "cache file",
+        "walk + keys", "write", "open", "open+decode", "speedup");
+
+    bool ok = true;
+    for (size_t count : sizes)
+        ok &= MeasureSize(count, runs);
+
+    if (!ok) {
+        std::fprintf(stderr, "CatalogCacheBenchmark: walk or cache did not round-trip\n");
+        return 1;
+    }
+    return 0;
+}
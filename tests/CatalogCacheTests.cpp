@@ -0,0 +1,163 @@
+#include "CatalogCache.h"
+#include "TestSupport.h"
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <thread>
+
+//////////////////////////////////////////////////////////////////////
+// Helpers: The cache file as bytes, patched and written back
+//////////////////////////////////////////////////////////////////////
+static std::vector<char> ReadBytes(const std::wstring& file) {
+    std::ifstream in(std::filesystem::path(file), std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+static void WriteBytes(const std::wstring& file, const std::vector<char>& bytes) {
+    std::ofstream out(std::filesystem::path(file), std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), bytes.size());
+}
+
+template <typename T>
+static void Patch(std::vector<char>& bytes, size_t offset, T value) {
+    std::memcpy(bytes.data() + offset, &value, sizeof(value));
+}
+
+static std::vector<CatalogRecord> MakeRecords(const std::wstring& base) {
+    std::vector<CatalogRecord> records;
+    for (int i = 0; i < 50; ++i) {
+        CatalogRecord record;
+        record.folder = i % 2 ? base + L"/sub" : std::wstring(L"/elsewhere");
+        record.fileName = L"tool_" + std::to_wstring(i) + L"\U0001F600.bat";
+        record.extension = L".bat";
+        record.searchKey = L"tool " + std::to_wstring(i);
+        record.size = i * 100;
+        record.mtime = -i;
+        record.lastLaunched = i * 7;
+        record.category = static_cast<uint8_t>(i % 5);
+        records.push_back(record);
+    }
+    return records;
+}
+
+//////////////////////////////////////////////////////////////////////
+// RoundTrip: Everything written comes back, relative folders included
+//////////////////////////////////////////////////////////////////////
+static void RoundTrip(const std::wstring& file) {
+    const std::wstring base = std::filesystem::path(file).parent_path().wstring();
+    const std::vector<CatalogRecord> records = MakeRecords(base);
+    CHECK(CatalogCache::Write(file, records));
+
+    CatalogCache cache;
+    CHECK(cache.Open(file));
+    CHECK(cache.GetEntryCount() == records.size());
+
+    CatalogRecord record;
+    for (size_t i = 0; i < cache.GetEntryCount() && i < records.size(); ++i) {
+        CHECK(cache.ReadRecord(i, record));
+        CHECK(std::filesystem::path(record.folder) == std::filesystem::path(records[i].folder));
+        CHECK(record.fileName == records[i].fileName);
+        CHECK(record.extension == records[i].extension);
+        CHECK(record.searchKey == records[i].searchKey);
+        CHECK(record.size == records[i].size);
+        CHECK(record.mtime == records[i].mtime);
+        CHECK(record.lastLaunched == records[i].lastLaunched);
+        CHECK(record.category == records[i].category);
+    }
+    CHECK(!cache.ReadRecord(records.size(), record));
+}
+
+//////////////////////////////////////////////////////////////////////
+// MalformedHeaders: Header layout is magic, version, entryCount,
+// entrySize (4 bytes each), then entriesOffset, poolOffset, poolLength,
+// fileSize (8 bytes each). Sizes whose sums wrap around must not pass
+//////////////////////////////////////////////////////////////////////
+static void MalformedHeaders(const std::wstring& file) {
+    CHECK(CatalogCache::Write(file, MakeRecords(L"/base")));
+    const std::vector<char> good = ReadBytes(file);
+    CHECK(good.size() > 48);
+
+    struct Case {
+        const char* name;
+        size_t offset;
+        uint64_t value;
+        size_t width;
+    };
+    const Case cases[] = {
+        { "pool length wraps", 32, uint64_t(1) << 63, 8 },
+        { "pool length too long", 32, good.size(), 8 },
+        { "pool offset wraps", 24, ~uint64_t(0) - 1, 8 },
+        { "entries offset wraps", 16, ~uint64_t(0) - 63, 8 },
+        { "entry count too large", 8, 0xFFFFFFFFu, 4 },
+        { "wrong magic", 0, 0x12345678u, 4 },
+        { "wrong version", 4, 1u, 4 },
+    };
+
+    for (const Case& test : cases) {
+        std::vector<char> bytes = good;
+        if (test.width == 8)
+            Patch(bytes, test.offset, test.value);
+        else
+            Patch(bytes, test.offset, static_cast<uint32_t>(test.value));
+        WriteBytes(file, bytes);
+
+        CatalogCache cache;
+        const bool opened = cache.Open(file);
+        if (opened)
+            std::fprintf(stderr, "accepted: %s\n", test.name);
+        CHECK(!opened);
+    }
+
+    // Truncated and empty files
+    for (size_t length : { good.size() - 2, size_t(47), size_t(0) }) {
+        WriteBytes(file, std::vector<char>(good.begin(), good.begin() + length));
+        CatalogCache cache;
+        CHECK(!cache.Open(file));
+    }
+
+    CatalogCache missing;
+    CHECK(!missing.Open(file + L".missing"));
+}
+
+//////////////////////////////////////////////////////////////////////
+// ConcurrentWriters: Launchers sharing one cache each write through
+//                    their own temp file, so every write lands whole
+//////////////////////////////////////////////////////////////////////
+static void ConcurrentWriters(const std::wstring& file) {
+    const std::wstring base = std::filesystem::path(file).parent_path().wstring();
+    const std::vector<CatalogRecord> records = MakeRecords(base);
+
+    std::atomic<int> failedWrites{ 0 };
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 4; ++w) {
+        writers.emplace_back([&] {
+            for (int i = 0; i < 25; ++i)
+                failedWrites += !CatalogCache::Write(file, records);
+        });
+    }
+    for (auto& writer : writers)
+        writer.join();
+
+    CHECK(failedWrites == 0);
+    CatalogCache cache;
+    CHECK(cache.Open(file));
+    CHECK(cache.GetEntryCount() == records.size());
+
+    const std::wstring name = std::filesystem::path(file).filename().wstring();
+    for (const auto& entry : std::filesystem::directory_iterator(base)) {
+        const std::wstring leftover = entry.path().filename().wstring();
+        CHECK(leftover.compare(0, name.size(), name) != 0 || leftover == name);
+    }
+}
+
+int main() {
+    const std::wstring file = ScratchPath(L"CatalogCacheTests.bin");
+    RoundTrip(file);
+    MalformedHeaders(file);
+    ConcurrentWriters(file);
+
+    std::error_code ec;
+    std::filesystem::remove(file, ec);
+    return TestResult("CatalogCacheTests");
+}
@@ -0,0 +1,109 @@
+#include "DirectoryWalker.h"
+#include "TestSupport.h"
+#include <cstdlib>
+#include <fstream>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+//////////////////////////////////////////////////////////////////////
+// MakeTree: `folders` folders, eight subfolders each (so the tree is
+//           both wide and a few levels deep), with five tools and five
+//           other files in every folder. Returns the number of tools.
+//////////////////////////////////////////////////////////////////////
+static size_t MakeTree(const fs::path& root, size_t folders) {
+    std::vector<fs::path> paths(folders);
+    size_t tools = 0;
+    for (size_t i = 0; i < folders; ++i) {
+        paths[i] = i == 0 ? root : paths[(i - 1) / 8] / (L"folder_" + std::to_wstring(i));
+        fs::create_directories(paths[i]);
+        for (int j = 0; j < 5; ++j) {
+            std::ofstream(paths[i] / (L"tool_" + std::to_wstring(j) + L".bat")) << "x";
+            std::ofstream(paths[i] / (L"data_" + std::to_wstring(j) + L".txt")) << "x";
+            ++tools;
+        }
+    }
+    return tools;
+}
+
+//////////////////////////////////////////////////////////////////////
+// SingleThreadedWalk: The plain std::filesystem walk DirectoryWalker
+//                     replaces, recording the same fields
+//////////////////////////////////////////////////////////////////////
+static size_t SingleThreadedWalk(const fs::path& root) {
+    std::vector<WalkedFile> files;
+    std::error_code ec;
+    for (fs::recursive_directory_iterator it(root, fs::directory_options::skip_permission_denied, ec), end;
+        it != end; it.increment(ec)) {
+        if (ec)
+            break;
+        if (!it->is_regular_file(ec) || DirectoryWalker::NormalizeExtension(it->path().extension().wstring()) != L".bat")
+            continue;
+
+        WalkedFile file;
+        file.path = it->path().wstring();
+        file.folder = it->path().parent_path().wstring();
+        file.name = it->path().stem().wstring();
+        file.extension = L".bat";
+        file.size = it->file_size(ec);
+        file.mtime = static_cast<int64_t>(it->last_write_time(ec).time_since_epoch().count());
+        files.push_back(std::move(file));
+    }
+    std::sort(files.begin(), files.end(), [](const WalkedFile& a, const WalkedFile& b) { return a.path < b.path; });
+    return files.size();
+}
+
+//////////////////////////////////////////////////////////////////////
+// DirectoryWalkerBenchmark: DirectoryWalker at 1, 2, 4 and all worker
+// threads against a single-threaded recursive_directory_iterator walk,
+// over a synthetic tree in the temp folder. The OS caches the folder
+// listings after the first run, so these are warm-cache times: what is
+// measured is the walker's own overhead and how it scales, not the disk.
+//   DirectoryWalkerBenchmark [folders]   (default 4000)
+//////////////////////////////////////////////////////////////////////
+int main(int argc, char** argv) {
+    const size_t folders = (std::max<size_t>)(argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4000, 1);
+    const fs::path root = ScratchFolder(L"DirectoryWalkerBenchmark");
+    const size_t tools = MakeTree(root, folders);
+    const int runs = 5;
+
+    bool ok = true;
+    size_t found = 0;
+    const double baselineTime = MeasureMicroseconds(runs, [&] { found = SingleThreadedWalk(root); });
+    ok &= found == tools;
+
+    std::printf("%zu folders, %zu tools (median of %d runs)\n", folders, tools, runs);
+    std::printf("  recursive_directory_iterator %10.1f us\n", baselineTime);
+
+    // 1, 2, 4, ... up to every core (the walker's default)
+    const unsigned cores = (std::max)(2u, std::thread::hardware_concurrency());
+    std::vector<unsigned> threadCounts;
+    for (unsigned threads = 1; threads < cores && threads <= 4; threads *= 2)
+        threadCounts.push_back(threads);
+    threadCounts.push_back(cores);
+
+    for (unsigned threads : threadCounts) {
+        WalkOptions options;
+        options.roots = { root.wstring() };
+        options.extensions = { L".bat" };
+        options.maxDepth = 64;
+        options.threadCount = threads;
+
+        const double walkTime = MeasureMicroseconds(runs, [&] {
+            DirectoryWalker walker(options);
+            found = walker.Walk().size();
+        });
+        ok &= found == tools;
+        std::printf("  DirectoryWalker, %2u threads  %10.1f us  (%.2fx)\n", threads, walkTime,
+            walkTime > 0 ? baselineTime / walkTime : 0.0);
+    }
+
+    std::error_code ec;
+    fs::remove_all(root, ec);
+
+    if (!ok) {
+        std::fprintf(stderr, "DirectoryWalkerBenchmark: a walk missed or repeated files\n");
+        return 1;
+    }
+    return 0;
+}
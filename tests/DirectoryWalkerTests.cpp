@@ -0,0 +1,233 @@
+#include "DirectoryWalker.h"
+#include "TestSupport.h"
+#include <atomic>
+#include <fstream>
+#include <mutex>
+
+namespace fs = std::filesystem;
+
+//////////////////////////////////////////////////////////////////////
+// ToolFile: A file the tree builder created that a walk must report,
+//           with its folder level below the root
+//////////////////////////////////////////////////////////////////////
+struct ToolFile {
+    std::wstring path;
+    int depth;
+};
+
+static void Touch(const fs::path& path) {
+    std::ofstream(path) << "x";
+}
+
+//////////////////////////////////////////////////////////////////////
+// MakeTree: Four levels of folders with tools and non-tools in each,
+//           an upper-case extension, a folder named like a tool and a
+//           link back up the tree (skipped where links need rights)
+//////////////////////////////////////////////////////////////////////
+static std::vector<ToolFile> MakeTree(const fs::path& root) {
+    std::vector<ToolFile> tools;
+    auto tool = [&](const fs::path& path, int depth) {
+        Touch(path);
+        tools.push_back({ path.wstring(), depth });
+    };
+
+    tool(root / L"a.bat", 0);
+    tool(root / L"B.EXE", 0);
+    Touch(root / L"notes.txt");
+    Touch(root / L"noext");
+
+    for (int i = 0; i < 4; ++i) {
+        const fs::path level1 = root / (L"level1_" + std::to_wstring(i));
+        fs::create_directory(level1);
+        tool(level1 / (L"tool_" + std::to_wstring(i) + L".py"), 1);
+        Touch(level1 / L"readme.md");
+
+        for (int j = 0; j < 3; ++j) {
+            const fs::path level2 = level1 / (L"level2_" + std::to_wstring(j));
+            fs::create_directory(level2);
+            tool(level2 / (L"deep_" + std::to_wstring(i) + L"_" + std::to_wstring(j) + L".bat"), 2);
+        }
+    }
+
+    const fs::path level3 = root / L"level1_0" / L"level2_0" / L"level3";
+    fs::create_directory(level3);
+    tool(level3 / L"deepest.exe", 3);
+
+    // Only files count, whatever the folder is called
+    const fs::path folderTool = root / L"folder.bat";
+    fs::create_directory(folderTool);
+    tool(folderTool / L"inner.bat", 1);
+
+    std::error_code ec;
+    fs::create_directory_symlink(root, root / L"level1_1" / L"loop", ec);
+
+    std::sort(tools.begin(), tools.end(),
+        [](const ToolFile& a, const ToolFile& b) { return a.path < b.path; });
+    return tools;
+}
+
+static std::vector<std::wstring> Expected(const std::vector<ToolFile>& tools, int maxDepth) {
+    std::vector<std::wstring> paths;
+    for (const ToolFile& tool : tools) {
+        if (tool.depth <= maxDepth)
+            paths.push_back(tool.path);
+    }
+    return paths;
+}
+
+static std::vector<std::wstring> Paths(const std::vector<WalkedFile>& files) {
+    std::vector<std::wstring> paths;
+    for (const WalkedFile& file : files)
+        paths.push_back(file.path);
+    return paths;
+}
+
+static WalkOptions MakeOptions(const fs::path& root, int maxDepth, unsigned threads) {
+    WalkOptions options;
+    options.roots = { root.wstring() };
+    options.extensions = { L".bat", L".exe", L".py" };
+    options.maxDepth = maxDepth;
+    options.threadCount = threads;
+    return options;
+}
+
+//////////////////////////////////////////////////////////////////////
+// EveryFileOnce: The sorted result equals the files made, so none is
+//                missing or reported twice, for any worker count
+//////////////////////////////////////////////////////////////////////
+static void EveryFileOnce(const fs::path& root, const std::vector<ToolFile>& tools) {
+    for (unsigned threads : { 1u, 2u, 8u }) {
+        DirectoryWalker walker(MakeOptions(root, 8, threads));
+        const std::vector<WalkedFile> files = walker.Walk();
+        CHECK(Paths(files) == Expected(tools, 8));
+        CHECK(walker.GetDirectoryCount() == 19);
+    }
+
+    DirectoryWalker walker(MakeOptions(root, 8, 4));
+    for (const WalkedFile& file : walker.Walk()) {
+        CHECK(file.folder == fs::path(file.path).parent_path().wstring());
+        CHECK(file.size == 1);
+        CHECK(file.extension == L".bat" || file.extension == L".exe" || file.extension == L".py");
+        if (file.name == L"B")
+            CHECK(file.extension == L".exe");
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// DepthLimits: maxDepth 0 is the root folder only
+//////////////////////////////////////////////////////////////////////
+static void DepthLimits(const fs::path& root, const std::vector<ToolFile>& tools) {
+    for (int depth = 0; depth <= 3; ++depth) {
+        DirectoryWalker walker(MakeOptions(root, depth, 4));
+        CHECK(Paths(walker.Walk()) == Expected(tools, depth));
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// SeveralRoots: Missing roots are skipped, the others walked in full
+//////////////////////////////////////////////////////////////////////
+static void SeveralRoots(const fs::path& root, const std::vector<ToolFile>& tools) {
+    WalkOptions options = MakeOptions(root / L"level1_2", 8, 4);
+    options.roots.push_back((root / L"missing").wstring());
+    options.roots.push_back((root / L"level1_3").wstring());
+
+    std::vector<std::wstring> expected;
+    for (const ToolFile& tool : tools) {
+        if (tool.path.find(L"level1_2") != std::wstring::npos || tool.path.find(L"level1_3") != std::wstring::npos)
+            expected.push_back(tool.path);
+    }
+
+    DirectoryWalker walker(options);
+    CHECK(Paths(walker.Walk()) == expected);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Streaming: The batches add up to the same files, each once
+//////////////////////////////////////////////////////////////////////
+static void Streaming(const fs::path& root, const std::vector<ToolFile>& tools) {
+    std::mutex lock;
+    std::vector<WalkedFile> files;
+    size_t batches = 0;
+
+    DirectoryWalker walker(MakeOptions(root, 8, 4));
+    walker.Walk([&](std::vector<WalkedFile>&& batch) {
+        std::lock_guard<std::mutex> guard(lock);
+        CHECK(!batch.empty());
+        ++batches;
+        std::move(batch.begin(), batch.end(), std::back_inserter(files));
+    }, 2);
+
+    std::sort(files.begin(), files.end(), [](const WalkedFile& a, const WalkedFile& b) { return a.path < b.path; });
+    CHECK(Paths(files) == Expected(tools, 8));
+    CHECK(batches > 1);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Cancellation: Sticky before Walk; from a batch callback, no batch
+//               follows it (one worker) and the walk still returns
+//////////////////////////////////////////////////////////////////////
+static void Cancellation(const fs::path& root, const std::vector<ToolFile>& tools) {
+    {
+        DirectoryWalker walker(MakeOptions(root, 8, 4));
+        walker.Cancel();
+        CHECK(walker.Walk().empty());
+    }
+
+    {
+        DirectoryWalker walker(MakeOptions(root, 8, 1));
+        size_t batches = 0, delivered = 0;
+        walker.Walk([&](std::vector<WalkedFile>&& batch) {
+            ++batches;
+            delivered += batch.size();
+            walker.Cancel();
+        }, 1);
+        CHECK(batches == 1);
+        CHECK(delivered > 0 && delivered < tools.size());
+    }
+
+    {
+        DirectoryWalker walker(MakeOptions(root, 8, 8));
+        std::mutex lock;
+        std::vector<std::wstring> paths;
+        walker.Walk([&](std::vector<WalkedFile>&& batch) {
+            walker.Cancel();
+            std::lock_guard<std::mutex> guard(lock);
+            for (const WalkedFile& file : batch)
+                paths.push_back(file.path);
+        }, 1);
+
+        std::sort(paths.begin(), paths.end());
+        CHECK(std::adjacent_find(paths.begin(), paths.end()) == paths.end());
+        CHECK(paths.size() <= tools.size());
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// RepeatedWalks: Idle workers park on a condition variable; a lost
+//                wake-up would hang here (ctest's timeout catches it)
+//////////////////////////////////////////////////////////////////////
+static void RepeatedWalks(const fs::path& root, const std::vector<ToolFile>& tools) {
+    const std::vector<std::wstring> expected = Expected(tools, 8);
+    size_t mismatches = 0;
+    for (int run = 0; run < 200; ++run) {
+        DirectoryWalker walker(MakeOptions(root, 8, 8));
+        mismatches += Paths(walker.Walk()) != expected;
+    }
+    CHECK(mismatches == 0);
+}
+
+int main() {
+    const fs::path root = ScratchFolder(L"DirectoryWalkerTests");
+    const std::vector<ToolFile> tools = MakeTree(root);
+
+    EveryFileOnce(root, tools);
+    DepthLimits(root, tools);
+    SeveralRoots(root, tools);
+    Streaming(root, tools);
+    Cancellation(root, tools);
+    RepeatedWalks(root, tools);
+
+    std::error_code ec;
+    fs::remove_all(root, ec);
+    return TestResult("DirectoryWalkerTests");
+}
@@ -0,0 +1,147 @@
+#include "HitTester.h"
+#include "TestSupport.h"
+#include <random>
+
+// What HitTest must agree with: the first rectangle containing the point
+static int FrontToBack(const std::vector<HitRect>& rects, int x, int y) {
+    for (size_t i = 0; i < rects.size(); ++i) {
+        const HitRect& rect = rects[i];
+        if (x >= rect.left && x < rect.right && y >= rect.top && y < rect.bottom)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+//////////////////////////////////////////////////////////////////////
+// UniformHits: A 4-column grid of 10 items, 100x50 cells with a 10 px
+//              gap, starting at (20, 30)
+//////////////////////////////////////////////////////////////////////
+static void UniformHits() {
+    UniformLayout layout;
+    layout.originX = 20;
+    layout.originY = 30;
+    layout.pitchX = 110;
+    layout.pitchY = 60;
+    layout.itemWidth = 100;
+    layout.itemHeight = 50;
+    layout.columns = 4;
+
+    HitTester tester;
+    tester.SetUniform(layout, 10);
+
+    // Corners of items, right/bottom exclusive
+    CHECK(tester.HitTest(20, 30) == 0);
+    CHECK(tester.HitTest(119, 79) == 0);
+    CHECK(tester.HitTest(130, 30) == 1);
+    CHECK(tester.HitTest(350, 30) == 3);
+    CHECK(tester.HitTest(20, 90) == 4);
+    CHECK(tester.HitTest(130, 150) == 9);
+
+    // Gaps between columns and rows
+    CHECK(tester.HitTest(120, 30) == -1);
+    CHECK(tester.HitTest(129, 50) == -1);
+    CHECK(tester.HitTest(50, 80) == -1);
+    CHECK(tester.HitTest(50, 89) == -1);
+
+    // Before the origin, past the last column, past the last item
+    CHECK(tester.HitTest(19, 30) == -1);
+    CHECK(tester.HitTest(20, 29) == -1);
+    CHECK(tester.HitTest(-500, -500) == -1);
+    CHECK(tester.HitTest(460, 30) == -1);
+    CHECK(tester.HitTest(240, 150) == -1);
+    CHECK(tester.HitTest(20, 210) == -1);
+
+    // A list is one column; zero columns means one
+    layout.columns = 0;
+    tester.SetUniform(layout, 3);
+    CHECK(tester.HitTest(20, 150) == 2);
+    CHECK(tester.HitTest(130, 30) == -1);
+
+    tester.SetUniform(layout, 0);
+    CHECK(tester.HitTest(20, 30) == -1);
+}
+
+//////////////////////////////////////////////////////////////////////
+// RectHits: Free-form rectangles with gaps, overlaps, an empty one and
+//           negative coordinates
+//////////////////////////////////////////////////////////////////////
+static void RectHits() {
+    const std::vector<HitRect> rects = {
+        { 0, 0, 100, 100 },       // 0
+        { 50, 50, 150, 150 },     // 1: overlaps 0
+        { 40, 40, 60, 60 },       // 2: inside 0 and 1
+        { 300, 0, 400, 40 },      // 3: alone
+        { 200, 200, 200, 260 },   // 4: empty, never hit
+        { -80, -60, -20, -10 },   // 5: left of and above the others
+    };
+
+    HitTester tester;
+    tester.SetRects(rects);
+
+    // Lowest index wins where rectangles overlap
+    CHECK(tester.HitTest(75, 75) == 0);
+    CHECK(tester.HitTest(45, 45) == 0);
+    CHECK(tester.HitTest(55, 55) == 0);
+    CHECK(tester.HitTest(120, 120) == 1);
+    CHECK(tester.HitTest(100, 50) == 1);
+    CHECK(tester.HitTest(350, 20) == 3);
+    CHECK(tester.HitTest(-80, -60) == 5);
+
+    // Gaps, edges, the empty rectangle, outside the bounds
+    CHECK(tester.HitTest(200, 20) == -1);
+    CHECK(tester.HitTest(400, 20) == -1);
+    CHECK(tester.HitTest(350, 40) == -1);
+    CHECK(tester.HitTest(200, 210) == -1);
+    CHECK(tester.HitTest(0, -1) == -1);
+    CHECK(tester.HitTest(-81, -30) == -1);
+    CHECK(tester.HitTest(1000, 1000) == -1);
+    CHECK(tester.HitTest(-1000, 20) == -1);
+
+    tester.Clear();
+    CHECK(tester.HitTest(75, 75) == -1);
+
+    tester.SetRects(std::vector<HitRect>());
+    CHECK(tester.HitTest(0, 0) == -1);
+}
+
+//////////////////////////////////////////////////////////////////////
+// RandomRects: Many overlapping rectangles of mixed sizes (a few
+//              spanning many cells), every point of the area against
+//              a front-to-back scan
+//////////////////////////////////////////////////////////////////////
+static void RandomRects() {
+    std::mt19937 random(12345);
+    std::uniform_int_distribution<int> position(-200, 1800);
+    std::uniform_int_distribution<int> smallSize(1, 40);
+    std::uniform_int_distribution<int> largeSize(100, 600);
+
+    std::vector<HitRect> rects;
+    for (int i = 0; i < 400; ++i) {
+        const int left = position(random), top = position(random);
+        const bool large = i % 25 == 0;
+        const int width = large ? largeSize(random) : smallSize(random);
+        const int height = large ? largeSize(random) : smallSize(random);
+        rects.push_back({ left, top, left + width, top + height });
+    }
+
+    HitTester tester;
+    tester.SetRects(rects);
+
+    size_t mismatches = 0, hits = 0;
+    for (int y = -250; y < 2500; y += 3) {
+        for (int x = -250; x < 2500; x += 3) {
+            const int expected = FrontToBack(rects, x, y);
+            mismatches += tester.HitTest(x, y) != expected;
+            hits += expected >= 0;
+        }
+    }
+    CHECK(mismatches == 0);
+    CHECK(hits > 0);
+}
+
+int main() {
+    UniformHits();
+    RectHits();
+    RandomRects();
+    return TestResult("HitTesterTests");
+}
@@ -0,0 +1,444 @@
+#include "PeIconReader.h"
+#include "TestSupport.h"
+#include <cstdint>
+#include <fstream>
+#include <random>
+
+// Every input is built here: a small 32-bit DIB, a PNG of it, an .ico
+// and a minimal PE32 holding them, then broken in the ways a file from
+// a tool folder can be (truncated, bad sizes and offsets, bit flips)
+
+//////////////////////////////////////////////////////////////////////
+// Helpers: Little/big-endian writers and PNG checksums
+//////////////////////////////////////////////////////////////////////
+using Bytes = std::vector<uint8_t>;
+
+static void Put16(Bytes& out, size_t at, uint32_t value) {
+    if (out.size() < at + 2)
+        out.resize(at + 2);
+    out[at] = static_cast<uint8_t>(value);
+    out[at + 1] = static_cast<uint8_t>(value >> 8);
+}
+
+static void Put32(Bytes& out, size_t at, uint32_t value) {
+    Put16(out, at, value & 0xFFFF);
+    Put16(out, at + 2, value >> 16);
+}
+
+static void Append32BE(Bytes& out, uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8)
+        out.push_back(static_cast<uint8_t>(value >> shift));
+}
+
+static uint32_t Crc32(const uint8_t* data, size_t length) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < length; ++i) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit)
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+static void WriteFile(const std::wstring& file, const Bytes& bytes) {
+    std::ofstream out(std::filesystem::path(file), std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+}
+
+//////////////////////////////////////////////////////////////////////
+// The test image: 16x16, red = 16 * x, green = 16 * y, blue 200,
+// opaque except the transparent top left pixel
+//////////////////////////////////////////////////////////////////////
+const int kSize = 16;
+
+static void PixelAt(int x, int y, uint8_t rgba[4]) {
+    rgba[0] = static_cast<uint8_t>(x * 16);
+    rgba[1] = static_cast<uint8_t>(y * 16);
+    rgba[2] = 200;
+    rgba[3] = (x == 0 && y == 0) ? 0 : 255;
+}
+
+static uint32_t ExpectedPixel(int x, int y) {
+    uint8_t rgba[4];
+    PixelAt(x, y, rgba);
+    if (!rgba[3])
+        return 0;
+    return 0xFF000000u | (uint32_t(rgba[0]) << 16) | (uint32_t(rgba[1]) << 8) | rgba[2];
+}
+
+static bool MatchesTestImage(const DecodedIcon& icon) {
+    if (icon.width != kSize || icon.height != kSize || icon.pixels.size() != size_t(kSize) * kSize)
+        return false;
+    for (int y = 0; y < kSize; ++y)
+        for (int x = 0; x < kSize; ++x)
+            if (icon.pixels[size_t(y) * kSize + x] != ExpectedPixel(x, y))
+                return false;
+    return true;
+}
+
+// BITMAPINFOHEADER, bottom-up BGRA rows, then the AND mask
+static Bytes MakeDib() {
+    Bytes dib;
+    Put32(dib, 0, 40);
+    Put32(dib, 4, kSize);
+    Put32(dib, 8, kSize * 2);           // XOR bitmap + mask
+    Put16(dib, 12, 1);
+    Put16(dib, 14, 32);
+    Put32(dib, 36, 0);
+    for (int y = kSize - 1; y >= 0; --y) {
+        for (int x = 0; x < kSize; ++x) {
+            uint8_t rgba[4];
+            PixelAt(x, y, rgba);
+            dib.insert(dib.end(), { rgba[2], rgba[1], rgba[0], rgba[3] });
+        }
+    }
+    dib.resize(dib.size() + kSize * 4, 0);   // Mask rows are 32-bit aligned
+    return dib;
+}
+
+// Signature, IHDR, one IDAT (zlib with stored blocks), IEND
+static Bytes MakePng() {
+    Bytes raw;
+    for (int y = 0; y < kSize; ++y) {
+        raw.push_back(0);               // Filter: none
+        for (int x = 0; x < kSize; ++x) {
+            uint8_t rgba[4];
+            PixelAt(x, y, rgba);
+            raw.insert(raw.end(), rgba, rgba + 4);
+        }
+    }
+
+    Bytes zlib = { 0x78, 0x01, 0x01 };  // Header, final stored block
+    Put16(zlib, 3, static_cast<uint32_t>(raw.size()));
+    Put16(zlib, 5, static_cast<uint16_t>(~raw.size()));
+    zlib.insert(zlib.end(), raw.begin(), raw.end());
+    uint32_t a = 1, b = 0;
+    for (uint8_t byte : raw) {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    Append32BE(zlib, (b << 16) | a);
+
+    Bytes png = { 137, 80, 78, 71, 13, 10, 26, 10 };
+    auto chunk = [&png](const char* type, const Bytes& body) {
+        Append32BE(png, static_cast<uint32_t>(body.size()));
+        const size_t start = png.size();
+        png.insert(png.end(), type, type + 4);
+        png.insert(png.end(), body.begin(), body.end());
+        Append32BE(png, Crc32(png.data() + start, png.size() - start));
+    };
+
+    Bytes header;
+    Append32BE(header, kSize);
+    Append32BE(header, kSize);
+    header.insert(header.end(), { 8, 6, 0, 0, 0 });   // 8-bit RGBA, not interlaced
+    chunk("IHDR", header);
+    chunk("IDAT", zlib);
+    chunk("IEND", Bytes());
+    return png;
+}
+
+// ICONDIR listing each image (16 bytes per entry, file offsets)
+static Bytes MakeIco(const std::vector<Bytes>& images) {
+    Bytes ico;
+    Put16(ico, 0, 0);
+    Put16(ico, 2, 1);
+    Put16(ico, 4, static_cast<uint32_t>(images.size()));
+    size_t offset = 6 + images.size() * 16;
+    for (size_t i = 0; i < images.size(); ++i) {
+        const size_t entry = 6 + i * 16;
+        ico.resize(entry + 16, 0);
+        ico[entry] = kSize;
+        ico[entry + 1] = kSize;
+        Put16(ico, entry + 4, 1);
+        Put16(ico, entry + 6, 32);
+        Put32(ico, entry + 8, static_cast<uint32_t>(images[i].size()));
+        Put32(ico, entry + 12, static_cast<uint32_t>(offset));
+        offset += images[i].size();
+    }
+    for (const Bytes& image : images)
+        ico.insert(ico.end(), image.begin(), image.end());
+    return ico;
+}
+
+//////////////////////////////////////////////////////////////////////
+// MakePe: PE32 with one .rsrc section (RVA 0x1000, file offset 0x200)
+// holding RT_ICON 1 and RT_GROUP_ICON 1. Offsets of the fields the
+// tests break are returned in `layout`.
+//////////////////////////////////////////////////////////////////////
+struct PeLayout {
+    size_t sectionTable;    // IMAGE_SECTION_HEADER of .rsrc
+    size_t resourceRoot;    // File offset of the resource directory
+    size_t iconDataEntry;   // IMAGE_RESOURCE_DATA_ENTRY of RT_ICON 1
+    size_t group;           // GRPICONDIR
+};
+
+static Bytes MakePe(const Bytes& image, PeLayout& layout) {
+    const uint32_t kRva = 0x1000, kRaw = 0x200;
+    Bytes pe(kRaw, 0);
+    pe[0] = 'M';
+    pe[1] = 'Z';
+    Put32(pe, 0x3C, 0x40);
+    Put32(pe, 0x40, 0x00004550);        // "PE\0\0"
+    Put16(pe, 0x44, 0x14C);             // i386
+    Put16(pe, 0x46, 1);                 // One section
+    Put16(pe, 0x54, 224);               // Optional header: 96 + 16 directories
+    const size_t optional = 0x58;
+    Put16(pe, optional, 0x10B);         // PE32
+    Put32(pe, optional + 92, 16);       // NumberOfRvaAndSizes
+
+    // Resource directory: root -> type -> id -> language -> data entry
+    Bytes rsrc(160, 0);
+    auto directory = [&rsrc](size_t at, uint32_t id, uint32_t target) {
+        Put16(rsrc, at + 14, 1);
+        Put32(rsrc, at + 16, id);
+        Put32(rsrc, at + 20, target);
+    };
+    Put16(rsrc, 14, 2);                 // Root: two id entries
+    Put32(rsrc, 16, 3);
+    Put32(rsrc, 20, 0x80000000u | 32);
+    Put32(rsrc, 24, 14);
+    Put32(rsrc, 28, 0x80000000u | 56);
+    directory(32, 1, 0x80000000u | 80);     // RT_ICON/1
+    directory(56, 1, 0x80000000u | 104);    // RT_GROUP_ICON/1
+    directory(80, 1033, 128);
+    directory(104, 1033, 144);
+
+    const uint32_t imageOffset = 160;
+    const uint32_t groupOffset = imageOffset + static_cast<uint32_t>(image.size());
+    Put32(rsrc, 128, kRva + imageOffset);
+    Put32(rsrc, 132, static_cast<uint32_t>(image.size()));
+    Put32(rsrc, 144, kRva + groupOffset);
+    Put32(rsrc, 148, 20);
+    rsrc.insert(rsrc.end(), image.begin(), image.end());
+
+    Put16(rsrc, groupOffset + 2, 1);    // GRPICONDIR, one 14-byte entry
+    Put16(rsrc, groupOffset + 4, 1);
+    rsrc[groupOffset + 6] = kSize;
+    rsrc[groupOffset + 7] = kSize;
+    Put16(rsrc, groupOffset + 10, 1);
+    Put16(rsrc, groupOffset + 12, 32);
+    Put32(rsrc, groupOffset + 14, static_cast<uint32_t>(image.size()));
+    Put16(rsrc, groupOffset + 18, 1);
+
+    const size_t resourceDirectory = optional + 96 + 2 * 8;
+    Put32(pe, resourceDirectory, kRva);
+    Put32(pe, resourceDirectory + 4, static_cast<uint32_t>(rsrc.size()));
+
+    layout.sectionTable = optional + 224;
+    std::copy_n(".rsrc", 5, pe.begin() + layout.sectionTable);
+    Put32(pe, layout.sectionTable + 8, static_cast<uint32_t>(rsrc.size()));
+    Put32(pe, layout.sectionTable + 12, kRva);
+    Put32(pe, layout.sectionTable + 16, static_cast<uint32_t>(rsrc.size()));
+    Put32(pe, layout.sectionTable + 20, kRaw);
+
+    layout.resourceRoot = kRaw;
+    layout.iconDataEntry = kRaw + 128;
+    layout.group = kRaw + groupOffset;
+    pe.insert(pe.end(), rsrc.begin(), rsrc.end());
+    return pe;
+}
+
+static bool LoadBytes(const std::wstring& file, const Bytes& bytes, DecodedIcon& icon) {
+    WriteFile(file, bytes);
+    return PeIconReader::Load(file, kSize, icon);
+}
+
+//////////////////////////////////////////////////////////////////////
+// Dib: Decodes; bad headers and every cut before the mask are rejected
+//////////////////////////////////////////////////////////////////////
+static void Dib() {
+    const Bytes dib = MakeDib();
+    DecodedIcon icon;
+    CHECK(IconImageDecoder::Decode(dib.data(), dib.size(), icon));
+    CHECK(MatchesTestImage(icon));
+
+    auto rejects = [](Bytes bytes) {
+        DecodedIcon ignored;
+        return !IconImageDecoder::Decode(bytes.data(), bytes.size(), ignored);
+    };
+
+    Bytes broken = dib;
+    Put32(broken, 8, 0x80000000u);      // INT32_MIN height: no overflow on negating
+    CHECK(rejects(broken));
+    broken = dib;
+    Put32(broken, 8, 0);
+    CHECK(rejects(broken));
+    broken = dib;
+    Put32(broken, 4, static_cast<uint32_t>(-kSize));
+    CHECK(rejects(broken));
+    broken = dib;
+    Put32(broken, 4, IconImageDecoder::kMaxSize + 1);
+    CHECK(rejects(broken));
+    broken = dib;
+    Put16(broken, 14, 7);               // No such bit count
+    CHECK(rejects(broken));
+    broken = dib;
+    Put32(broken, 16, 1);               // RLE8
+    CHECK(rejects(broken));
+    broken = dib;
+    Put32(broken, 0, static_cast<uint32_t>(dib.size() + 1));
+    CHECK(rejects(broken));
+    broken = dib;
+    Put16(broken, 14, 8);
+    Put32(broken, 32, 1000);            // Palette larger than 256 colors
+    CHECK(rejects(broken));
+
+    // A 32-bit icon may omit its mask, so cuts inside the mask still decode
+    const size_t maskStart = 40 + size_t(kSize) * kSize * 4;
+    for (size_t length = 0; length < maskStart; ++length)
+        CHECK(rejects(Bytes(dib.begin(), dib.begin() + length)));
+}
+
+//////////////////////////////////////////////////////////////////////
+// Png: Decodes; unsupported formats, broken chunks and truncated
+//      streams are rejected
+//////////////////////////////////////////////////////////////////////
+static void Png() {
+    const Bytes png = MakePng();
+    DecodedIcon icon;
+    CHECK(IconImageDecoder::Decode(png.data(), png.size(), icon));
+    CHECK(MatchesTestImage(icon));
+
+    auto rejects = [](Bytes bytes) {
+        DecodedIcon ignored;
+        return !IconImageDecoder::Decode(bytes.data(), bytes.size(), ignored);
+    };
+
+    // IHDR body starts at 16: width, height, depth, color type, ..., interlace
+    Bytes broken = png;
+    broken[24] = 16;
+    CHECK(rejects(broken));
+    broken = png;
+    broken[25] = 5;
+    CHECK(rejects(broken));
+    broken = png;
+    broken[28] = 1;
+    CHECK(rejects(broken));
+    broken = png;
+    broken[16] = broken[17] = broken[18] = broken[19] = 0;
+    CHECK(rejects(broken));
+    broken = png;
+    broken[17] = 0x10;                  // 1M+ pixels wide
+    CHECK(rejects(broken));
+
+    const size_t idat = 8 + 25;         // After the signature and IHDR
+    broken = png;
+    broken[idat] = broken[idat + 1] = 0xFF;   // Chunk longer than the file
+    CHECK(rejects(broken));
+    broken = png;
+    broken[idat + 8] = 0x79;            // Bad zlib header check
+    CHECK(rejects(broken));
+    broken = png;
+    broken[idat + 8 + 5] ^= 0xFF;       // Stored block NLEN != ~LEN
+    CHECK(rejects(broken));
+
+    const size_t idatEnd = png.size() - 12;   // Only IEND follows
+    for (size_t length = 0; length < idatEnd; ++length)
+        CHECK(rejects(Bytes(png.begin(), png.begin() + length)));
+}
+
+//////////////////////////////////////////////////////////////////////
+// Ico: Both image kinds load; entries pointing outside the file and
+//      cut directories are rejected, other cuts must not crash
+//////////////////////////////////////////////////////////////////////
+static void Ico(const std::wstring& file) {
+    DecodedIcon icon;
+    CHECK(LoadBytes(file, MakeIco({ MakeDib() }), icon) && MatchesTestImage(icon));
+    CHECK(LoadBytes(file, MakeIco({ MakePng() }), icon) && MatchesTestImage(icon));
+
+    const Bytes ico = MakeIco({ MakeDib(), MakePng() });
+    CHECK(LoadBytes(file, ico, icon) && MatchesTestImage(icon));
+
+    Bytes broken = ico;
+    Put16(broken, 4, 1000);             // More entries than the file holds
+    CHECK(!LoadBytes(file, broken, icon));
+    broken = ico;
+    Put32(broken, 6 + 12, 0xFFFFFFF0u); // First image far past the end
+    Put32(broken, 22 + 8, 0xFFFFFFF0u); // Second one's length too
+    CHECK(!LoadBytes(file, broken, icon));
+    broken = ico;
+    Put16(broken, 2, 2);                // Cursor, not icon
+    CHECK(!LoadBytes(file, broken, icon));
+
+    for (size_t length = 0; length < ico.size(); ++length) {
+        const bool loaded = LoadBytes(file, Bytes(ico.begin(), ico.begin() + length), icon);
+        if (length < 6 + 2 * 16)
+            CHECK(!loaded);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// Pe: Loads; broken headers, section table and resource tree are
+//     rejected, as is every truncation (the icon data sits last)
+//////////////////////////////////////////////////////////////////////
+static void Pe(const std::wstring& file) {
+    PeLayout layout;
+    const Bytes pe = MakePe(MakeDib(), layout);
+    DecodedIcon icon;
+    CHECK(LoadBytes(file, pe, icon) && MatchesTestImage(icon));
+    PeLayout pngLayout;
+    CHECK(LoadBytes(file, MakePe(MakePng(), pngLayout), icon) && MatchesTestImage(icon));
+
+    Bytes broken = pe;
+    Put32(broken, 0x3C, 0xFFFFFFF0u);   // e_lfanew past the end
+    CHECK(!LoadBytes(file, broken, icon));
+    broken = pe;
+    Put16(broken, 0x46, 0xFFFF);        // Section table past the end
+    CHECK(!LoadBytes(file, broken, icon));
+    broken = pe;
+    Put32(broken, layout.sectionTable + 20, 0xFFFFF000u);   // Raw data past the end
+    CHECK(!LoadBytes(file, broken, icon));
+    broken = pe;
+    Put16(broken, layout.resourceRoot + 14, 0xFFFF);   // Root entries past the end
+    CHECK(!LoadBytes(file, broken, icon));
+    broken = pe;
+    Put32(broken, layout.resourceRoot + 20, 0xFFFFFFF0u);   // Subdirectory past the end
+    CHECK(!LoadBytes(file, broken, icon));
+    broken = pe;
+    Put32(broken, layout.iconDataEntry + 4, 0xFFFFFFF0u);   // Image size past the end
+    CHECK(!LoadBytes(file, broken, icon));
+    broken = pe;
+    Put16(broken, layout.group + 4, 0xFFFF);   // Group entries past the resource
+    CHECK(!LoadBytes(file, broken, icon));
+
+    for (size_t length = 0; length < pe.size(); ++length)
+        CHECK(!LoadBytes(file, Bytes(pe.begin(), pe.begin() + length), icon));
+}
+
+//////////////////////////////////////////////////////////////////////
+// BitFlips: Random damage to every sample; only has to not crash
+//           (run under ASan/UBSan to catch out-of-bounds reads)
+//////////////////////////////////////////////////////////////////////
+static void BitFlips(const std::wstring& file) {
+    PeLayout layout;
+    const Bytes samples[] = {
+        MakeDib(), MakePng(), MakeIco({ MakeDib(), MakePng() }), MakePe(MakeDib(), layout)
+    };
+
+    std::mt19937 random(7);
+    DecodedIcon icon;
+    for (const Bytes& sample : samples) {
+        for (int round = 0; round < 300; ++round) {
+            Bytes damaged = sample;
+            const int flips = 1 + random() % 8;
+            for (int i = 0; i < flips; ++i)
+                damaged[random() % damaged.size()] ^= static_cast<uint8_t>(1u << (random() % 8));
+            IconImageDecoder::Decode(damaged.data(), damaged.size(), icon);
+            LoadBytes(file, damaged, icon);
+        }
+    }
+}
+
+int main() {
+    const std::wstring file = ScratchPath(L"IconReaderTests.bin");
+    Dib();
+    Png();
+    Ico(file);
+    Pe(file);
+    BitFlips(file);
+
+    std::error_code ec;
+    std::filesystem::remove(file, ec);
+    return TestResult("IconReaderTests");
+}
@@ -0,0 +1,69 @@
+#include "CardPainter.h"
+#include "SoftwareRenderBackend.h"
+#include "TestSupport.h"
+#include <cstdlib>
+#include <string>
+
+//////////////////////////////////////////////////////////////////////
+// RenderBenchmark: Cost of one grid card with the software backend,
+// part by part (the window caches backgrounds and composed cards
+// separately), then whole frames of a 1280x800 grid.
+//   RenderBenchmark [frames]   (default 50)
+//////////////////////////////////////////////////////////////////////
+int main(int argc, char** argv) {
+    const int frames = argc > 1 ? std::atoi(argv[1]) : 50;
+    const int runs = (std::max)(frames, 1);
+    const int size = 150;
+
+    std::vector<uint32_t> pixels(64 * 64);
+    for (size_t i = 0; i < pixels.size(); ++i)
+        pixels[i] = MakeRenderColor(255, static_cast<uint8_t>(i % 64 * 4), static_cast<uint8_t>(i / 64 * 4), 128);
+    RenderImage icon;
+    icon.pixels = pixels.data();
+    icon.width = icon.height = 64;
+
+    const std::wstring name = L"Content Replacement Tool";
+    std::vector<int> extents;
+    LabelMetrics label;
+
+    SoftwareRenderBackend card(size + 8, size + 48);
+    const double backgroundTime = MeasureMicroseconds(runs, [&] {
+        CardPainter::PaintBackground(card, 0, 0, size, CardState::Hover);
+    });
+    const double iconTime = MeasureMicroseconds(runs, [&] {
+        CardPainter::PaintIcon(card, 0, 0, size, &icon);
+    });
+    const double measureTime = MeasureMicroseconds(runs, [&] {
+        CardPainter::MeasureLabel(card, name.c_str(), name.size(), size, extents, label);
+    });
+    const double labelTime = MeasureMicroseconds(runs, [&] {
+        CardPainter::PaintLabel(card, 0, 0, size, name.c_str(), label);
+    });
+    KeepResult(card.GetPixels()[0]);
+
+    // A full grid: 7 x 4 cards with 30px gaps, labels measured each frame
+    SoftwareRenderBackend frame(1280, 800);
+    int cards = 0;
+    const double frameTime = MeasureMicroseconds(runs, [&] {
+        frame.Clear(MakeRenderColor(255, 249, 249, 249));
+        cards = 0;
+        for (int y = 20; y + size + 40 <= frame.GetHeight(); y += size + 40) {
+            for (int x = 20; x + size <= frame.GetWidth(); x += size + 30, ++cards) {
+                CardPainter::MeasureLabel(frame, name.c_str(), name.size(), size, extents, label);
+                CardPainter::PaintBackground(frame, x, y, size, CardState::Normal);
+                CardPainter::PaintIcon(frame, x, y, size, &icon);
+                CardPainter::PaintLabel(frame, x, y, size, name.c_str(), label);
+            }
+        }
+    });
+    KeepResult(frame.GetPixels()[0]);
+
+    std::printf("software backend, %dpx cards (median of %d runs)\n", size, runs);
+    std::printf("  background       %10.1f us\n", backgroundTime);
+    std::printf("  icon             %10.1f us\n", iconTime);
+    std::printf("  measure label    %10.1f us\n", measureTime);
+    std::printf("  paint label      %10.1f us\n", labelTime);
+    std::printf("  1280x800 frame   %10.1f us  (%d cards, %.1f us/card)\n", frameTime, cards,
+        cards ? frameTime / cards : 0.0);
+    return 0;
+}
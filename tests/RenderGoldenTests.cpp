@@ -0,0 +1,179 @@
+#include "CardPainter.h"
+#include "SoftwareRenderBackend.h"
+#include "TestSupport.h"
+#include <cstdlib>
+#include <cstring>
+
+// tests/golden, set by tests/CMakeLists.txt
+#ifndef GOLDEN_DIR
+#define GOLDEN_DIR "golden"
+#endif
+
+//////////////////////////////////////////////////////////////////////
+// MakeIcon: 64x64 gradient with a transparent corner, so alpha and
+//           scaling both show in the image
+//////////////////////////////////////////////////////////////////////
+static std::vector<uint32_t> MakeIcon() {
+    std::vector<uint32_t> icon(64 * 64);
+    for (int y = 0; y < 64; ++y) {
+        for (int x = 0; x < 64; ++x) {
+            const uint8_t alpha = (x + y < 24) ? 0 : 255;
+            icon[y * 64 + x] = MakeRenderColor(alpha, static_cast<uint8_t>(x * 4),
+                static_cast<uint8_t>(y * 4), 128);
+        }
+    }
+    return icon;
+}
+
+//////////////////////////////////////////////////////////////////////
+// PaintCards: One card per state - wrapped, short and truncated labels,
+//             with the icon and with the missing-icon placeholder
+//////////////////////////////////////////////////////////////////////
+static void PaintCards(SoftwareRenderBackend& backend) {
+    const std::vector<uint32_t> pixels = MakeIcon();
+    RenderImage icon;
+    icon.pixels = pixels.data();
+    icon.width = icon.height = 64;
+
+    static const wchar_t* const names[] = {
+        L"Registry Cleaner Tool", L"Backup",
+        L"Content Replacement Tool With A Name Far Too Long For Two Lines"
+    };
+
+    backend.Clear(MakeRenderColor(255, 249, 249, 249));
+    std::vector<int> extents;
+    for (int i = 0; i < 3; ++i) {
+        const int x = 15 + i * 175, y = 15;
+        LabelMetrics label;
+        CardPainter::MeasureLabel(backend, names[i], std::wcslen(names[i]), 150, extents, label);
+        CardPainter::PaintBackground(backend, x, y, 150, static_cast<CardState>(i));
+        CardPainter::PaintIcon(backend, x, y, 150, i == 1 ? nullptr : &icon);
+        CardPainter::PaintLabel(backend, x, y, 150, names[i], label);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// PaintPrimitives: Each SoftwareRenderBackend call on its own, with
+//                  translucent colors and shapes clipped at the edges
+//////////////////////////////////////////////////////////////////////
+static void PaintPrimitives(SoftwareRenderBackend& backend) {
+    const std::vector<uint32_t> pixels = MakeIcon();
+    RenderImage icon;
+    icon.pixels = pixels.data();
+    icon.width = icon.height = 64;
+
+    backend.Clear(MakeRenderColor(255, 255, 255, 255));
+    backend.FillVerticalGradient(0, 0, 320, 40, MakeRenderColor(255, 245, 91, 204),
+        MakeRenderColor(255, 250, 249, 248));
+    backend.FillRect(-10, 150, 40, 40, MakeRenderColor(255, 0, 120, 212));
+    backend.FillRoundedRect(10, 50, 90, 60, 12, MakeRenderColor(160, 0, 120, 212));
+    backend.FillRoundedRect(60, 80, 90, 60, 30, MakeRenderColor(128, 232, 17, 35));
+    backend.StrokeRoundedRect(170, 50, 60, 60, 8, 1.0f, MakeRenderColor(255, 32, 31, 30));
+    backend.StrokeRoundedRect(245, 50, 60, 60, 16, 2.5f, MakeRenderColor(200, 0, 120, 212));
+    backend.StrokeRoundedRect(290, 130, 60, 60, 10, 1.0f, MakeRenderColor(255, 32, 31, 30));
+    backend.DrawImage(170, 120, 32, 32, icon);
+    backend.DrawImage(210, 120, 70, 40, icon);
+
+    static const wchar_t text[] = L"Tool_Launcher 0.9 {[(#@&%$)]} \x00E9\x4E2D";
+    backend.DrawString(RenderFont::Label, 8, 8, text, std::wcslen(text), MakeRenderColor(255, 32, 31, 30));
+}
+
+//////////////////////////////////////////////////////////////////////
+// Binary PPM (P6): viewable anywhere, no image library needed
+//////////////////////////////////////////////////////////////////////
+static bool WritePpm(const std::string& file, const SoftwareRenderBackend& backend) {
+    FILE* out = std::fopen(file.c_str(), "wb");
+    if (!out)
+        return false;
+
+    std::fprintf(out, "P6\n%d %d\n255\n", backend.GetWidth(), backend.GetHeight());
+    const size_t count = static_cast<size_t>(backend.GetWidth()) * backend.GetHeight();
+    std::vector<uint8_t> rgb(count * 3);
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t pixel = backend.GetPixels()[i];
+        rgb[i * 3] = static_cast<uint8_t>(pixel >> 16);
+        rgb[i * 3 + 1] = static_cast<uint8_t>(pixel >> 8);
+        rgb[i * 3 + 2] = static_cast<uint8_t>(pixel);
+    }
+    const bool ok = std::fwrite(rgb.data(), 1, rgb.size(), out) == rgb.size();
+    return std::fclose(out) == 0 && ok;
+}
+
+static bool ReadPpm(const std::string& file, int& width, int& height, std::vector<uint8_t>& rgb) {
+    FILE* in = std::fopen(file.c_str(), "rb");
+    if (!in)
+        return false;
+
+    int maxValue = 0;
+    bool ok = std::fscanf(in, "P6 %d %d %d", &width, &height, &maxValue) == 3 &&
+        maxValue == 255 && width > 0 && height > 0 && std::fgetc(in) != EOF;
+    if (ok) {
+        rgb.resize(static_cast<size_t>(width) * height * 3);
+        ok = std::fread(rgb.data(), 1, rgb.size(), in) == rgb.size();
+    }
+    std::fclose(in);
+    return ok;
+}
+
+//////////////////////////////////////////////////////////////////////
+// CompareGolden: A channel may be off by 2 (float rounding differs
+//                between compilers); anything more fails. The failing
+//                render is written to <name>.actual.ppm for a look.
+//////////////////////////////////////////////////////////////////////
+static void CompareGolden(const char* name, const SoftwareRenderBackend& backend, bool update) {
+    const std::string golden = std::string(GOLDEN_DIR) + "/" + name + ".ppm";
+    if (update) {
+        CHECK(WritePpm(golden, backend));
+        std::printf("updated %s\n", golden.c_str());
+        return;
+    }
+
+    int width = 0, height = 0;
+    std::vector<uint8_t> expected;
+    if (!ReadPpm(golden, width, height, expected)) {
+        std::fprintf(stderr, "%s: cannot read %s (run with --update to create it)\n", name, golden.c_str());
+        ++TestFailures();
+        return;
+    }
+    CHECK(width == backend.GetWidth() && height == backend.GetHeight());
+    if (width != backend.GetWidth() || height != backend.GetHeight())
+        return;
+
+    size_t differing = 0;
+    int maxDiff = 0;
+    for (size_t i = 0; i < static_cast<size_t>(width) * height; ++i) {
+        const uint32_t pixel = backend.GetPixels()[i];
+        const int channels[3] = { int(pixel >> 16 & 0xFF), int(pixel >> 8 & 0xFF), int(pixel & 0xFF) };
+        int diff = 0;
+        for (int c = 0; c < 3; ++c)
+            diff = (std::max)(diff, std::abs(channels[c] - expected[i * 3 + c]));
+        differing += diff > 2;
+        maxDiff = (std::max)(maxDiff, diff);
+    }
+
+    CHECK(differing == 0);
+    if (differing) {
+        const std::string actual = std::string(name) + ".actual.ppm";
+        WritePpm(actual, backend);
+        std::fprintf(stderr, "%s: %zu pixels differ (max %d), see %s\n", name, differing, maxDiff, actual.c_str());
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// RenderGoldenTests: The software backend against reference images.
+//   RenderGoldenTests [--update]   (--update rewrites tests/golden)
+// Review the new images before committing an update.
+//////////////////////////////////////////////////////////////////////
+int main(int argc, char** argv) {
+    const bool update = argc > 1 && std::strcmp(argv[1], "--update") == 0;
+
+    SoftwareRenderBackend cards(540, 250);
+    PaintCards(cards);
+    CompareGolden("cards", cards, update);
+
+    SoftwareRenderBackend primitives(320, 160);
+    PaintPrimitives(primitives);
+    CompareGolden("primitives", primitives, update);
+
+    return TestResult("RenderGoldenTests");
+}
@@ -0,0 +1,105 @@
+#include "SearchIndex.h"
+#include "TestSupport.h"
+#include <cstdlib>
+#include <random>
+
+//////////////////////////////////////////////////////////////////////
+// MakeKeys: Search keys shaped like tool names ("build deploy 417")
+//////////////////////////////////////////////////////////////////////
+static std::vector<std::wstring> MakeKeys(size_t count) {
+    static const wchar_t* const words[] = {
+        L"build", L"deploy", L"copy", L"user", L"made", L"review", L"comments",
+        L"tool", L"pmd", L"src", L"access", L"folders", L"rename", L"content",
+        L"replacement", L"line", L"counter", L"close", L"test", L"run"
+    };
+    const size_t wordCount = sizeof(words) / sizeof(words[0]);
+
+    std::mt19937 random(1);
+    std::vector<std::wstring> keys;
+    keys.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::wstring key;
+        const size_t parts = 1 + random() % 4;
+        for (size_t j = 0; j < parts; ++j) {
+            if (j)
+                key += L' ';
+            key += words[random() % wordCount];
+        }
+        key += std::to_wstring(random() % 1000);
+        keys.push_back(key);
+    }
+    return keys;
+}
+
+//////////////////////////////////////////////////////////////////////
+// SearchBenchmark: Per-keystroke search cost. Times SearchIndex::Build,
+// Find and FindRanked on single queries, and a SearchSession typing
+// and then erasing a query one character at a time (what the search
+// box does). Find is checked against a brute-force scan.
+//   SearchBenchmark [keys]   (default 150000)
+//////////////////////////////////////////////////////////////////////
+int main(int argc, char** argv) {
+    const size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 150000;
+    const std::vector<std::wstring> keys = MakeKeys(count);
+    const int runs = 5;
+
+    SearchIndex index;
+    const double buildTime = MeasureMicroseconds(runs, [&] { index.Build(keys); });
+    std::printf("keys %zu (median of %d runs)\n", count, runs);
+    std::printf("  build                  %10.1f us\n", buildTime);
+
+    static const wchar_t* const queries[] = {
+        L"b", L"bu", L"build", L"build deploy", L"ment", L"py u", L"cpyusr", L"rplc", L"xyz"
+    };
+
+    bool ok = true;
+    SearchScratch scratch;
+    std::vector<uint32_t> results;
+    for (const wchar_t* query : queries) {
+        const double findTime = MeasureMicroseconds(runs, [&] { index.Find(query, results, scratch); });
+
+        size_t expected = 0, position = 0;
+        bool same = true;
+        for (uint32_t id = 0; id < keys.size(); ++id) {
+            if (keys[id].find(query) == std::wstring::npos)
+                continue;
+            same &= position < results.size() && results[position] == id;
+            ++position;
+            ++expected;
+        }
+        ok &= same && expected == results.size();
+
+        const double rankedTime = MeasureMicroseconds(runs, [&] { index.FindRanked(query, results, scratch); });
+        std::printf("  %-14ls find %8.1f us   ranked %8.1f us   %zu hits\n",
+            query, findTime, rankedTime, results.size());
+    }
+
+    // Typing refines the previous results, backspace pops remembered steps
+    const std::wstring typed = L"replacement";
+    SearchSession session(index);
+    size_t sessionHits = 0;
+    const double typingTime = MeasureMicroseconds(runs, [&] {
+        session.Reset();
+        for (size_t i = 1; i <= typed.size(); ++i)
+            sessionHits = session.Search(typed.substr(0, i))->size();
+    });
+    const double erasingTime = MeasureMicroseconds(runs, [&] {
+        for (size_t i = typed.size(); i-- > 1;)
+            sessionHits = session.Search(typed.substr(0, i))->size();
+        for (size_t i = 2; i <= typed.size(); ++i)
+            session.Search(typed.substr(0, i));
+    });
+    KeepResult(sessionHits);
+
+    index.FindRanked(typed, results, scratch);
+    ok &= *session.Search(typed) == results;
+
+    std::printf("  session: type \"%ls\" %10.1f us total\n", typed.c_str(), typingTime);
+    std::printf("  session: erase and retype %7.1f us total\n", erasingTime);
+
+    if (!ok) {
+        std::fprintf(stderr, "SearchBenchmark: results differ from a brute-force scan\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>           // std::sort (median)
+#include <chrono>              // steady_clock
+#include <cstdio>              // Failure and timing output
+#include <filesystem>          // Scratch files
+#include <string>              // std::wstring paths
+#include <vector>              // Run times
+
+////////////////////////////////////////////////////////////////////////
+// Test support for the portable modules. No framework: each test is a
+// small executable whose main returns TestResult(), each benchmark one
+// that prints its timings (ctest runs those with a small size so they
+// keep building and running).
+////////////////////////////////////////////////////////////////////////
+
+inline int& TestFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+// Reports and counts a failure, then carries on with the next check
+#define CHECK(condition)                                                          \
+    do {                                                                          \
+        if (!(condition)) {                                                       \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, \
+                #condition);                                                      \
+            ++TestFailures();                                                     \
+        }                                                                         \
+    } while (0)
+
+inline int TestResult(const char* name) {
+    if (TestFailures()) {
+        std::fprintf(stderr, "%s: %d check(s) failed\n", name, TestFailures());
+        return 1;
+    }
+    std::printf("%s: all checks passed\n", name);
+    return 0;
+}
+
+// A file in the temp folder, removed first if a previous run left it
+inline std::wstring ScratchPath(const wchar_t* name) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    return path.wstring();
+}
+
+// An empty folder in the temp folder; a previous run's is removed first
+inline std::filesystem::path ScratchFolder(const wchar_t* name) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::error_code ec;
+    std::filesystem::remove_all(path, ec);
+    std::filesystem::create_directories(path, ec);
+    return path;
+}
+
+// Median wall time of `runs` calls of `body`, in microseconds
+template <typename Body>
+double MeasureMicroseconds(int runs, Body&& body) {
+    std::vector<double> times;
+    times.reserve(runs);
+    for (int i = 0; i < runs; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        times.push_back(std::chrono::duration<double, std::micro>(
+            std::chrono::steady_clock::now() - start).count());
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+// Keeps the optimizer from dropping a benchmarked result
+inline const void* volatile keptResult = nullptr;
+
+template <typename T>
+inline void KeepResult(const T& value) {
+    keptResult = &value;
+}
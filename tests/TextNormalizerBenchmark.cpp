@@ -0,0 +1,118 @@
+#include "TextNormalizer.h"
+#include "TestSupport.h"
+#include <cstdlib>
+#include <cwchar>
+#include <random>
+
+// Mirrors the kernel selection at the top of TextNormalizer.cpp
+#if WCHAR_MAX != 0xFFFF || defined(TEXTNORMALIZER_SCALAR)
+static const char* const kKernel = "scalar";
+#elif defined(__AVX2__)
+static const char* const kKernel = "AVX2";
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+static const char* const kKernel = "SSE2";
+#else
+static const char* const kKernel = "scalar";
+#endif
+
+//////////////////////////////////////////////////////////////////////
+// Name: Tool names, back to back in one buffer
+//////////////////////////////////////////////////////////////////////
+struct Name {
+    size_t start;
+    size_t length;
+};
+
+//////////////////////////////////////////////////////////////////////
+// MakeNames: 12-41 characters, "Build_Tool_V2" style. One name in
+//            `foreignEvery` also gets a Latin-1/Greek/Cyrillic letter.
+//////////////////////////////////////////////////////////////////////
+static void MakeNames(size_t count, size_t foreignEvery, std::vector<wchar_t>& text, std::vector<Name>& names) {
+    static const wchar_t foreign[] = { 0xC9, 0xD6, 0x393, 0x3A3, 0x416, 0x42F };
+
+    std::mt19937 random(3);
+    names.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        Name name = { text.size(), 12 + random() % 30 };
+        for (size_t j = 0; j < name.length; ++j) {
+            const uint32_t r = random() % 40;
+            text.push_back(static_cast<wchar_t>(r < 26 ? L'A' + r : r < 36 ? L'a' + (r - 26) : L'_'));
+        }
+        if (foreignEvery && i % foreignEvery == 0)
+            text[name.start + random() % name.length] = foreign[random() % 6];
+        names.push_back(name);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// TextNormalizerBenchmark: Case folding of tool names by the kernel
+// this build selects. tests/CMakeLists.txt builds it once per kernel
+// (scalar, SSE2, AVX2) with 16-bit wchar_t, as on Windows, so the
+// three runs compare like for like. Each run checks its output
+// against the one-character-at-a-time path.
+//   TextNormalizerBenchmark [names]   (default 200000)
+// Only the raw-pointer API is used: with -fshort-wchar the standard
+// library's std::wstring no longer matches wchar_t.
+//////////////////////////////////////////////////////////////////////
+int main(int argc, char** argv) {
+#if defined(__AVX2__) && defined(__GNUC__)
+    if (!__builtin_cpu_supports("avx2")) {
+        std::printf("TextNormalizerBenchmark: skipped, this CPU has no AVX2\n");
+        return 0;
+    }
+#endif
+
+    const size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+    const int runs = 5;
+    std::printf("kernel %s, %zu-bit wchar_t, %zu names (median of %d runs)\n",
+        kKernel, sizeof(wchar_t) * 8, count, runs);
+
+    bool ok = true;
+    for (size_t foreignEvery : { size_t(0), size_t(8) }) {
+        std::vector<wchar_t> text;
+        std::vector<Name> names;
+        MakeNames(count, foreignEvery, text, names);
+
+        std::vector<wchar_t> searchKeys(text.size()), displayText(text.size()), expected(text.size());
+        wchar_t* const keys = searchKeys.data();
+
+        const double perCharTime = MeasureMicroseconds(runs, [&] {
+            for (size_t i = 0; i < text.size(); ++i)
+                expected[i] = text[i] == L'_' ? L' ' : TextNormalizer::Lower(text[i]);
+            KeepResult(expected);
+        });
+        const double lowerTime = MeasureMicroseconds(runs, [&] {
+            for (const Name& name : names)
+                TextNormalizer::ToLower(&text[name.start], name.length, keys + name.start);
+            KeepResult(searchKeys);
+        });
+        const double searchKeyTime = MeasureMicroseconds(runs, [&] {
+            for (const Name& name : names)
+                TextNormalizer::ToSearchKey(&text[name.start], name.length, keys + name.start);
+            KeepResult(searchKeys);
+        });
+        ok &= searchKeys == expected;
+
+        const double makeKeysTime = MeasureMicroseconds(runs, [&] {
+            for (const Name& name : names)
+                TextNormalizer::MakeKeys(&text[name.start], name.length, keys + name.start, &displayText[name.start]);
+            KeepResult(displayText);
+        });
+        ok &= searchKeys == expected;
+
+        if (foreignEvery)
+            std::printf("  1 in %zu names non-ASCII:\n", foreignEvery);
+        else
+            std::printf("  ASCII names:\n");
+        std::printf("    Lower per char   %10.1f us\n", perCharTime);
+        std::printf("    ToLower          %10.1f us\n", lowerTime);
+        std::printf("    ToSearchKey      %10.1f us\n", searchKeyTime);
+        std::printf("    MakeKeys         %10.1f us  (search key + display text)\n", makeKeysTime);
+    }
+
+    if (!ok) {
+        std::fprintf(stderr, "TextNormalizerBenchmark: kernel output differs from TextNormalizer::Lower\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,194 @@
+#include "ToolWatcher.h"
+#include "TestSupport.h"
+#include <fstream>
+
+namespace fs = std::filesystem;
+using Kind = CatalogDelta::Kind;
+
+static bool IsDelta(const CatalogDelta& delta, Kind kind, const std::wstring& path,
+    const std::wstring& oldPath = std::wstring()) {
+    return delta.kind == kind && delta.path == path && delta.oldPath == oldPath;
+}
+
+//////////////////////////////////////////////////////////////////////
+// CreateDeleteCancels: A file that came and went within one batch is
+//                      no change at all, however often it was written
+//////////////////////////////////////////////////////////////////////
+static void CreateDeleteCancels() {
+    DeltaCoalescer coalescer;
+    coalescer.Added(L"a.bat");
+    coalescer.Removed(L"a.bat");
+    CHECK(!coalescer.Empty());
+    CHECK(coalescer.Drain().empty());
+    CHECK(coalescer.Empty());
+
+    coalescer.Added(L"b.bat");
+    for (int i = 0; i < 10; ++i)
+        coalescer.Modified(L"b.bat");
+    coalescer.Renamed(L"b.bat", L"c.bat");
+    coalescer.Removed(L"c.bat");
+    CHECK(coalescer.Drain().empty());
+}
+
+//////////////////////////////////////////////////////////////////////
+// CreateModifyRename: Create, N writes and a rename is one Added under
+//                     the final name - the first name never existed
+//////////////////////////////////////////////////////////////////////
+static void CreateModifyRename() {
+    DeltaCoalescer coalescer;
+    coalescer.Added(L"setup.tmp.bat");
+    for (int i = 0; i < 200; ++i)
+        coalescer.Modified(L"setup.tmp.bat");
+    coalescer.Renamed(L"setup.tmp.bat", L"setup.bat");
+
+    const std::vector<CatalogDelta> deltas = coalescer.Drain();
+    CHECK(deltas.size() == 1);
+    CHECK(!deltas.empty() && IsDelta(deltas[0], Kind::Added, L"setup.bat"));
+}
+
+//////////////////////////////////////////////////////////////////////
+// ExistingFiles: Changes to files that were there before the batch
+//////////////////////////////////////////////////////////////////////
+static void ExistingFiles() {
+    DeltaCoalescer coalescer;
+
+    // Written several times: one Modified
+    coalescer.Modified(L"a.bat");
+    coalescer.Modified(L"a.bat");
+
+    // Deleted and recreated: changed, not removed
+    coalescer.Removed(L"b.bat");
+    coalescer.Added(L"b.bat");
+
+    // Renamed twice: one rename from the pre-batch name
+    coalescer.Renamed(L"c.bat", L"d.bat");
+    coalescer.Renamed(L"d.bat", L"e.bat");
+
+    // Removals come after everything else
+    coalescer.Removed(L"f.bat");
+    coalescer.Modified(L"g.bat");
+
+    const std::vector<CatalogDelta> deltas = coalescer.Drain();
+    CHECK(deltas.size() == 5);
+    if (deltas.size() == 5) {
+        CHECK(IsDelta(deltas[0], Kind::Modified, L"a.bat"));
+        CHECK(IsDelta(deltas[1], Kind::Modified, L"b.bat"));
+        CHECK(IsDelta(deltas[2], Kind::Renamed, L"e.bat", L"c.bat"));
+        CHECK(IsDelta(deltas[3], Kind::Modified, L"g.bat"));
+        CHECK(IsDelta(deltas[4], Kind::Removed, L"f.bat"));
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// OverflowRescans: Once events were lost the batch is a single Rescan,
+//                  and the next batch starts clean
+//////////////////////////////////////////////////////////////////////
+static void OverflowRescans() {
+    DeltaCoalescer coalescer;
+    coalescer.Added(L"a.bat");
+    coalescer.Overflow();
+    coalescer.Removed(L"b.bat");
+
+    std::vector<CatalogDelta> deltas = coalescer.Drain();
+    CHECK(deltas.size() == 1);
+    CHECK(!deltas.empty() && deltas[0].kind == Kind::Rescan);
+
+    CHECK(coalescer.Empty());
+    coalescer.Overflow();
+    CHECK(!coalescer.Empty());
+    CHECK(coalescer.Drain().size() == 1);
+    CHECK(coalescer.Drain().empty());
+}
+
+//////////////////////////////////////////////////////////////////////
+// BatchQueue: Collects the watcher's batches from its flush thread
+//////////////////////////////////////////////////////////////////////
+class BatchQueue {
+public:
+    void Push(std::vector<CatalogDelta>&& batch) {
+        std::lock_guard<std::mutex> guard(lock);
+        batches.push_back(std::move(batch));
+        ready.notify_one();
+    }
+
+    // The next batch, or an empty one if none arrives in time
+    std::vector<CatalogDelta> Wait(std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> guard(lock);
+        if (!ready.wait_for(guard, timeout, [&] { return !batches.empty(); }))
+            return std::vector<CatalogDelta>();
+        std::vector<CatalogDelta> batch = std::move(batches.front());
+        batches.erase(batches.begin());
+        return batch;
+    }
+
+private:
+    std::mutex lock;
+    std::condition_variable ready;
+    std::vector<std::vector<CatalogDelta>> batches;
+};
+
+static void Write(const fs::path& path, int times) {
+    for (int i = 0; i < times; ++i)
+        std::ofstream(path, std::ios::app) << "x";
+}
+
+//////////////////////////////////////////////////////////////////////
+// WatcherSmoke: The platform backend (inotify here) end to end - real
+//               file operations arrive as one coalesced batch each
+//////////////////////////////////////////////////////////////////////
+static void WatcherSmoke() {
+    const fs::path root = ScratchFolder(L"ToolWatcherTests");
+    const std::chrono::milliseconds timeout(5000);
+    BatchQueue queue;
+
+    ToolWatcher watcher;
+    watcher.SetTiming(std::chrono::milliseconds(200), std::chrono::milliseconds(2000));
+    CHECK(watcher.Start({ root.wstring() }, { L".bat" },
+        [&](std::vector<CatalogDelta>&& batch) { queue.Push(std::move(batch)); }));
+
+    // The reader thread sets its watches up after Start returns; poke a
+    // file until the first batch shows they are in place
+    const fs::path probe = root / L"probe.bat";
+    std::vector<CatalogDelta> batch;
+    for (int attempt = 0; attempt < 50 && batch.empty(); ++attempt) {
+        Write(probe, 1);
+        batch = queue.Wait(std::chrono::milliseconds(100));
+    }
+    CHECK(!batch.empty());
+    while (!queue.Wait(std::chrono::milliseconds(500)).empty()) {}
+
+    // Create, write, rename - and a non-tool alongside, filtered out
+    Write(root / L"build.tmp.bat", 20);
+    Write(root / L"notes.txt", 5);
+    fs::rename(root / L"build.tmp.bat", root / L"build.bat");
+    batch = queue.Wait(timeout);
+    CHECK(batch.size() == 1);
+    CHECK(!batch.empty() && batch[0].kind == Kind::Added && fs::path(batch[0].path) == root / L"build.bat");
+
+    // Rename of a file the catalog already has
+    fs::rename(root / L"build.bat", root / L"make.bat");
+    batch = queue.Wait(timeout);
+    CHECK(batch.size() == 1);
+    CHECK(!batch.empty() && batch[0].kind == Kind::Renamed &&
+        fs::path(batch[0].path) == root / L"make.bat" && fs::path(batch[0].oldPath) == root / L"build.bat");
+
+    fs::remove(root / L"make.bat");
+    batch = queue.Wait(timeout);
+    CHECK(batch.size() == 1);
+    CHECK(!batch.empty() && batch[0].kind == Kind::Removed && fs::path(batch[0].path) == root / L"make.bat");
+
+    watcher.Stop();
+    CHECK(!watcher.IsRunning());
+
+    std::error_code ec;
+    fs::remove_all(root, ec);
+}
+
+int main() {
+    CreateDeleteCancels();
+    CreateModifyRename();
+    ExistingFiles();
+    OverflowRescans();
+    WatcherSmoke();
+    return TestResult("ToolWatcherTests");
+}